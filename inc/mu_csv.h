@@ -0,0 +1,170 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_csv.h
+ *
+ * @brief An RFC 4180 CSV reader that yields each record as an array of
+ * `mu_string_t` field views into the original input.
+ *
+ * The reader makes a single pass over the input and never copies field data.
+ * Quoted fields are returned with their surrounding quotes removed but with
+ * any doubled quotes (`""`) left in place.  Call `mu_csv_unescape()` on a
+ * field only when you need its literal value: fields without embedded quotes
+ * are returned as-is with no copying.  As RFC 4180 requires, a quote may
+ * appear only in a quoted field; one in an unquoted field is a syntax error.
+ *
+ * Records may be terminated by LF, CRLF or a lone CR.  A final record need not
+ * be terminated.
+ */
+
+#ifndef MU_CSV_H
+#define MU_CSV_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Result codes returned by mu_csv_read_record().
+ */
+typedef enum {
+    MU_CSV_ERR_NONE,             ///< A record was read.
+    MU_CSV_ERR_END,              ///< No more records in the input.
+    MU_CSV_ERR_TOO_MANY_FIELDS,  ///< Record had more fields than the array.
+    MU_CSV_ERR_UNTERMINATED,     ///< Input ended inside a quoted field.
+    MU_CSV_ERR_SYNTAX,           ///< Junk between a closing quote and the
+                                 ///< next delimiter or end of record, or a
+                                 ///< quote inside an unquoted field.
+    MU_CSV_ERR_INVALID,          ///< Invalid argument or reader state.
+} mu_csv_err_t;
+
+/**
+ * @brief CSV reader state.
+ *
+ * Treat as opaque: initialize with mu_csv_reader_init().
+ */
+typedef struct {
+    mu_string_t remaining; ///< Input not yet consumed.
+    char delimiter;        ///< Field delimiter, typically ','.
+    char quote;            ///< Quote character, typically '"'.
+} mu_csv_reader_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Initializes a CSV reader over an input view.
+ *
+ * The reader holds a view into `input`: the underlying buffer must outlive the
+ * reader and all field views it produces.
+ *
+ * @param reader The reader to initialize.
+ * @param input The CSV text.
+ * @param delimiter The field delimiter, typically ','.
+ * @param quote The quote character, typically '"'.
+ * @return `reader`, or NULL if `reader` is NULL or `input` is invalid.
+ */
+mu_csv_reader_t *mu_csv_reader_init(mu_csv_reader_t *reader, mu_string_t input,
+                                    char delimiter, char quote);
+
+/**
+ * @brief Reads the next record from the input.
+ *
+ * On success, `fields[0 .. *n_fields - 1]` hold views of the record's fields
+ * and the reader advances past the record terminator.  An empty line yields a
+ * record with a single empty field.
+ *
+ * If the record has more fields than `max_fields`, the first `max_fields`
+ * fields are stored, `*n_fields` is set to the actual field count, the reader
+ * advances past the record and MU_CSV_ERR_TOO_MANY_FIELDS is returned.
+ *
+ * On MU_CSV_ERR_UNTERMINATED or MU_CSV_ERR_SYNTAX the reader is left at the
+ * start of the offending record so the caller can report or skip it.
+ *
+ * @param reader The reader.
+ * @param fields Caller-provided array to receive field views.
+ * @param max_fields The number of elements in `fields`.
+ * @param n_fields Receives the number of fields in the record.  May be NULL.
+ * @return A mu_csv_err_t result code.
+ */
+mu_csv_err_t mu_csv_read_record(mu_csv_reader_t *reader, mu_string_t *fields,
+                                size_t max_fields, size_t *n_fields);
+
+/**
+ * @brief Returns the input not yet consumed by the reader.
+ *
+ * @param reader The reader.
+ * @return A view of the unconsumed input, or MU_STRING_INVALID if reader is
+ * NULL.
+ */
+mu_string_t mu_csv_remaining(const mu_csv_reader_t *reader);
+
+/**
+ * @brief Returns true if a field view contains escaped (doubled) quotes and
+ * must be passed through mu_csv_unescape() to obtain its literal value.
+ *
+ * @param reader The reader that produced the field.
+ * @param field A field view returned by mu_csv_read_record().
+ * @return true if the field contains the quote character.
+ */
+bool mu_csv_needs_unescape(const mu_csv_reader_t *reader, mu_string_t field);
+
+/**
+ * @brief Produces the literal value of a field by collapsing doubled quotes.
+ *
+ * If the field contains no quote characters it is returned unchanged and
+ * `dst` is not touched.  Otherwise the unescaped value is written to `dst`
+ * and a view of the written bytes is returned.
+ *
+ * @param reader The reader that produced the field.
+ * @param dst Destination buffer used only if unescaping is required.
+ * @param field A field view returned by mu_csv_read_record().
+ * @return A view of the literal field value, or MU_STRING_INVALID if the
+ * arguments are invalid or `dst` is too small to hold the result.
+ */
+mu_string_t mu_csv_unescape(const mu_csv_reader_t *reader, mu_string_mut_t dst,
+                            mu_string_t field);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_CSV_H
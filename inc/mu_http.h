@@ -0,0 +1,156 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_http.h
+ *
+ * @brief A zero-copy HTTP/1.x request line and header parser.
+ *
+ * The parser fills a caller-provided array of `{name, value}` header pairs
+ * whose views point directly into the input buffer.  It is designed for
+ * incremental reads: pass the whole buffer received so far each time more
+ * data arrives, along with the length passed on the previous call, and the
+ * parser reports MU_HTTP_ERR_INCOMPLETE cheaply until the blank line that ends
+ * the header block has been received.
+ *
+ * Both CRLF and bare LF line endings are accepted.  Header values are trimmed
+ * of surrounding spaces and tabs.  Obsolete line folding is rejected.
+ */
+
+#ifndef MU_HTTP_H
+#define MU_HTTP_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Result codes returned by mu_http_parse_request().
+ */
+typedef enum {
+    MU_HTTP_ERR_NONE,             ///< Request line and headers parsed.
+    MU_HTTP_ERR_INCOMPLETE,       ///< More input is needed.
+    MU_HTTP_ERR_SYNTAX,           ///< Malformed request line or header.
+    MU_HTTP_ERR_TOO_MANY_HEADERS, ///< Header array is too small.
+    MU_HTTP_ERR_INVALID,          ///< Invalid argument.
+} mu_http_err_t;
+
+/**
+ * @brief A single header field.
+ */
+typedef struct {
+    mu_string_t name;  ///< Field name, as received (case preserved).
+    mu_string_t value; ///< Field value, without surrounding whitespace.
+} mu_http_header_t;
+
+/**
+ * @brief A parsed request.
+ *
+ * Set `headers` and `max_headers` before calling mu_http_parse_request();
+ * the parser fills in the remaining fields.
+ */
+typedef struct {
+    mu_string_t method;        ///< e.g. "GET".
+    mu_string_t target;        ///< Request target, e.g. "/index.html?q=1".
+    int minor_version;         ///< 0 for HTTP/1.0, 1 for HTTP/1.1.
+    mu_http_header_t *headers; ///< Caller-provided header array.
+    size_t max_headers;        ///< Number of elements in `headers`.
+    size_t n_headers;          ///< Number of headers parsed.
+    size_t header_len;         ///< Bytes consumed, including the blank line.
+} mu_http_request_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Initializes a request to parse into the given header array.
+ *
+ * @param req The request to initialize.
+ * @param headers Caller-provided array to receive header views.
+ * @param max_headers The number of elements in `headers`.
+ * @return `req`, or NULL if `req` is NULL.
+ */
+mu_http_request_t *mu_http_request_init(mu_http_request_t *req,
+                                        mu_http_header_t *headers,
+                                        size_t max_headers);
+
+/**
+ * @brief Parses an HTTP/1.x request line and header block.
+ *
+ * On MU_HTTP_ERR_NONE, `req->header_len` is the number of bytes occupied by
+ * the request line and headers: any message body begins at that offset.
+ *
+ * For incremental parsing, pass the full buffer received so far in `input` and
+ * the value of `input.len` from the previous call in `prev_len` (0 on the
+ * first call).  Bytes already known not to complete the header block are not
+ * rescanned.
+ *
+ * @param req The request, initialized with mu_http_request_init().
+ * @param input All bytes received so far.
+ * @param prev_len The length of `input` on the previous call, or 0.
+ * @return A mu_http_err_t result code.
+ */
+mu_http_err_t mu_http_parse_request(mu_http_request_t *req, mu_string_t input,
+                                    size_t prev_len);
+
+/**
+ * @brief Compares two header names, ignoring ASCII case.
+ *
+ * @param a The first name.
+ * @param b The second name.
+ * @return true if the names are equal ignoring case.
+ */
+bool mu_http_name_eq(mu_string_t a, mu_string_t b);
+
+/**
+ * @brief Finds a header by name, ignoring ASCII case.
+ *
+ * @param req A successfully parsed request.
+ * @param name The header name to look for.
+ * @return A view of the value of the first matching header, or
+ * MU_STRING_NOT_FOUND if there is none.
+ */
+mu_string_t mu_http_find_header(const mu_http_request_t *req, mu_string_t name);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_HTTP_H
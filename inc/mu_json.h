@@ -0,0 +1,173 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_json.h
+ *
+ * @brief A validating JSON tokenizer that writes a flat "tape" of tokens into
+ * a caller-provided array.
+ *
+ * Each token records its kind and a `mu_string_t` span into the input.
+ * Strings are returned without their quotes but with escape sequences left
+ * intact (see mu_json_unescape()); numbers are returned as raw views for the
+ * caller to convert as needed.  Nothing is allocated and nothing is copied.
+ *
+ * Container start and end tokens are linked to each other, so a consumer can
+ * step over an entire nested value in constant time.  This makes it cheap to
+ * pick a few fields out of a large document with mu_json_find_key() and
+ * mu_json_next().
+ */
+
+#ifndef MU_JSON_H
+#define MU_JSON_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Returned by tape navigation functions when no token matches.
+ */
+#define MU_JSON_NOT_FOUND SIZE_MAX
+
+/**
+ * @brief Result codes returned by mu_json_tokenize().
+ */
+typedef enum {
+    MU_JSON_ERR_NONE,            ///< The input is a complete JSON value.
+    MU_JSON_ERR_INCOMPLETE,      ///< The input ended before the value did.
+    MU_JSON_ERR_SYNTAX,          ///< The input is not valid JSON.
+    MU_JSON_ERR_TOO_MANY_TOKENS, ///< The tape array is too small.
+    MU_JSON_ERR_INVALID,         ///< Invalid argument.
+} mu_json_err_t;
+
+/**
+ * @brief The kind of a tape token.
+ */
+typedef enum {
+    MU_JSON_OBJECT_START, ///< '{'.  `link` is the index of the matching end.
+    MU_JSON_OBJECT_END,   ///< '}'.  `link` is the index of the matching start.
+    MU_JSON_ARRAY_START,  ///< '['.  `link` is the index of the matching end.
+    MU_JSON_ARRAY_END,    ///< ']'.  `link` is the index of the matching start.
+    MU_JSON_KEY,          ///< An object member name (escaped, no quotes).
+    MU_JSON_STRING,       ///< A string value (escaped, no quotes).
+    MU_JSON_NUMBER,       ///< A number, as it appears in the input.
+    MU_JSON_TRUE,         ///< The literal `true`.
+    MU_JSON_FALSE,        ///< The literal `false`.
+    MU_JSON_NULL,         ///< The literal `null`.
+} mu_json_kind_t;
+
+/**
+ * @brief A single tape token.
+ */
+typedef struct {
+    mu_json_kind_t kind; ///< The token kind.
+    mu_string_t span;    ///< The token text.  For container starts, spans the
+                         ///< whole container including its brackets.
+    size_t link;         ///< For container tokens, the index of the matching
+                         ///< start or end token.  Otherwise 0.
+} mu_json_token_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Tokenizes a JSON text into a flat tape.
+ *
+ * The input must hold exactly one JSON value, optionally surrounded by
+ * whitespace.
+ *
+ * @param input The JSON text.
+ * @param tape Caller-provided array to receive the tokens.
+ * @param max_tokens The number of elements in `tape`.
+ * @param n_tokens Receives the number of tokens written.  May be NULL.
+ * @return A mu_json_err_t result code.  On any error other than
+ * MU_JSON_ERR_INVALID, `*n_tokens` holds the number of tokens written before
+ * the error was detected.
+ */
+mu_json_err_t mu_json_tokenize(mu_string_t input, mu_json_token_t *tape,
+                               size_t max_tokens, size_t *n_tokens);
+
+/**
+ * @brief Returns the index of the token following the value at `index`,
+ * stepping over nested containers.
+ *
+ * @param tape The tape.
+ * @param n_tokens The number of tokens in the tape.
+ * @param index The index of a value (or key) token.
+ * @return The index just past the value, or MU_JSON_NOT_FOUND if `index` is
+ * out of range or refers to an end token.
+ */
+size_t mu_json_next(const mu_json_token_t *tape, size_t n_tokens, size_t index);
+
+/**
+ * @brief Finds a member of an object by key.
+ *
+ * Keys are compared byte-for-byte against their escaped form in the input.
+ *
+ * @param tape The tape.
+ * @param n_tokens The number of tokens in the tape.
+ * @param object The index of a MU_JSON_OBJECT_START token.
+ * @param key The key to look for.
+ * @return The index of the member's value token, or MU_JSON_NOT_FOUND.
+ */
+size_t mu_json_find_key(const mu_json_token_t *tape, size_t n_tokens,
+                        size_t object, mu_string_t key);
+
+/**
+ * @brief Decodes the escape sequences in a string or key span.
+ *
+ * If the span contains no backslashes it is returned unchanged and `dst` is
+ * not touched.  Otherwise the decoded UTF-8 text is written to `dst` and a
+ * view of the written bytes is returned.
+ *
+ * @param dst Destination buffer used only if decoding is required.
+ * @param span A MU_JSON_STRING or MU_JSON_KEY span.
+ * @return A view of the decoded string, or MU_STRING_INVALID if the span holds
+ * a malformed escape or `dst` is too small.
+ */
+mu_string_t mu_json_unescape(mu_string_mut_t dst, mu_string_t span);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_JSON_H
@@ -0,0 +1,150 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_kv.h
+ *
+ * @brief A one-pass reader for `key=value` records such as logfmt log lines
+ * and `;`-separated cookie headers.
+ *
+ * The reader yields each key and value as a `mu_string_t` view into the
+ * input.  Separators are configurable:
+ *
+ *   logfmt:  `level=info msg="hello world" dur=3ms`   (' ', '=', '"')
+ *   cookies: `sid=abc123; theme=dark; lang=en`        (';', '=', '"')
+ *
+ * Whitespace around keys and unquoted values is ignored.  A key with no
+ * separator (e.g. `debug` in logfmt) yields an empty value.  Quoted values are
+ * returned without their quotes but with backslash escapes left in place; use
+ * mu_kv_unescape() to decode them when needed.
+ */
+
+#ifndef MU_KV_H
+#define MU_KV_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Result codes returned by mu_kv_next().
+ */
+typedef enum {
+    MU_KV_ERR_NONE,         ///< A pair was read.
+    MU_KV_ERR_END,          ///< No more pairs in the input.
+    MU_KV_ERR_UNTERMINATED, ///< Input ended inside a quoted value.
+    MU_KV_ERR_SYNTAX,       ///< Junk immediately after a closing quote.
+    MU_KV_ERR_INVALID,      ///< Invalid argument or reader state.
+} mu_kv_err_t;
+
+/**
+ * @brief Key/value reader state.
+ *
+ * Treat as opaque: initialize with mu_kv_reader_init().
+ */
+typedef struct {
+    mu_string_t remaining; ///< Input not yet consumed.
+    char pair_sep;         ///< Separator between pairs, e.g. ' ' or ';'.
+    char kv_sep;           ///< Separator between key and value, e.g. '='.
+    char quote;            ///< Quote character, or '\0' to disable quoting.
+} mu_kv_reader_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Initializes a key/value reader over an input view.
+ *
+ * @param reader The reader to initialize.
+ * @param input The text to parse.
+ * @param pair_sep The separator between pairs.
+ * @param kv_sep The separator between a key and its value.
+ * @param quote The quote character for values, or '\0' for none.
+ * @return `reader`, or NULL if `reader` is NULL or `input` is invalid.
+ */
+mu_kv_reader_t *mu_kv_reader_init(mu_kv_reader_t *reader, mu_string_t input,
+                                  char pair_sep, char kv_sep, char quote);
+
+/**
+ * @brief Reads the next key/value pair.
+ *
+ * On MU_KV_ERR_UNTERMINATED or MU_KV_ERR_SYNTAX, the reader is left at the
+ * start of the offending pair.
+ *
+ * @param reader The reader.
+ * @param key Receives a view of the key.
+ * @param value Receives a view of the value (empty if the key has none).
+ * @return A mu_kv_err_t result code.
+ */
+mu_kv_err_t mu_kv_next(mu_kv_reader_t *reader, mu_string_t *key,
+                       mu_string_t *value);
+
+/**
+ * @brief Scans the input for the first pair whose key equals `key`.
+ *
+ * @param input The text to search.
+ * @param pair_sep The separator between pairs.
+ * @param kv_sep The separator between a key and its value.
+ * @param quote The quote character for values, or '\0' for none.
+ * @param key The key to look for.
+ * @return A view of the value, or MU_STRING_NOT_FOUND if no pair has the key
+ * or the input is malformed before it is reached.
+ */
+mu_string_t mu_kv_find(mu_string_t input, char pair_sep, char kv_sep,
+                       char quote, mu_string_t key);
+
+/**
+ * @brief Decodes backslash escapes in a quoted value.
+ *
+ * A backslash makes the following byte literal.  If the value contains no
+ * backslashes it is returned unchanged and `dst` is not touched.
+ *
+ * @param dst Destination buffer used only if decoding is required.
+ * @param value A value view returned by mu_kv_next().
+ * @return A view of the decoded value, or MU_STRING_INVALID if `dst` is too
+ * small or the value ends in a lone backslash.
+ */
+mu_string_t mu_kv_unescape(mu_string_mut_t dst, mu_string_t value);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_KV_H
@@ -132,6 +132,32 @@ typedef struct {
  */
 #define MU_STRING_END INT_MAX
 
+#ifndef MU_STRING_SWAR
+/**
+ * @brief Selects how mu_string.c scans memory.
+ *
+ * When non-zero (the default), the character searches, counts and
+ * case-insensitive compares test eight bytes per step using 64-bit integer
+ * arithmetic ("SWAR").  This needs no vector instructions, so it also helps
+ * builds without SSE.  Define as 0 to use plain byte loops instead.  Results
+ * are the same either way.
+ */
+#define MU_STRING_SWAR 1
+#endif
+
+#ifndef MU_STRING_STREAM_THRESHOLD
+/**
+ * @brief Copies of at least this many bytes bypass the cache.
+ *
+ * mu_string_copy() and mu_string_append() write copies this large with
+ * non-temporal (streaming) stores where the target has them (x86 with SSE2),
+ * so that copying a large buffer does not evict the rest of the process's
+ * working set.  Smaller copies, overlapping copies and other targets use
+ * memcpy() or memmove().  Define as 0 to always use them.
+ */
+#define MU_STRING_STREAM_THRESHOLD (1024u * 1024u)
+#endif
+
 /**
  * @brief Predicate function type used by find/trim/split functions.
  *
@@ -141,6 +167,18 @@ typedef struct {
  */
 typedef bool (*mu_string_pred_t)(char ch, void *arg);
 
+/**
+ * @brief One edit for mu_string_mut_apply_edits(): replace `count` bytes at
+ * `pos` with `text`.
+ *
+ * Positions refer to the contents before any of the edits are applied.
+ */
+typedef struct {
+    size_t pos;       ///< Offset of the first byte to replace.
+    size_t count;     ///< Number of bytes to replace; 0 to insert.
+    mu_string_t text; ///< Replacement bytes; empty to erase.
+} mu_string_edit_t;
+
 // *****************************************************************************
 // Public function prototypes
 
@@ -290,6 +328,63 @@ bool mu_string_starts_with(mu_string_t s, mu_string_t prefix);
  */
 bool mu_string_ends_with(mu_string_t s, mu_string_t suffix);
 
+/**
+ * @brief Checks if two string views are equal, ignoring ASCII case.
+ *
+ * Only the letters A-Z and a-z are folded; all other bytes must match
+ * exactly.  Validity is treated as in mu_string_eq().
+ *
+ * @param s1 The first string view.
+ * @param s2 The second string view.
+ * @return true if the strings are equal ignoring ASCII case, false otherwise.
+ */
+bool mu_string_eq_nocase(mu_string_t s1, mu_string_t s2);
+
+/**
+ * @brief Compares two string views lexicographically, ignoring ASCII case.
+ *
+ * Behaves as mu_string_cmp() applied to the strings with A-Z mapped to a-z.
+ *
+ * @param s1 The first string view.
+ * @param s2 The second string view.
+ * @return An integer less than, equal to, or greater than zero if s1 is found,
+ * respectively, to be less than, to match, or be greater than s2, ignoring
+ * ASCII case.
+ */
+int mu_string_cmp_nocase(mu_string_t s1, mu_string_t s2);
+
+/**
+ * @brief Returns the length of the longest common prefix of two string views.
+ *
+ * Bytes are compared eight at a time when MU_STRING_SWAR is enabled.
+ *
+ * @param s1 The first string view.
+ * @param s2 The second string view.
+ * @return The number of leading bytes shared by s1 and s2, or 0 if either is
+ * MU_STRING_INVALID.
+ */
+size_t mu_string_common_prefix_len(mu_string_t s1, mu_string_t s2);
+
+/**
+ * @brief Finds the first element of a sorted array that is not less than a
+ * key.
+ *
+ * `sorted` must be in ascending mu_string_cmp() order.  The search keeps
+ * track of how many leading bytes the key shares with the elements bounding
+ * the current range: every element inside the range shares at least the
+ * smaller of the two, so those bytes are not compared again.  Tables of keys
+ * with long common prefixes (URLs, paths, namespaced names) benefit most.
+ *
+ * @param sorted The sorted array of string views.
+ * @param n The number of elements in `sorted`.
+ * @param key The string view to search for.
+ * @return The index of the first element for which mu_string_cmp(element,
+ * key) >= 0, or `n` if there is none.  The key is present if that element
+ * is equal to it.
+ */
+size_t mu_string_lower_bound(const mu_string_t *sorted, size_t n,
+                             mu_string_t key);
+
 /**
  * @brief Finds the first occurrence of a character in a string view.
  *
@@ -313,6 +408,31 @@ mu_string_t mu_string_find_char(mu_string_t s, char c);
  */
 mu_string_t mu_string_rfind_char(mu_string_t s, char c);
 
+/**
+ * @brief Counts the occurrences of a character in a string view.
+ *
+ * @param s The string view to search in.
+ * @param c The character to count.
+ * @return The number of bytes of s equal to c, or 0 if s is invalid.
+ */
+size_t mu_string_count_char(mu_string_t s, char c);
+
+/**
+ * @brief Finds the first character in a string view that is one of a set of
+ * characters.
+ *
+ * Sets of up to four characters are searched eight bytes at a time; larger
+ * sets use a lookup table.
+ *
+ * @param s The string view to search in.
+ * @param set The characters to look for.
+ * @return A mu_string_t view starting from the first character of s that
+ * appears in set to the end of the string, or MU_STRING_EMPTY if there is
+ * none or if s or set is empty. Returns MU_STRING_INVALID if s or set is
+ * invalid.
+ */
+mu_string_t mu_string_find_any(mu_string_t s, mu_string_t set);
+
 /**
  * @brief Finds the first character in a string view that matches a predicate.
  *
@@ -539,6 +659,11 @@ mu_string_t mu_string_split_by_not_pred(mu_string_t s, mu_string_t *after,
  * Copies up to `dst.len` bytes from `src.buf` to `dst.buf`. The number of bytes
  * copied is the minimum of `src.len` and `dst.len`.
  *
+ * `src` and `dst` may overlap, as when compacting data within one buffer.
+ * Copies of MU_STRING_STREAM_THRESHOLD bytes or more bypass the cache.  To
+ * spread a very large copy across threads, split it into sub-views at
+ * multiples of 64 bytes and copy each one from its own thread.
+ *
  * @param dst The mutable string view (destination buffer and capacity). Must
  * have a non-NULL buffer if dst.len > 0.
  * @param src The read-only string view (source data and length). Must be valid.
@@ -556,7 +681,8 @@ mu_string_t mu_string_copy(mu_string_mut_t dst, mu_string_t src);
  * Copies up to `dst_segment.len` bytes from `src.buf` to `dst_segment.buf`. The
  * number of bytes copied is the minimum of `src.len` and `dst_segment.len`.
  * This function is designed to be used in a cursor-style pattern for building
- * strings in a fixed-size buffer.
+ * strings in a fixed-size buffer.  As with mu_string_copy(), `src` may
+ * overlap the destination.
  *
  * @param dst_segment The mutable string view representing the current available
  * space in the destination buffer (buffer pointer and remaining capacity). Must
@@ -571,6 +697,198 @@ mu_string_t mu_string_copy(mu_string_mut_t dst, mu_string_t src);
  */
 mu_string_mut_t mu_string_append(mu_string_mut_t dst_segment, mu_string_t src);
 
+/**
+ * @brief Copies a string view, leaving out every byte that appears in a set.
+ *
+ * Runs of bytes not in the set are moved as blocks; locating the next byte
+ * from the set takes eight bytes per step for sets of up to four bytes, or
+ * sets whose members are all ASCII (such as the control characters).
+ *
+ * @param dst The destination buffer and its capacity.  May start at
+ * `src.buf` to filter in place; see also mu_string_mut_remove_set().
+ * @param src The string view to filter.
+ * @param set The bytes to remove.
+ * @return A view of the result in `dst`, or MU_STRING_INVALID if an argument
+ * is invalid or the result does not fit in `dst`.  On failure the contents
+ * of `dst` are unspecified.
+ */
+mu_string_t mu_string_remove_set(mu_string_mut_t dst, mu_string_t src,
+                                 mu_string_t set);
+
+/**
+ * @brief Copies a string view, replacing each run of a repeated byte from a
+ * set with a single copy of that byte, as `tr -s` does.
+ *
+ * For example, squeezing "/" turns "a//b///c" into "a/b/c".  Runs of
+ * different bytes from the set are not merged: squeezing " -" leaves " - "
+ * unchanged.
+ *
+ * @param dst The destination buffer and its capacity.  May start at
+ * `src.buf` to filter in place; see also mu_string_mut_squeeze().
+ * @param src The string view to filter.
+ * @param set The bytes whose runs are squeezed.
+ * @return A view of the result in `dst`, or MU_STRING_INVALID as for
+ * mu_string_remove_set().
+ */
+mu_string_t mu_string_squeeze(mu_string_mut_t dst, mu_string_t src,
+                              mu_string_t set);
+
+/**
+ * @brief Copies a string view, replacing each run of white space with a
+ * single space.
+ *
+ * White space is space, tab, LF, VT, FF and CR.  Leading and trailing runs
+ * become a single space too: trim with mu_string_trim() to drop them.
+ *
+ * @param dst The destination buffer and its capacity.  May start at
+ * `src.buf` to filter in place; see also mu_string_mut_collapse_space().
+ * @param src The string view to filter.
+ * @return A view of the result in `dst`, or MU_STRING_INVALID as for
+ * mu_string_remove_set().
+ */
+mu_string_t mu_string_collapse_space(mu_string_mut_t dst, mu_string_t src);
+
+/**
+ * @brief Removes every byte that appears in a set from the contents of a
+ * mutable buffer, in place.
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param set The bytes to remove.
+ * @return A view of the remaining contents, or MU_STRING_INVALID if an
+ * argument is invalid.
+ */
+mu_string_t mu_string_mut_remove_set(mu_string_mut_t dst, size_t used,
+                                     mu_string_t set);
+
+/**
+ * @brief Squeezes runs of repeated bytes from a set, as mu_string_squeeze(),
+ * in the contents of a mutable buffer, in place.
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param set The bytes whose runs are squeezed.
+ * @return A view of the remaining contents, or MU_STRING_INVALID if an
+ * argument is invalid.
+ */
+mu_string_t mu_string_mut_squeeze(mu_string_mut_t dst, size_t used,
+                                  mu_string_t set);
+
+/**
+ * @brief Replaces each run of white space in the contents of a mutable
+ * buffer with a single space, as mu_string_collapse_space(), in place.
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @return A view of the remaining contents, or MU_STRING_INVALID if an
+ * argument is invalid.
+ */
+mu_string_t mu_string_mut_collapse_space(mu_string_mut_t dst, size_t used);
+
+/**
+ * @brief Copies a string view, mapping each byte through a table, as `tr`
+ * does.
+ *
+ * Byte `c` of `src` becomes `table[c]`.  Tables that leave every byte from
+ * 0x80 up unchanged and change at most two runs of ASCII bytes, each either
+ * shifted by a constant (case conversion) or set to a constant (masking
+ * digits), are applied eight bytes per step.  Other tables use an unrolled
+ * lookup loop.
+ *
+ * @param dst The destination buffer and its capacity.  May start at
+ * `src.buf` to translate in place; see also mu_string_mut_translate().
+ * @param src The string view to translate.
+ * @param table The byte mapping.
+ * @return A view of the result in `dst`, or MU_STRING_INVALID if an argument
+ * is invalid or `dst` is shorter than `src`.
+ */
+mu_string_t mu_string_translate(mu_string_mut_t dst, mu_string_t src,
+                                const uint8_t table[256]);
+
+/**
+ * @brief Maps each byte of the contents of a mutable buffer through a table,
+ * in place.
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param table The byte mapping, as for mu_string_translate().
+ * @return A view of the contents, or MU_STRING_INVALID if an argument is
+ * invalid.
+ */
+mu_string_t mu_string_mut_translate(mu_string_mut_t dst, size_t used,
+                                    const uint8_t table[256]);
+
+/**
+ * @brief Replaces a range of the contents of a mutable buffer with new bytes.
+ *
+ * The buffer holds `used` bytes of content in a capacity of `dst.len`.  The
+ * bytes after the replaced range are moved once, with a single memmove(),
+ * and `src` is copied into the gap.
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param pos The offset of the first byte to replace; at most `used`.
+ * @param count The number of bytes to replace.  Clamped to `used - pos`.
+ * @param src The replacement bytes.  Must not overlap `dst`.
+ * @return A view of the whole contents after the edit, or MU_STRING_INVALID
+ * if an argument is invalid or the result would not fit in `dst`.  On
+ * failure the buffer is unchanged.
+ */
+mu_string_t mu_string_mut_splice(mu_string_mut_t dst, size_t used, size_t pos,
+                                 size_t count, mu_string_t src);
+
+/**
+ * @brief Inserts bytes into the contents of a mutable buffer.
+ *
+ * Equivalent to mu_string_mut_splice(dst, used, pos, 0, src).
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param pos The offset at which to insert; at most `used`.
+ * @param src The bytes to insert.  Must not overlap `dst`.
+ * @return A view of the whole contents after the edit, or MU_STRING_INVALID.
+ */
+mu_string_t mu_string_mut_insert(mu_string_mut_t dst, size_t used, size_t pos,
+                                 mu_string_t src);
+
+/**
+ * @brief Removes bytes from the contents of a mutable buffer.
+ *
+ * Equivalent to mu_string_mut_splice(dst, used, pos, count, MU_STRING_EMPTY).
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param pos The offset of the first byte to remove; at most `used`.
+ * @param count The number of bytes to remove.  Clamped to `used - pos`.
+ * @return A view of the whole contents after the edit, or MU_STRING_INVALID.
+ */
+mu_string_t mu_string_mut_erase(mu_string_mut_t dst, size_t used, size_t pos,
+                                size_t count);
+
+/**
+ * @brief Applies a sorted list of edits to the contents of a mutable buffer.
+ *
+ * The edits must be sorted by `pos` and must not overlap: each must end at
+ * or before the position of the next.  Each byte of content is moved at most
+ * once however many edits there are, where applying them one at a time with
+ * mu_string_mut_splice() would move the tail once per edit.  This takes three
+ * passes over the edit list rather than one: content shifting left is moved
+ * front to back, content shifting right is moved back to front, and then the
+ * replacement text is written.
+ *
+ * @param dst The buffer and its capacity.
+ * @param used The number of bytes of content in `dst`.
+ * @param edits The edits, sorted by position.  Their text must not overlap
+ * `dst`.
+ * @param n_edits The number of elements in `edits`.
+ * @return A view of the whole contents after the edits, or MU_STRING_INVALID
+ * if an argument is invalid, the edits are out of order or out of range, or
+ * the result would not fit in `dst`.  On failure the buffer is unchanged.
+ */
+mu_string_t mu_string_mut_apply_edits(mu_string_mut_t dst, size_t used,
+                                      const mu_string_edit_t *edits,
+                                      size_t n_edits);
+
 // *****************************************************************************
 // End of file
 
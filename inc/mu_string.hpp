@@ -0,0 +1,523 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string.hpp
+ *
+ * @brief A header-only C++17 wrapper for `mu_string_t`.
+ *
+ * `mu::string_view` has the same layout as `mu_string_t` and converts to and
+ * from it, and to and from `std::string_view`, without copying.  Every member
+ * function is defined inline in this header, so the compiler can inline
+ * through calls that would otherwise cross the C ABI.  Predicates are
+ * template parameters rather than `mu_string_pred_t` function pointers, so a
+ * lambda is inlined as well.
+ *
+ * The C sentinels are not carried into C++.  A `mu::string_view` is always
+ * valid (possibly empty).  Searches return an index or `npos`, and operations
+ * that can fail return `std::optional`.  Use mu::checked() to bring a
+ * `mu_string_t` of unknown validity across.
+ *
+ * Like the C functions, nothing here allocates or throws.
+ */
+
+#ifndef MU_STRING_HPP
+#define MU_STRING_HPP
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace mu {
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief A read-only, non-owning view of a run of characters.
+ */
+class string_view {
+    template <typename S>
+    using if_std_view = std::enable_if_t<std::is_same_v<S, std::string_view>, bool>;
+
+  public:
+    using value_type = char;
+    using size_type = std::size_t;
+    using const_iterator = const char *;
+    using iterator = const_iterator;
+
+    /**
+     * @brief Returned by the find functions when there is no match.
+     */
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    /**
+     * @brief Constructs an empty view.
+     */
+    constexpr string_view() noexcept : buf_(""), len_(0) {}
+
+    /**
+     * @brief Constructs a view of `len` bytes at `buf`.  `buf` may be null
+     * only if `len` is 0.
+     */
+    constexpr string_view(const char *buf, size_type len) noexcept
+        : buf_(buf ? buf : ""), len_(buf ? len : 0) {}
+
+    /**
+     * @brief Constructs a view of a null-terminated string.
+     */
+    constexpr string_view(const char *cstr) noexcept
+        : string_view(cstr, cstr ? std::char_traits<char>::length(cstr) : 0) {}
+
+    /**
+     * @brief Views the same characters as a `std::string_view`.
+     */
+    constexpr string_view(std::string_view s) noexcept
+        : string_view(s.data(), s.size()) {}
+
+    /**
+     * @brief Views the same characters as a `std::string`.
+     */
+    string_view(const std::string &s) noexcept
+        : buf_(s.data()), len_(s.size()) {}
+
+    /**
+     * @brief Views the same characters as a `mu_string_t`, which must be
+     * valid.  An invalid view becomes empty: see mu::checked().
+     */
+    constexpr string_view(mu_string_t s) noexcept
+        : string_view(s.buf, s.buf ? s.len : 0) {}
+
+    constexpr operator std::string_view() const noexcept {
+        return std::string_view(buf_, len_);
+    }
+
+    constexpr operator mu_string_t() const noexcept {
+        return mu_string_t{ buf_, len_ };
+    }
+
+    /**
+     * @brief Returns the view as a `mu_string_t`, for passing to C functions
+     * whose overloads would make the implicit conversion ambiguous.
+     */
+    constexpr mu_string_t c() const noexcept { return mu_string_t{ buf_, len_ }; }
+
+    // Access
+
+    constexpr const char *data() const noexcept { return buf_; }
+    constexpr size_type size() const noexcept { return len_; }
+    constexpr size_type length() const noexcept { return len_; }
+    constexpr bool empty() const noexcept { return len_ == 0; }
+    constexpr const_iterator begin() const noexcept { return buf_; }
+    constexpr const_iterator end() const noexcept { return buf_ + len_; }
+
+    /**
+     * @brief Returns character `i`, which must be less than size().
+     */
+    constexpr char operator[](size_type i) const noexcept { return buf_[i]; }
+    constexpr char front() const noexcept { return buf_[0]; }
+    constexpr char back() const noexcept { return buf_[len_ - 1]; }
+
+    // Comparison
+
+    /**
+     * @brief Compares bytewise, as mu_string_cmp(): negative, zero or
+     * positive as this view sorts before, equal to or after `other`.
+     */
+    constexpr int compare(string_view other) const noexcept {
+        size_type n = len_ < other.len_ ? len_ : other.len_;
+        int r = std::char_traits<char>::compare(buf_, other.buf_, n);
+        if (r != 0) {
+            return r;
+        }
+        return len_ < other.len_ ? -1 : (len_ > other.len_ ? 1 : 0);
+    }
+
+    constexpr bool starts_with(string_view prefix) const noexcept {
+        return prefix.len_ <= len_ &&
+               std::char_traits<char>::compare(buf_, prefix.buf_, prefix.len_) == 0;
+    }
+
+    constexpr bool starts_with(char c) const noexcept {
+        return len_ > 0 && buf_[0] == c;
+    }
+
+    constexpr bool ends_with(string_view suffix) const noexcept {
+        return suffix.len_ <= len_ &&
+               std::char_traits<char>::compare(buf_ + len_ - suffix.len_,
+                                               suffix.buf_, suffix.len_) == 0;
+    }
+
+    constexpr bool ends_with(char c) const noexcept {
+        return len_ > 0 && buf_[len_ - 1] == c;
+    }
+
+    // Searching
+
+    /**
+     * @brief Returns the index of the first `c` at or after `pos`, or npos.
+     */
+    constexpr size_type find(char c, size_type pos = 0) const noexcept {
+        if (pos >= len_) {
+            return npos;
+        }
+        const char *p = std::char_traits<char>::find(buf_ + pos, len_ - pos, c);
+        return p ? static_cast<size_type>(p - buf_) : npos;
+    }
+
+    /**
+     * @brief Returns the index of the first occurrence of `needle` at or after
+     * `pos`, or npos.  An empty needle is found at `pos`.
+     */
+    constexpr size_type find(string_view needle, size_type pos = 0) const noexcept {
+        return std::string_view(*this).find(std::string_view(needle), pos);
+    }
+
+    /**
+     * @brief Returns the index of the last `c` at or before `pos`, or npos.
+     */
+    constexpr size_type rfind(char c, size_type pos = npos) const noexcept {
+        return std::string_view(*this).rfind(c, pos);
+    }
+
+    /**
+     * @brief Returns the index of the last occurrence of `needle` starting at
+     * or before `pos`, or npos.
+     */
+    constexpr size_type rfind(string_view needle,
+                              size_type pos = npos) const noexcept {
+        return std::string_view(*this).rfind(std::string_view(needle), pos);
+    }
+
+    /**
+     * @brief Returns the index of the first character at or after `pos` for
+     * which `pred(c)` is true, or npos.
+     */
+    template <typename Pred>
+    constexpr size_type find_if(Pred pred, size_type pos = 0) const {
+        for (size_type i = pos; i < len_; i++) {
+            if (pred(buf_[i])) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Returns the index of the first character at or after `pos` for
+     * which `pred(c)` is false, or npos.
+     */
+    template <typename Pred>
+    constexpr size_type find_if_not(Pred pred, size_type pos = 0) const {
+        for (size_type i = pos; i < len_; i++) {
+            if (!pred(buf_[i])) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Returns the index of the last character for which `pred(c)` is
+     * true, or npos.
+     */
+    template <typename Pred> constexpr size_type rfind_if(Pred pred) const {
+        for (size_type i = len_; i > 0; i--) {
+            if (pred(buf_[i - 1])) {
+                return i - 1;
+            }
+        }
+        return npos;
+    }
+
+    constexpr bool contains(char c) const noexcept { return find(c) != npos; }
+
+    constexpr bool contains(string_view needle) const noexcept {
+        return find(needle) != npos;
+    }
+
+    // Slicing
+
+    /**
+     * @brief Returns up to `n` characters starting at `pos`.  Unlike
+     * `std::string_view::substr()`, `pos` is clamped rather than checked.
+     */
+    constexpr string_view substr(size_type pos, size_type n = npos) const noexcept {
+        if (pos > len_) {
+            pos = len_;
+        }
+        if (n > len_ - pos) {
+            n = len_ - pos;
+        }
+        return string_view(buf_ + pos, n);
+    }
+
+    /**
+     * @brief Returns the characters in [start, end), as mu_string_slice():
+     * negative indices count from the end and both are clamped.
+     */
+    constexpr string_view slice(long start, long end = MU_STRING_END) const noexcept {
+        size_type from = clamp_index(start);
+        size_type to = clamp_index(end);
+        return from < to ? string_view(buf_ + from, to - from) : string_view();
+    }
+
+    constexpr void remove_prefix(size_type n) noexcept {
+        n = n < len_ ? n : len_;
+        buf_ += n;
+        len_ -= n;
+    }
+
+    constexpr void remove_suffix(size_type n) noexcept {
+        len_ -= n < len_ ? n : len_;
+    }
+
+    /**
+     * @brief Returns the view without the leading characters for which
+     * `pred(c)` is true.
+     */
+    template <typename Pred> constexpr string_view ltrim(Pred pred) const {
+        size_type i = find_if_not(pred);
+        return i == npos ? string_view(buf_ + len_, 0) : substr(i);
+    }
+
+    /**
+     * @brief Returns the view without the trailing characters for which
+     * `pred(c)` is true.
+     */
+    template <typename Pred> constexpr string_view rtrim(Pred pred) const {
+        size_type n = len_;
+        while (n > 0 && pred(buf_[n - 1])) {
+            n--;
+        }
+        return string_view(buf_, n);
+    }
+
+    /**
+     * @brief Returns the view without the leading and trailing characters for
+     * which `pred(c)` is true.
+     */
+    template <typename Pred> constexpr string_view trim(Pred pred) const {
+        return ltrim(pred).rtrim(pred);
+    }
+
+    // Splitting
+
+    /**
+     * @brief Splits at the first `delimiter`, as mu_string_split_at_char().
+     *
+     * @return The characters before the delimiter, and the rest of the view
+     * starting with the delimiter.  If there is no delimiter, the whole view
+     * and std::nullopt.
+     */
+    constexpr std::pair<string_view, std::optional<string_view>>
+    split_at(char delimiter) const noexcept {
+        size_type i = find(delimiter);
+        if (i == npos) {
+            return { *this, std::nullopt };
+        }
+        return { string_view(buf_, i), string_view(buf_ + i, len_ - i) };
+    }
+
+    /**
+     * @brief Splits at the first character for which `pred(c)` is true, as
+     * mu_string_split_by_pred().
+     *
+     * @return The characters before the split point, and the rest of the view
+     * starting with the matching character.  If there is none, the whole view
+     * and std::nullopt.
+     */
+    template <typename Pred>
+    constexpr std::pair<string_view, std::optional<string_view>>
+    split_if(Pred pred) const {
+        size_type i = find_if(pred);
+        if (i == npos) {
+            return { *this, std::nullopt };
+        }
+        return { string_view(buf_, i), string_view(buf_ + i, len_ - i) };
+    }
+
+    // Copying
+
+    /**
+     * @brief Copies as much of the view as fits into `dst`, as
+     * mu_string_copy().  The view may overlap `dst`.
+     *
+     * @return A view of the bytes written.
+     */
+    string_view copy_to(mu_string_mut_t dst) const noexcept {
+        mu_string_t out = mu_string_copy(dst, c());
+        return mu_string_is_valid(out) ? string_view(out.buf, out.len)
+                                       : string_view();
+    }
+
+    /**
+     * @brief Appends as much of the view as fits to the segment `dst`, as
+     * mu_string_append().  The view may overlap `dst`.
+     *
+     * @return The space remaining in `dst` after the appended bytes.
+     */
+    mu_string_mut_t append_to(mu_string_mut_t dst) const noexcept {
+        return mu_string_append(dst, c());
+    }
+
+    friend constexpr bool operator==(string_view a, string_view b) noexcept {
+        return a.len_ == b.len_ &&
+               std::char_traits<char>::compare(a.buf_, b.buf_, a.len_) == 0;
+    }
+    friend constexpr bool operator!=(string_view a, string_view b) noexcept {
+        return !(a == b);
+    }
+    friend constexpr bool operator<(string_view a, string_view b) noexcept {
+        return a.compare(b) < 0;
+    }
+    friend constexpr bool operator<=(string_view a, string_view b) noexcept {
+        return a.compare(b) <= 0;
+    }
+    friend constexpr bool operator>(string_view a, string_view b) noexcept {
+        return a.compare(b) > 0;
+    }
+    friend constexpr bool operator>=(string_view a, string_view b) noexcept {
+        return a.compare(b) >= 0;
+    }
+
+    // Mixed comparisons with std::string_view would otherwise be ambiguous,
+    // since each side converts to the other.  These only match an exact
+    // std::string_view, so other types still convert to mu::string_view.
+
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator==(string_view a, S b) noexcept {
+        return a == string_view(b);
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator==(S a, string_view b) noexcept {
+        return string_view(a) == b;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator!=(string_view a, S b) noexcept {
+        return !(a == string_view(b));
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator!=(S a, string_view b) noexcept {
+        return !(string_view(a) == b);
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator<(string_view a, S b) noexcept {
+        return a.compare(b) < 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator<(S a, string_view b) noexcept {
+        return string_view(a).compare(b) < 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator<=(string_view a, S b) noexcept {
+        return a.compare(b) <= 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator<=(S a, string_view b) noexcept {
+        return string_view(a).compare(b) <= 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator>(string_view a, S b) noexcept {
+        return a.compare(b) > 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator>(S a, string_view b) noexcept {
+        return string_view(a).compare(b) > 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator>=(string_view a, S b) noexcept {
+        return a.compare(b) >= 0;
+    }
+    template <typename S, if_std_view<S> = true>
+    friend constexpr bool operator>=(S a, string_view b) noexcept {
+        return string_view(a).compare(b) >= 0;
+    }
+
+  private:
+    constexpr size_type clamp_index(long i) const noexcept {
+        if (i < 0) {
+            size_type back = static_cast<size_type>(-(i + 1)) + 1;
+            return back < len_ ? len_ - back : 0;
+        }
+        size_type u = static_cast<size_type>(i);
+        return u < len_ ? u : len_;
+    }
+
+    const char *buf_;
+    size_type len_;
+};
+
+/**
+ * @brief Converts a `mu_string_t` returned by a C function, mapping
+ * MU_STRING_INVALID and MU_STRING_NOT_FOUND to std::nullopt.
+ *
+ * The core search functions report a miss as MU_STRING_EMPTY, which this
+ * maps to an empty view: prefer the member find functions in C++.
+ */
+constexpr std::optional<string_view> checked(mu_string_t s) noexcept {
+    if (s.buf == nullptr) {
+        return std::nullopt;
+    }
+    return string_view(s.buf, s.len);
+}
+
+namespace literals {
+
+/**
+ * @brief Makes a mu::string_view from a literal: `"abc"_mu`.
+ */
+constexpr string_view operator""_mu(const char *s, std::size_t n) noexcept {
+    return string_view(s, n);
+}
+
+} // namespace literals
+
+} // namespace mu
+
+namespace std {
+
+/**
+ * @brief Hashes a mu::string_view as the equivalent `std::string_view`.
+ */
+template <> struct hash<mu::string_view> {
+    size_t operator()(mu::string_view s) const noexcept {
+        return hash<string_view>()(string_view(s));
+    }
+};
+
+} // namespace std
+
+// *****************************************************************************
+// End of file
+
+#endif // MU_STRING_HPP
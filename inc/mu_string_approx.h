@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_approx.h
+ *
+ * @brief Edit distance and approximate substring search on string views.
+ *
+ * Both functions use Myers' bit-vector algorithm ("A fast bit-vector
+ * algorithm for approximate string matching based on dynamic programming",
+ * 1999), which computes 64 cells of the Levenshtein matrix per machine word
+ * operation.  The run time is O(n * ceil(m / 64)), where m is the length of
+ * the shorter string or needle.  Strings of up to 64 bytes use a single word;
+ * longer ones use the blocked form of the algorithm, up to
+ * MU_STRING_APPROX_MAX_LEN bytes.
+ *
+ * No memory is allocated.  The match tables live on the stack and grow with
+ * MU_STRING_APPROX_MAX_LEN, which defaults to 256 (about 8 KB of stack).
+ * To change it, define it for the whole build (e.g.
+ * `-DMU_STRING_APPROX_MAX_LEN=512`): mu_string_approx.c must be compiled
+ * with the same value, so defining it only in code that includes this header
+ * has no effect on the limit.
+ */
+
+#ifndef MU_STRING_APPROX_H
+#define MU_STRING_APPROX_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Maximum length of the shorter string passed to
+ * mu_string_edit_distance(), and of the needle passed to
+ * mu_string_find_approx().
+ */
+#ifndef MU_STRING_APPROX_MAX_LEN
+#define MU_STRING_APPROX_MAX_LEN 256
+#endif
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Computes the Levenshtein distance between two strings.
+ *
+ * Insertions, deletions and substitutions of single bytes each cost 1.
+ * The computation stops early once the distance is known to exceed
+ * `max_dist`, so a small bound makes rejecting dissimilar strings cheap.
+ * Pass SIZE_MAX for an exact result.
+ *
+ * @param a The first string.
+ * @param b The second string.
+ * @param max_dist The largest distance of interest.
+ * @return The distance, or SIZE_MAX if it exceeds `max_dist`, an argument is
+ * invalid, or both strings are longer than MU_STRING_APPROX_MAX_LEN.
+ */
+size_t mu_string_edit_distance(mu_string_t a, mu_string_t b, size_t max_dist);
+
+/**
+ * @brief Finds the first substring of `haystack` within edit distance
+ * `max_dist` of `needle`.
+ *
+ * The search stops at the first position where some substring ending there
+ * is close enough.  It then keeps going for as long as the distance still
+ * improves, so "hello" is found in full rather than stopping at "hell".
+ * The start of the match is chosen to give the smallest distance.
+ *
+ * Unlike mu_string_find_str(), the returned view covers only the match.
+ *
+ * @param haystack The string to search.
+ * @param needle The string to look for.  At most MU_STRING_APPROX_MAX_LEN
+ * bytes.
+ * @param max_dist The largest number of edits allowed.
+ * @return A view of the matching substring of `haystack`,
+ * MU_STRING_NOT_FOUND if there is none, or MU_STRING_INVALID if an argument
+ * is invalid or `needle` is too long.
+ */
+mu_string_t mu_string_find_approx(mu_string_t haystack, mu_string_t needle,
+                                  size_t max_dist);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_APPROX_H
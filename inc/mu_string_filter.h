@@ -0,0 +1,308 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_filter.h
+ *
+ * @brief Approximate membership filters over string views: a blocked Bloom
+ * filter and a cuckoo filter, both in caller-provided memory.
+ *
+ * Either filter answers "definitely not present" or "possibly present".  Use
+ * one in front of an expensive lookup (a disk read, a hash table probe on a
+ * cold table) so that most misses never reach it.
+ *
+ * The Bloom filter sets all of a key's bits within one 64-byte block, so a
+ * query touches a single cache line.  It cannot forget a key.  The cuckoo
+ * filter stores a 16-bit fingerprint of each key in one of two 4-slot
+ * buckets.  It supports removal and has a lower false positive rate than a
+ * Bloom filter of the same size, but an insertion can fail once it is about
+ * 95% full.
+ *
+ * The batch functions hash a group of keys and prefetch their blocks or
+ * buckets before touching any of them, so the cache misses overlap instead
+ * of being taken one at a time.
+ */
+
+#ifndef MU_STRING_FILTER_H
+#define MU_STRING_FILTER_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Number of 64-bit words in one Bloom filter block (one cache line).
+ */
+#define MU_STRING_BLOOM_BLOCK_WORDS 8
+
+/**
+ * @brief Number of words of storage for a Bloom filter holding `n_keys` keys
+ * at `bits_per_key` bits each, rounded up to whole blocks.
+ *
+ * 10 bits per key with k = 7 gives a false positive rate of about 1%.
+ */
+#define MU_STRING_BLOOM_WORDS(n_keys, bits_per_key)                            \
+    ((((size_t)(n_keys) * (bits_per_key) + 511) / 512) *                       \
+     MU_STRING_BLOOM_BLOCK_WORDS)
+
+/**
+ * @brief Number of fingerprint slots in one cuckoo filter bucket.
+ */
+#define MU_STRING_CUCKOO_BUCKET_SLOTS 4
+
+#ifndef MU_STRING_CUCKOO_MAX_KICKS
+/**
+ * @brief Number of fingerprints an insertion may displace before the cuckoo
+ * filter is considered full.
+ */
+#define MU_STRING_CUCKOO_MAX_KICKS 500
+#endif
+
+/**
+ * @brief A blocked Bloom filter.
+ *
+ * Treat as opaque: initialize with mu_string_bloom_init().
+ */
+typedef struct {
+    uint64_t *words; ///< Caller-provided storage.
+    size_t n_blocks; ///< Number of 64-byte blocks in `words`.
+    unsigned k;      ///< Bits set per key.
+} mu_string_bloom_t;
+
+/**
+ * @brief A cuckoo filter.
+ *
+ * Treat as opaque: initialize with mu_string_cuckoo_init().
+ */
+typedef struct {
+    uint16_t *slots;      ///< Caller-provided storage; 0 marks an empty slot.
+    size_t n_buckets;     ///< Number of buckets, a power of two.
+    size_t count;         ///< Number of fingerprints stored.
+    uint32_t rng;         ///< State for choosing which fingerprint to evict.
+    uint16_t victim_fp;   ///< Fingerprint left over by a failed eviction.
+    size_t victim_bucket; ///< One of the victim's two buckets.
+    bool has_victim;      ///< True once the filter is full.
+} mu_string_cuckoo_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Computes a 64-bit hash of a view's contents.
+ *
+ * The hash reads eight bytes per step and depends only on the bytes of `s`
+ * and `seed`, not on the alignment of `s.buf` or the host byte order.  It is
+ * fast and well mixed, but not designed to resist deliberately colliding
+ * input.
+ *
+ * @param s The view to hash.
+ * @param seed Selects one of a family of independent hash functions.
+ * @return The hash, or 0 if `s` is invalid.
+ */
+uint64_t mu_string_hash64(mu_string_t s, uint64_t seed);
+
+/**
+ * @brief Initializes a Bloom filter in caller-provided storage and clears it.
+ *
+ * For a single cache line per query, align `words` to 64 bytes.
+ *
+ * @param bloom The filter to initialize.
+ * @param words Storage for the filter's bits.
+ * @param n_words The number of elements in `words`: a non-zero multiple of
+ * MU_STRING_BLOOM_BLOCK_WORDS.  See MU_STRING_BLOOM_WORDS().
+ * @param k The number of bits to set per key, 1 to 16.
+ * @return `bloom`, or NULL if an argument is invalid.
+ */
+mu_string_bloom_t *mu_string_bloom_init(mu_string_bloom_t *bloom,
+                                        uint64_t *words, size_t n_words,
+                                        unsigned k);
+
+/**
+ * @brief Removes all keys from a Bloom filter.
+ *
+ * @param bloom An initialized filter.
+ */
+void mu_string_bloom_clear(mu_string_bloom_t *bloom);
+
+/**
+ * @brief Adds a key to a Bloom filter.
+ *
+ * @param bloom An initialized filter.
+ * @param key The key to add.
+ * @return true on success, false if an argument is invalid.
+ */
+bool mu_string_bloom_add(mu_string_bloom_t *bloom, mu_string_t key);
+
+/**
+ * @brief Tests whether a Bloom filter may contain a key.
+ *
+ * @param bloom An initialized filter.
+ * @param key The key to look for.
+ * @return false if `key` was definitely never added (or an argument is
+ * invalid), true if it possibly was.
+ */
+bool mu_string_bloom_may_contain(const mu_string_bloom_t *bloom,
+                                 mu_string_t key);
+
+/**
+ * @brief Adds an array of keys to a Bloom filter, prefetching ahead.
+ *
+ * @param bloom An initialized filter.
+ * @param keys The keys to add.  Invalid views are skipped.
+ * @param n_keys The number of elements in `keys`.
+ * @return The number of keys added.
+ */
+size_t mu_string_bloom_add_batch(mu_string_bloom_t *bloom,
+                                 const mu_string_t *keys, size_t n_keys);
+
+/**
+ * @brief Tests an array of keys against a Bloom filter, prefetching ahead.
+ *
+ * @param bloom An initialized filter.
+ * @param keys The keys to look for.
+ * @param n_keys The number of elements in `keys`.
+ * @param results Receives mu_string_bloom_may_contain() of each key.
+ * @return The number of keys that may be present.
+ */
+size_t mu_string_bloom_query_batch(const mu_string_bloom_t *bloom,
+                                   const mu_string_t *keys, size_t n_keys,
+                                   bool *results);
+
+/**
+ * @brief Initializes a cuckoo filter in caller-provided storage and clears
+ * it.
+ *
+ * The filter holds up to about 95% of `n_slots` keys.  The false positive
+ * rate is about 0.012% when full, and proportionally lower before that.
+ *
+ * @param cuckoo The filter to initialize.
+ * @param slots Storage for the filter's fingerprints.
+ * @param n_slots The number of elements in `slots`: MU_STRING_CUCKOO_BUCKET_SLOTS
+ * times a power of two.
+ * @return `cuckoo`, or NULL if an argument is invalid.
+ */
+mu_string_cuckoo_t *mu_string_cuckoo_init(mu_string_cuckoo_t *cuckoo,
+                                          uint16_t *slots, size_t n_slots);
+
+/**
+ * @brief Removes all keys from a cuckoo filter.
+ *
+ * @param cuckoo An initialized filter.
+ */
+void mu_string_cuckoo_clear(mu_string_cuckoo_t *cuckoo);
+
+/**
+ * @brief Adds a key to a cuckoo filter.
+ *
+ * A key may be added more than once, and each copy must be removed
+ * separately.  Its two buckets hold at most eight copies: adding a ninth
+ * fills the filter.
+ *
+ * @param cuckoo An initialized filter.
+ * @param key The key to add.
+ * @return true on success, false if the filter is full or an argument is
+ * invalid.
+ */
+bool mu_string_cuckoo_add(mu_string_cuckoo_t *cuckoo, mu_string_t key);
+
+/**
+ * @brief Tests whether a cuckoo filter may contain a key.
+ *
+ * @param cuckoo An initialized filter.
+ * @param key The key to look for.
+ * @return false if `key` is definitely not present (or an argument is
+ * invalid), true if it possibly is.
+ */
+bool mu_string_cuckoo_may_contain(const mu_string_cuckoo_t *cuckoo,
+                                  mu_string_t key);
+
+/**
+ * @brief Removes one copy of a key from a cuckoo filter.
+ *
+ * Only remove keys that were added: removing any other key may remove the
+ * fingerprint of a different key that happens to share it, after which that
+ * key would be reported as absent.
+ *
+ * @param cuckoo An initialized filter.
+ * @param key The key to remove.
+ * @return true if a matching fingerprint was removed.
+ */
+bool mu_string_cuckoo_remove(mu_string_cuckoo_t *cuckoo, mu_string_t key);
+
+/**
+ * @brief Returns the number of keys in a cuckoo filter.
+ *
+ * @param cuckoo An initialized filter.
+ * @return The number of keys added and not removed.
+ */
+size_t mu_string_cuckoo_count(const mu_string_cuckoo_t *cuckoo);
+
+/**
+ * @brief Adds an array of keys to a cuckoo filter, prefetching ahead.
+ *
+ * Stops at the first key that cannot be added.
+ *
+ * @param cuckoo An initialized filter.
+ * @param keys The keys to add.
+ * @param n_keys The number of elements in `keys`.
+ * @return The number of keys added: `keys[0 .. return - 1]`.
+ */
+size_t mu_string_cuckoo_add_batch(mu_string_cuckoo_t *cuckoo,
+                                  const mu_string_t *keys, size_t n_keys);
+
+/**
+ * @brief Tests an array of keys against a cuckoo filter, prefetching ahead.
+ *
+ * @param cuckoo An initialized filter.
+ * @param keys The keys to look for.
+ * @param n_keys The number of elements in `keys`.
+ * @param results Receives mu_string_cuckoo_may_contain() of each key.
+ * @return The number of keys that may be present.
+ */
+size_t mu_string_cuckoo_query_batch(const mu_string_cuckoo_t *cuckoo,
+                                    const mu_string_t *keys, size_t n_keys,
+                                    bool *results);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_FILTER_H
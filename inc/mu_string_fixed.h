@@ -0,0 +1,254 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_fixed.h
+ *
+ * @brief Substring search specialized for needles known at compile time.
+ *
+ *     mu_string_t end = MU_STRING_FIND_FIXED(request, "\r\n\r\n");
+ *
+ * MU_STRING_FIND_FIXED() takes a string literal of at most 16 bytes and gives
+ * the same result as mu_string_find_str().  The search code is `static inline`
+ * in this header so that, with optimization on, the compiler folds the
+ * needle's length and bytes into constants and drops the branches for other
+ * lengths.  No setup is done at run time.
+ *
+ * The search tests eight candidate positions per step.  Each step loads the
+ * haystack at those positions and at each position plus `len - 1`, then
+ * compares both words against the needle's first and last bytes broadcast
+ * into every byte lane.  Only positions where both bytes match are checked in
+ * full, with one or two word-sized compares.  All loads stay within the
+ * haystack.
+ *
+ * In C++, see mu::fixed_searcher in mu_string_fixed.hpp.
+ */
+
+#ifndef MU_STRING_FIXED_H
+#define MU_STRING_FIXED_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Longest needle a fixed searcher accepts.
+ */
+#define MU_STRING_FIXED_MAX_LEN 16
+
+/**
+ * @brief A needle prepared for mu_string_find_fixed().
+ *
+ * Treat as opaque: make with mu_string_fixed_make().
+ */
+typedef struct {
+    uint64_t first; ///< First byte of the needle in every byte lane.
+    uint64_t last;  ///< Last byte of the needle in every byte lane.
+    uint64_t head;  ///< Leading word of the needle (1, 2, 4 or 8 bytes).
+    uint64_t tail;  ///< Trailing word of the needle, the same width.
+    size_t len;     ///< Needle length.
+} mu_string_fixed_t;
+
+/**
+ * @brief Searches `haystack` for a string literal of at most
+ * MU_STRING_FIXED_MAX_LEN bytes.  A longer literal, or anything that is not a
+ * string literal (such as a `const char *` or a `char` array), fails to
+ * compile.
+ *
+ * @return As mu_string_find_str().
+ */
+#define MU_STRING_FIND_FIXED(haystack, literal)                                \
+    mu_string_find_fixed(                                                      \
+        (haystack),                                                            \
+        mu_string_fixed_make(                                                  \
+            "" literal "",                                                     \
+            sizeof("" literal "") - 1 +                                        \
+                0 * sizeof(char[sizeof("" literal "") <=                       \
+                                        MU_STRING_FIXED_MAX_LEN + 1            \
+                                    ? 1                                        \
+                                    : -1])))
+
+#define MU_STRING_FIXED_LANES 0x0101010101010101ULL
+#define MU_STRING_FIXED_LOW7 0x7F7F7F7F7F7F7F7FULL
+
+// *****************************************************************************
+// Public code
+
+/**
+ * @brief Reads `n` (at most 8) bytes at `p` as a little-endian integer.
+ *
+ * Compilers turn the loop into a single load.
+ */
+static inline uint64_t mu_string_fixed_load(const char *p, size_t n) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < n; i++) {
+        v |= (uint64_t)(unsigned char)p[i] << (8 * i);
+    }
+    return v;
+}
+
+/**
+ * @brief Returns the width of the words used to verify a needle of length
+ * `len`.
+ */
+static inline size_t mu_string_fixed_width(size_t len) {
+    return len >= 8 ? 8 : len >= 4 ? 4 : len >= 2 ? 2 : len;
+}
+
+/**
+ * @brief Prepares a needle of at most MU_STRING_FIXED_MAX_LEN bytes.
+ *
+ * With a constant argument, the result is computed at compile time.
+ *
+ * @param needle The needle bytes.
+ * @param len The needle length, clamped to MU_STRING_FIXED_MAX_LEN.
+ * @return The prepared needle.
+ */
+static inline mu_string_fixed_t mu_string_fixed_make(const char *needle,
+                                                     size_t len) {
+    mu_string_fixed_t f = { 0, 0, 0, 0, 0 };
+    if (needle == NULL || len == 0) {
+        return f;
+    }
+    f.len = len < MU_STRING_FIXED_MAX_LEN ? len : MU_STRING_FIXED_MAX_LEN;
+    size_t w = mu_string_fixed_width(f.len);
+    f.first = (unsigned char)needle[0] * MU_STRING_FIXED_LANES;
+    f.last = (unsigned char)needle[f.len - 1] * MU_STRING_FIXED_LANES;
+    f.head = mu_string_fixed_load(needle, w);
+    f.tail = mu_string_fixed_load(&needle[f.len - w], w);
+    return f;
+}
+
+/**
+ * @brief Returns true if the needle occurs at `p`, given that its first and
+ * last bytes already match.
+ */
+static inline int mu_string_fixed_verify(const char *p, mu_string_fixed_t f) {
+    size_t w = mu_string_fixed_width(f.len);
+    if (f.len <= 2) {
+        return 1;
+    }
+    return mu_string_fixed_load(p, w) == f.head &&
+           mu_string_fixed_load(&p[f.len - w], w) == f.tail;
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero `x`.
+ */
+static inline unsigned mu_string_fixed_ctz(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(x);
+#else
+    unsigned n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n += 1;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Finds the first occurrence of a prepared needle.
+ *
+ * @param haystack The view to search.
+ * @param needle A needle from mu_string_fixed_make().
+ * @return As mu_string_find_str(): a view from the start of the match to the
+ * end of `haystack`, `haystack` itself for an empty needle, MU_STRING_EMPTY
+ * if there is no match, or MU_STRING_INVALID if `haystack` is invalid.
+ */
+static inline mu_string_t mu_string_find_fixed(mu_string_t haystack,
+                                               mu_string_fixed_t needle) {
+    mu_string_t result;
+    if (haystack.buf == NULL && haystack.len > 0) {
+        result.buf = NULL;
+        result.len = SIZE_MAX;
+        return result;
+    }
+    if (needle.len == 0) {
+        return haystack;
+    }
+    result.buf = "";
+    result.len = 0;
+    if (needle.len > haystack.len) {
+        return result;
+    }
+
+    const char *h = haystack.buf;
+    const size_t last = haystack.len - needle.len; // last possible start
+    size_t i = 0;
+
+    // Eight starts per step.  A byte lane of `x` is zero only where both
+    // the first and the last byte match.
+    for (; i + 7 <= last; i += 8) {
+        uint64_t x = (mu_string_fixed_load(&h[i], 8) ^ needle.first) |
+                     (mu_string_fixed_load(&h[i + needle.len - 1], 8) ^
+                      needle.last);
+        uint64_t t = (x & MU_STRING_FIXED_LOW7) + MU_STRING_FIXED_LOW7;
+        uint64_t zero = ~(t | x | MU_STRING_FIXED_LOW7); // exact, no borrows
+        while (zero) {
+            size_t at = i + mu_string_fixed_ctz(zero) / 8;
+            if (mu_string_fixed_verify(&h[at], needle)) {
+                result.buf = &h[at];
+                result.len = haystack.len - at;
+                return result;
+            }
+            zero &= zero - 1;
+        }
+    }
+    const unsigned char first = (unsigned char)needle.first;
+    const unsigned char final = (unsigned char)needle.last;
+    for (; i <= last; i++) {
+        if ((unsigned char)h[i] == first &&
+            (unsigned char)h[i + needle.len - 1] == final &&
+            mu_string_fixed_verify(&h[i], needle)) {
+            result.buf = &h[i];
+            result.len = haystack.len - i;
+            return result;
+        }
+    }
+    return result;
+}
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_FIXED_H
@@ -0,0 +1,154 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_fixed.hpp
+ *
+ * @brief C++20 searcher specialized on a needle given as a template argument.
+ *
+ *     constexpr mu::fixed_searcher<"\r\n\r\n"> end_of_headers;
+ *     std::size_t at = end_of_headers.find(request);
+ *
+ * The needle, at most 16 bytes, is prepared at compile time into the
+ * constants used by mu_string_find_fixed(), so a search does no setup.  The
+ * searcher can also be passed to `std::search()`.
+ */
+
+#ifndef MU_STRING_FIXED_HPP
+#define MU_STRING_FIXED_HPP
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.hpp"
+#include "mu_string_fixed.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace mu {
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief A string literal usable as a template argument.
+ */
+template <std::size_t N> struct fixed_string {
+    char buf[N] = {};
+
+    constexpr fixed_string(const char (&s)[N]) noexcept {
+        for (std::size_t i = 0; i < N; i++) {
+            buf[i] = s[i];
+        }
+    }
+
+    /**
+     * @brief Returns the length, not counting the literal's terminating NUL.
+     */
+    constexpr std::size_t size() const noexcept { return N - 1; }
+};
+
+/**
+ * @brief Searches for the needle `Needle`.
+ */
+template <fixed_string Needle> class fixed_searcher {
+    static_assert(Needle.size() <= MU_STRING_FIXED_MAX_LEN,
+                  "fixed_searcher needles are limited to 16 bytes");
+
+  public:
+    /**
+     * @brief Returns the needle.
+     */
+    static constexpr string_view needle() noexcept {
+        return string_view(Needle.buf, Needle.size());
+    }
+
+    /**
+     * @brief Returns the index of the first occurrence of the needle in
+     * `haystack`, or string_view::npos.  An empty needle is found at 0.
+     */
+    std::size_t find(string_view haystack) const noexcept {
+        if (Needle.size() == 0) {
+            return 0;
+        }
+        mu_string_t hit = mu_string_find_fixed(haystack.c(), prepared);
+        return hit.len == 0 ? string_view::npos
+                            : static_cast<std::size_t>(hit.buf - haystack.data());
+    }
+
+    /**
+     * @brief Returns true if the needle occurs in `haystack`.
+     */
+    bool contains(string_view haystack) const noexcept {
+        return find(haystack) != string_view::npos;
+    }
+
+    /**
+     * @brief Searches [first, last), for `std::search()`.
+     *
+     * @return The bounds of the match, or {last, last}.
+     */
+    std::pair<const char *, const char *> operator()(const char *first,
+                                                     const char *last) const noexcept {
+        std::size_t i = find(string_view(first, static_cast<std::size_t>(last - first)));
+        if (i == string_view::npos) {
+            return { last, last };
+        }
+        return { first + i, first + i + Needle.size() };
+    }
+
+  private:
+    static constexpr std::uint64_t load(std::size_t at, std::size_t n) noexcept {
+        std::uint64_t v = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            v |= std::uint64_t(static_cast<unsigned char>(Needle.buf[at + i])) << (8 * i);
+        }
+        return v;
+    }
+
+    static constexpr mu_string_fixed_t prepare() noexcept {
+        // As mu_string_fixed_make(), which is not constexpr.
+        constexpr std::size_t n = Needle.size();
+        mu_string_fixed_t f = { 0, 0, 0, 0, 0 };
+        if constexpr (n > 0) {
+            constexpr std::size_t w = n >= 8 ? 8 : n >= 4 ? 4 : n >= 2 ? 2 : 1;
+            f.first = load(0, 1) * MU_STRING_FIXED_LANES;
+            f.last = load(n - 1, 1) * MU_STRING_FIXED_LANES;
+            f.head = load(0, w);
+            f.tail = load(n - w, w);
+            f.len = n;
+        }
+        return f;
+    }
+
+    static constexpr mu_string_fixed_t prepared = prepare();
+};
+
+} // namespace mu
+
+// *****************************************************************************
+// End of file
+
+#endif // MU_STRING_FIXED_HPP
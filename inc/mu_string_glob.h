@@ -0,0 +1,149 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_glob.h
+ *
+ * @brief Shell-style wildcard matching (`*`, `?`, `[...]`) on string views,
+ * with patterns compiled once and matched many times.
+ *
+ * Compiling splits the pattern at each `*` into fixed-length segments and
+ * records the literal text at the start of each.  Matching anchors the first
+ * and last segments and finds every middle segment at its leftmost position,
+ * using mu_string_find_str() on the segment's literal text.  Because each
+ * segment has a fixed length, the leftmost match is always the correct one.
+ * No backtracking is needed, so matching never takes more than
+ * O(len(s) * len(pattern)) time, and typical patterns run in linear time.
+ *
+ * Pattern syntax:
+ *
+ *   `*`       matches any run of bytes, including none.
+ *   `?`       matches any single byte.
+ *   `[abc]`   matches one byte in the set.  Ranges (`[a-z]`) are allowed, and
+ *             `[!...]` or `[^...]` negates the set.  A `]` directly after the
+ *             opening bracket (or after `!` / `^`) is literal, as is `\`
+ *             anywhere inside the brackets.
+ *   `\x`      matches the byte `x` literally.
+ *
+ * Matching is bytewise: `?` matches one byte of a multi-byte UTF-8 sequence.
+ * Unlike fnmatch(), `/` and leading `.` get no special treatment.
+ */
+
+#ifndef MU_STRING_GLOB_H
+#define MU_STRING_GLOB_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Maximum number of `*`-separated segments in a compiled pattern.
+ *
+ * Define before including this header to override.
+ */
+#ifndef MU_STRING_GLOB_MAX_SEGMENTS
+#define MU_STRING_GLOB_MAX_SEGMENTS 8
+#endif
+
+/**
+ * @brief One `*`-free run of a compiled pattern.
+ */
+typedef struct {
+    mu_string_t pattern; ///< The segment's pattern text.
+    mu_string_t literal; ///< Literal text at the start of the segment.
+    size_t len;          ///< Number of input bytes the segment matches.
+    bool is_literal;     ///< true if `literal` is the entire segment.
+} mu_string_glob_segment_t;
+
+/**
+ * @brief A compiled glob pattern.
+ *
+ * Holds views into the pattern text, which must outlive it.  Initialize with
+ * mu_string_glob_compile().
+ */
+typedef struct {
+    mu_string_glob_segment_t segments[MU_STRING_GLOB_MAX_SEGMENTS];
+    size_t n_segments;  ///< Number of segments in use.
+    size_t min_len;     ///< Shortest input that could match.
+    bool leading_star;  ///< Pattern starts with `*`.
+    bool trailing_star; ///< Pattern ends with `*`.
+    bool has_star;      ///< Pattern contains at least one `*`.
+} mu_string_glob_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Compiles a glob pattern.
+ *
+ * @param glob The compiled pattern to initialize.
+ * @param pattern The pattern text.  Must outlive `glob`.
+ * @return `glob`, or NULL if an argument is invalid, the pattern is malformed
+ * (an unclosed `[` or a trailing `\`), or it has more than
+ * MU_STRING_GLOB_MAX_SEGMENTS segments.
+ */
+mu_string_glob_t *mu_string_glob_compile(mu_string_glob_t *glob,
+                                         mu_string_t pattern);
+
+/**
+ * @brief Tests whether a string matches a compiled pattern in its entirety.
+ *
+ * @param glob A compiled pattern.
+ * @param s The string to test.
+ * @return true if `s` matches, false if not or if an argument is invalid.
+ */
+bool mu_string_glob_match(const mu_string_glob_t *glob, mu_string_t s);
+
+/**
+ * @brief Returns the literal text every matching string must start with.
+ *
+ * Useful for narrowing a search over sorted keys before matching.
+ *
+ * @param glob A compiled pattern.
+ * @return A view of the literal prefix (possibly empty), or MU_STRING_INVALID
+ * if `glob` is NULL.
+ */
+mu_string_t mu_string_glob_prefix(const mu_string_glob_t *glob);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_GLOB_H
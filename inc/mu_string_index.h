@@ -0,0 +1,163 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_index.h
+ *
+ * @brief A suffix-array index for repeated substring queries over a fixed
+ * corpus.
+ *
+ * mu_string_find_str() scans the whole haystack on every call.  When many
+ * needles are looked up in the same large, unchanging buffer (a loaded
+ * dictionary or configuration dump), build an index once: each query is then
+ * a binary search costing O(m log n) byte comparisons for a needle of length
+ * m in a corpus of length n.
+ *
+ * The suffix array is built in O(n) time with the SA-IS algorithm (Nong,
+ * Zhang and Chan, "Two Efficient Algorithms for Linear Time Suffix Array
+ * Construction", 2011).  All memory comes from the caller: the suffix array
+ * itself, `corpus.len + 1` entries, and a work area that is needed only
+ * during the build.
+ *
+ * The index holds views into the corpus and the suffix array.  Both must
+ * outlive it and must not be modified.
+ */
+
+#ifndef MU_STRING_INDEX_H
+#define MU_STRING_INDEX_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Number of `uint32_t` entries of suffix array storage needed to index
+ * a corpus of `n` bytes.
+ */
+#define MU_STRING_INDEX_SA_LEN(n) ((size_t)(n) + 1)
+
+/**
+ * @brief Number of `uint32_t` entries of work space sufficient to build an
+ * index over a corpus of `n` bytes.
+ */
+#define MU_STRING_INDEX_WORK_LEN(n)                                            \
+    (((size_t)(n) + 1) / 2 + ((size_t)(n) + 1) / 16 + 320)
+
+/**
+ * @brief A suffix-array index.  Treat as opaque: initialize with
+ * mu_string_index_build().
+ */
+typedef struct {
+    mu_string_t corpus; ///< The indexed text.
+    const uint32_t *sa; ///< Suffix start offsets in lexicographic order.
+} mu_string_index_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Builds a suffix-array index over a corpus.
+ *
+ * @param index The index to initialize.
+ * @param corpus The text to index.  Must be shorter than UINT32_MAX - 1
+ * bytes.
+ * @param sa Storage for the suffix array, at least
+ * MU_STRING_INDEX_SA_LEN(corpus.len) entries.
+ * @param work Scratch storage for the build, at least `work_len` entries.
+ * It may be reused as soon as this function returns.
+ * @param work_len The number of entries in `work`.
+ * MU_STRING_INDEX_WORK_LEN(corpus.len) is always enough.
+ * @return `index`, or NULL if an argument is invalid or `work` is too small.
+ */
+mu_string_index_t *mu_string_index_build(mu_string_index_t *index,
+                                         mu_string_t corpus, uint32_t *sa,
+                                         uint32_t *work, size_t work_len);
+
+/**
+ * @brief Counts the occurrences of a needle in the corpus.
+ *
+ * Overlapping occurrences are counted.  An empty needle occurs at every
+ * offset.
+ *
+ * @param index A built index.
+ * @param needle The string to look for.
+ * @return The number of occurrences, or 0 if an argument is invalid.
+ */
+size_t mu_string_index_count(const mu_string_index_t *index, mu_string_t needle);
+
+/**
+ * @brief Finds one occurrence of a needle in the corpus.
+ *
+ * The occurrence returned is the one whose suffix sorts first, not
+ * necessarily the leftmost.
+ *
+ * @param index A built index.
+ * @param needle The string to look for.
+ * @return A view of the occurrence in the corpus (`needle.len` bytes),
+ * MU_STRING_NOT_FOUND if there is none, or MU_STRING_INVALID if an argument
+ * is invalid.
+ */
+mu_string_t mu_string_index_find(const mu_string_index_t *index,
+                                 mu_string_t needle);
+
+/**
+ * @brief Finds all occurrences of a needle in the corpus.
+ *
+ * Views of up to `max_results` occurrences are written to `results` in
+ * suffix order, which is not offset order.  The offset of each occurrence
+ * is `results[i].buf - index->corpus.buf`.
+ *
+ * @param index A built index.
+ * @param needle The string to look for.
+ * @param results Receives views of the occurrences.  May be NULL if
+ * `max_results` is 0.
+ * @param max_results The number of elements in `results`.
+ * @return The total number of occurrences, which may exceed `max_results`,
+ * or 0 if an argument is invalid.
+ */
+size_t mu_string_index_find_all(const mu_string_index_t *index,
+                                mu_string_t needle, mu_string_t *results,
+                                size_t max_results);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_INDEX_H
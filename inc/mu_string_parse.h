@@ -0,0 +1,213 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_parse.h
+ *
+ * @brief Parsers that convert common fixed-format fields directly from
+ * `mu_string_t` views, without NUL-terminated copies.
+ *
+ * Each parser consumes a prefix of its input and, on success, optionally
+ * returns the unconsumed remainder so that calls can be chained with the
+ * mu_string split functions.
+ */
+
+#ifndef MU_STRING_PARSE_H
+#define MU_STRING_PARSE_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief A parsed timestamp.
+ */
+typedef struct {
+    int64_t epoch_ns;       ///< Nanoseconds since 1970-01-01T00:00:00Z.
+    int16_t offset_minutes; ///< UTC offset as written, e.g. -300 for -05:00.
+} mu_string_timestamp_t;
+
+/**
+ * @brief Maximum text length of a formatted IPv4 address ("255.255.255.255").
+ */
+#define MU_STRING_IPV4_MAX_LEN 15
+
+/**
+ * @brief Maximum text length of a formatted IPv6 address.
+ */
+#define MU_STRING_IPV6_MAX_LEN 39
+
+/**
+ * @brief Maximum text length of a formatted CIDR block.
+ */
+#define MU_STRING_CIDR_MAX_LEN (MU_STRING_IPV6_MAX_LEN + 4)
+
+/**
+ * @brief A parsed CIDR block.
+ */
+typedef struct {
+    uint8_t addr[16];   ///< Address in network byte order.  An IPv4 address
+                        ///< occupies the first 4 bytes; the rest are zero.
+    uint8_t prefix_len; ///< Prefix length in bits.
+    bool is_ipv6;       ///< true for an IPv6 block, false for IPv4.
+} mu_string_cidr_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Parses an ISO 8601 / RFC 3339 timestamp from the start of a view.
+ *
+ * Accepted forms:
+ *
+ *   YYYY-MM-DD
+ *   YYYY-MM-DD{T|t| }hh:mm:ss[.fraction][Z|z|+hh:mm|-hh:mm|+hhmm|-hhmm]
+ *
+ * A `T` or `t` after the date must be followed by a complete `hh:mm:ss`.  A
+ * space is taken as the date/time separator only when `hh:mm:ss` follows it;
+ * otherwise the date alone is parsed and `rest` begins at the space.
+ * Fractions of up to nine digits are honored; further digits are consumed
+ * and ignored.  A time with no offset, and a date with no time, are taken to
+ * be UTC.  A leap second (`:60`) is accepted and counts as the first second of
+ * the following minute.  Only years that fit in `epoch_ns` (1678 to 2261) are
+ * accepted.
+ *
+ * @param s The view to parse.
+ * @param out Receives the timestamp.  Not modified on failure.
+ * @param rest Optional; receives the view following the timestamp.  Not
+ * modified on failure.
+ * @return true if a timestamp was parsed, false otherwise.
+ */
+bool mu_string_parse_iso8601(mu_string_t s, mu_string_timestamp_t *out,
+                             mu_string_t *rest);
+
+/**
+ * @brief Parses a dotted-quad IPv4 address from the start of a view.
+ *
+ * Each octet is one to three decimal digits with no leading zeros (so "010"
+ * is rejected rather than silently read as octal or decimal), and at most 255.
+ * An address followed directly by another '.' is rejected.
+ *
+ * @param s The view to parse.
+ * @param out Receives the address in network byte order.  Not modified on
+ * failure.
+ * @param rest Optional; receives the view following the address.  Not
+ * modified on failure.
+ * @return true if an address was parsed, false otherwise.
+ */
+bool mu_string_parse_ipv4(mu_string_t s, uint8_t out[4], mu_string_t *rest);
+
+/**
+ * @brief Parses an IPv6 address (RFC 4291 section 2.2) from the start of a
+ * view.
+ *
+ * Accepts one "::" run of zero groups and a trailing embedded dotted-quad
+ * IPv4 address.  Zone identifiers ("%eth0") are not consumed: they are left
+ * at the start of `rest`.  An address followed directly by ':', '.' or a hex
+ * digit is rejected.
+ *
+ * @param s The view to parse.
+ * @param out Receives the address in network byte order.  Not modified on
+ * failure.
+ * @param rest Optional; receives the view following the address.  Not
+ * modified on failure.
+ * @return true if an address was parsed, false otherwise.
+ */
+bool mu_string_parse_ipv6(mu_string_t s, uint8_t out[16], mu_string_t *rest);
+
+/**
+ * @brief Parses an "address/prefix" CIDR block from the start of a view.
+ *
+ * The address may be IPv4 (prefix 0..32) or IPv6 (prefix 0..128).  Host bits
+ * are not required to be zero and are returned as written.
+ *
+ * @param s The view to parse.
+ * @param out Receives the block.  Not modified on failure.
+ * @param rest Optional; receives the view following the block.  Not modified
+ * on failure.
+ * @return true if a block was parsed, false otherwise.
+ */
+bool mu_string_parse_cidr(mu_string_t s, mu_string_cidr_t *out,
+                          mu_string_t *rest);
+
+/**
+ * @brief Formats an IPv4 address as a dotted quad.
+ *
+ * @param dst The destination segment.
+ * @param addr The address in network byte order.
+ * @return A view of the text written at the start of `dst`, or
+ * MU_STRING_INVALID if `dst` is too small (nothing is written) or an argument
+ * is NULL.
+ */
+mu_string_t mu_string_format_ipv4(mu_string_mut_t dst, const uint8_t addr[4]);
+
+/**
+ * @brief Formats an IPv6 address in RFC 5952 canonical form.
+ *
+ * Hex digits are lowercase, leading zeros are dropped, and the longest run of
+ * two or more zero groups is written as "::".  IPv4-mapped addresses are
+ * written as "::ffff:a.b.c.d".
+ *
+ * @param dst The destination segment.
+ * @param addr The address in network byte order.
+ * @return A view of the text written at the start of `dst`, or
+ * MU_STRING_INVALID if `dst` is too small (nothing is written) or an argument
+ * is NULL.
+ */
+mu_string_t mu_string_format_ipv6(mu_string_mut_t dst, const uint8_t addr[16]);
+
+/**
+ * @brief Formats a CIDR block as "address/prefix".
+ *
+ * @param dst The destination segment.
+ * @param cidr The block.
+ * @return A view of the text written at the start of `dst`, or
+ * MU_STRING_INVALID if `dst` is too small (nothing is written) or an argument
+ * is NULL.
+ */
+mu_string_t mu_string_format_cidr(mu_string_mut_t dst,
+                                  const mu_string_cidr_t *cidr);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_PARSE_H
@@ -0,0 +1,223 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_ranges.hpp
+ *
+ * @brief C++20 lazy ranges that split a mu::string_view into fields or lines.
+ *
+ *     for (mu::string_view field : mu::split(record, ',')) { ... }
+ *     for (mu::string_view line : mu::lines(text)) { ... }
+ *
+ * Each range yields views into the input as it is iterated: nothing is
+ * collected into an array, and the input must outlive the range.  They are
+ * forward ranges, so they compose with `std::views` adaptors.
+ *
+ * mu::split() searches with `std::char_traits<char>::find()`, which compiles
+ * to a vectorized `memchr()`.  mu::split_if() takes its predicate as a
+ * template parameter, so a lambda is inlined into the scan.
+ */
+
+#ifndef MU_STRING_RANGES_HPP
+#define MU_STRING_RANGES_HPP
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.hpp"
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+namespace mu {
+
+// *****************************************************************************
+// Public types and definitions
+
+namespace detail {
+
+/**
+ * @brief Finds the next occurrence of one delimiter character.
+ */
+struct char_finder {
+    char delimiter;
+    constexpr std::size_t operator()(string_view s) const noexcept {
+        return s.find(delimiter);
+    }
+};
+
+/**
+ * @brief Finds the next character satisfying a predicate.
+ */
+template <typename Pred> struct pred_finder {
+    Pred pred;
+    constexpr std::size_t operator()(string_view s) const {
+        return s.find_if(pred);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief A lazy range of the fields between delimiters.
+ *
+ * `Finder(s)` returns the index of the first delimiter in `s`, or npos.  Each
+ * delimiter is one character wide.  Use mu::split(), mu::split_if() or
+ * mu::lines() rather than naming this type.
+ *
+ * @tparam Lines If true, a '\r' before each delimiter is dropped, and input
+ * that ends with a delimiter (or is empty) yields no trailing empty field.
+ */
+template <typename Finder, bool Lines = false>
+class split_view : public std::ranges::view_interface<split_view<Finder, Lines>> {
+  public:
+    class iterator {
+      public:
+        using value_type = string_view;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+
+        iterator() = default;
+
+        constexpr string_view operator*() const noexcept { return field_; }
+
+        constexpr iterator &operator++() {
+            if (last_) {
+                rest_ = rest_.substr(rest_.size());
+                done_ = true;
+            } else {
+                rest_ = rest_.substr(raw_len_ + 1);
+                load();
+            }
+            return *this;
+        }
+
+        constexpr iterator operator++(int) {
+            iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        friend constexpr bool operator==(const iterator &a,
+                                         const iterator &b) noexcept {
+            return a.rest_.data() == b.rest_.data() && a.done_ == b.done_;
+        }
+
+        friend constexpr bool operator==(const iterator &a,
+                                         std::default_sentinel_t) noexcept {
+            return a.done_;
+        }
+
+      private:
+        friend split_view;
+
+        constexpr iterator(const Finder *finder, string_view input)
+            : finder_(finder), rest_(input) {
+            load();
+        }
+
+        constexpr void load() {
+            if (Lines && rest_.empty()) {
+                done_ = true;
+                return;
+            }
+            std::size_t i = (*finder_)(rest_);
+            last_ = (i == string_view::npos);
+            raw_len_ = last_ ? rest_.size() : i;
+            field_ = rest_.substr(0, raw_len_);
+            if (Lines && field_.ends_with('\r')) {
+                field_.remove_suffix(1);
+            }
+            done_ = false;
+        }
+
+        const Finder *finder_ = nullptr;
+        string_view rest_;         // input from the start of field_
+        string_view field_;        // the current field
+        std::size_t raw_len_ = 0;  // length of field_ before any '\r' is cut
+        bool last_ = true;         // no delimiter follows field_
+        bool done_ = true;
+    };
+
+    constexpr split_view(string_view input, Finder finder)
+        : input_(input), finder_(finder) {}
+
+    constexpr iterator begin() const { return iterator(&finder_, input_); }
+
+    constexpr std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+
+  private:
+    string_view input_;
+    Finder finder_;
+};
+
+// *****************************************************************************
+// Public code
+
+/**
+ * @brief Splits `input` at each `delimiter`, as repeated calls to
+ * mu_string_split_at_char() would.
+ *
+ * Adjacent delimiters yield empty fields, and N delimiters always yield N + 1
+ * fields: "a,,b," gives "a", "", "b", "", and "" gives one empty field.
+ */
+constexpr split_view<detail::char_finder> split(string_view input,
+                                                char delimiter) noexcept {
+    return split_view<detail::char_finder>(input, { delimiter });
+}
+
+/**
+ * @brief Splits `input` at each character for which `pred(c)` is true, as
+ * repeated calls to mu_string_split_by_pred() would.
+ *
+ * Each matching character is a separate delimiter, as in mu::split().  To
+ * treat runs of delimiters as one, skip the empty fields, e.g. with
+ * `std::views::filter`.
+ */
+template <typename Pred>
+constexpr split_view<detail::pred_finder<Pred>> split_if(string_view input,
+                                                         Pred pred) {
+    return split_view<detail::pred_finder<Pred>>(input, { pred });
+}
+
+/**
+ * @brief Splits `input` into lines terminated by LF or CRLF, without their
+ * terminators.
+ *
+ * The last line need not be terminated.  "a\r\nb\n" and "a\nb" both give
+ * "a", "b", and "" gives no lines.
+ */
+constexpr split_view<detail::char_finder, true> lines(string_view input) noexcept {
+    return split_view<detail::char_finder, true>(input, { '\n' });
+}
+
+} // namespace mu
+
+// *****************************************************************************
+// End of file
+
+#endif // MU_STRING_RANGES_HPP
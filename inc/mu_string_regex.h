@@ -0,0 +1,257 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_regex.h
+ *
+ * @brief A small regular expression engine for string views that runs in
+ * linear time and allocates nothing.
+ *
+ * Supported syntax:
+ *
+ *   `abc`      literal bytes; `\` escapes any punctuation character.
+ *   `.`        any byte except '\n'.
+ *   `[a-z]`    byte class, with ranges and `[^...]` negation.
+ *   `\d \w \s` digit, word and whitespace classes (and `\D \W \S`).
+ *   `\n \t \r \f \v \xHH`  control characters and hex bytes.
+ *   `|`        alternation.
+ *   `* + ?`    repetition, greedy; append `?` for the lazy form.
+ *   `(...)`    capturing group; `(?:...)` non-capturing group.
+ *   `^ $`      start and end of the input.
+ *
+ * Matches follow leftmost-first (Perl) semantics and operate on bytes.  As in
+ * other automaton-based engines, a repeated group that can match the empty
+ * string may report different spans than a backtracking engine would.
+ *
+ * A compiled pattern (`mu_string_regex_t`) is read-only during matching and
+ * may be shared.  Matching uses a separate `mu_string_regex_cache_t` that
+ * holds a lazily built DFA.  DFA states are built on demand, one input byte
+ * class at a time, and the whole cache is flushed and rebuilt if it fills.
+ * mu_string_regex_is_match() runs on the DFA alone.  mu_string_regex_find()
+ * uses the DFA to reject non-matching input, then runs a Pike VM to recover
+ * the match span and capture offsets.  Both passes take time linear in the
+ * input.  When the pattern starts with literal text, mu_string_find_str()
+ * skips ahead to each place where a match could begin.
+ *
+ * All limits are compile-time constants that can be overridden by defining
+ * them before including this header.
+ */
+
+#ifndef MU_STRING_REGEX_H
+#define MU_STRING_REGEX_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Maximum number of compiled program instructions (at most 255).
+ */
+#ifndef MU_STRING_REGEX_MAX_INSTS
+#define MU_STRING_REGEX_MAX_INSTS 64
+#endif
+
+/**
+ * @brief Maximum number of distinct bracket / escape classes in a pattern.
+ */
+#ifndef MU_STRING_REGEX_MAX_CLASSES
+#define MU_STRING_REGEX_MAX_CLASSES 8
+#endif
+
+/**
+ * @brief Maximum number of capturing groups, not counting the whole match.
+ */
+#ifndef MU_STRING_REGEX_MAX_GROUPS
+#define MU_STRING_REGEX_MAX_GROUPS 4
+#endif
+
+/**
+ * @brief Maximum length of the literal prefix used for skipping ahead.
+ */
+#ifndef MU_STRING_REGEX_MAX_PREFIX
+#define MU_STRING_REGEX_MAX_PREFIX 16
+#endif
+
+/**
+ * @brief Number of DFA states held in a cache (at most 255).
+ */
+#ifndef MU_STRING_REGEX_CACHE_STATES
+#define MU_STRING_REGEX_CACHE_STATES 32
+#endif
+
+/**
+ * @brief Maximum number of byte equivalence classes for which the DFA is
+ * used.  Patterns that need more fall back to the Pike VM alone.
+ */
+#ifndef MU_STRING_REGEX_MAX_BYTE_CLASSES
+#define MU_STRING_REGEX_MAX_BYTE_CLASSES 64
+#endif
+
+#define MU_STRING_REGEX_SET_WORDS ((MU_STRING_REGEX_MAX_INSTS + 63) / 64)
+#define MU_STRING_REGEX_SLOTS (2 * (MU_STRING_REGEX_MAX_GROUPS + 1))
+
+/**
+ * @brief One compiled program instruction.  Treat as opaque.
+ */
+typedef struct {
+    uint8_t op;  ///< Operation.
+    uint8_t arg; ///< Byte, class index or capture slot.
+    uint8_t x;   ///< Jump target.
+    uint8_t y;   ///< Alternate jump target.
+} mu_string_regex_inst_t;
+
+/**
+ * @brief A compiled pattern.  Treat as opaque: initialize with
+ * mu_string_regex_compile().
+ */
+typedef struct {
+    mu_string_regex_inst_t prog[MU_STRING_REGEX_MAX_INSTS];
+    uint32_t classes[MU_STRING_REGEX_MAX_CLASSES][8];
+    uint8_t byte_class[256];
+    char prefix[MU_STRING_REGEX_MAX_PREFIX];
+    size_t n_insts;
+    size_t n_classes;
+    size_t n_byte_classes;
+    size_t n_groups;
+    size_t prefix_len;
+    bool anchored;   ///< Every match must start at offset 0.
+    bool has_eol;    ///< Pattern contains `$`.
+} mu_string_regex_t;
+
+/**
+ * @brief A lazily built DFA state.  Treat as opaque.
+ */
+typedef struct {
+    uint64_t set[MU_STRING_REGEX_SET_WORDS];
+    uint8_t flags;
+} mu_string_regex_dfa_state_t;
+
+/**
+ * @brief Scratch memory for matching: the DFA cache and Pike VM thread
+ * lists.  Treat as opaque: initialize with mu_string_regex_cache_init().
+ *
+ * A cache may be reused across calls and patterns, but not shared between
+ * concurrent matches.
+ */
+typedef struct {
+    const mu_string_regex_t *re;
+    size_t n_states;
+    uint8_t start_state; ///< 1 + index of the state at offset 0, or 0.
+    uint8_t mid_state;   ///< 1 + index of the state with no live threads.
+    mu_string_regex_dfa_state_t states[MU_STRING_REGEX_CACHE_STATES];
+    uint8_t trans[MU_STRING_REGEX_CACHE_STATES * MU_STRING_REGEX_MAX_BYTE_CLASSES];
+    uint8_t thread_pc[2][MU_STRING_REGEX_MAX_INSTS];
+    uint32_t thread_caps[2][MU_STRING_REGEX_MAX_INSTS][MU_STRING_REGEX_SLOTS];
+} mu_string_regex_cache_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Compiles a pattern.
+ *
+ * The compiled pattern does not refer to the pattern text afterwards.
+ *
+ * @param re The compiled pattern to initialize.
+ * @param pattern The pattern text.
+ * @return `re`, or NULL if an argument is invalid, the pattern is malformed,
+ * or it exceeds one of the compile-time limits.
+ */
+mu_string_regex_t *mu_string_regex_compile(mu_string_regex_t *re,
+                                           mu_string_t pattern);
+
+/**
+ * @brief Prepares a cache for matching against a compiled pattern.
+ *
+ * Matching functions call this automatically when given a cache last used
+ * with a different pattern object.  Call it explicitly after compiling a new
+ * pattern into an object the cache has already been used with.
+ *
+ * @param cache The cache to initialize.
+ * @param re The compiled pattern.
+ * @return `cache`, or NULL if an argument is NULL.
+ */
+mu_string_regex_cache_t *mu_string_regex_cache_init(mu_string_regex_cache_t *cache,
+                                                    const mu_string_regex_t *re);
+
+/**
+ * @brief Returns the number of capturing groups in a compiled pattern.
+ *
+ * @param re The compiled pattern.
+ * @return The number of groups, not counting the whole match.
+ */
+size_t mu_string_regex_group_count(const mu_string_regex_t *re);
+
+/**
+ * @brief Tests whether a pattern matches anywhere in a string.
+ *
+ * @param re The compiled pattern.
+ * @param cache Scratch memory for matching.
+ * @param s The string to search.  Must be shorter than UINT32_MAX bytes.
+ * @return true if there is a match, false if not or an argument is invalid.
+ */
+bool mu_string_regex_is_match(const mu_string_regex_t *re,
+                              mu_string_regex_cache_t *cache, mu_string_t s);
+
+/**
+ * @brief Finds the leftmost match of a pattern and its capture groups.
+ *
+ * On success `groups[0]` is the whole match and `groups[k]` is the text of
+ * group `k`, or MU_STRING_NOT_FOUND if that group did not take part in the
+ * match.  Only the first `max_groups` entries are written.
+ *
+ * @param re The compiled pattern.
+ * @param cache Scratch memory for matching.
+ * @param s The string to search.  Must be shorter than UINT32_MAX bytes.
+ * @param groups Receives the match and group views.  May be NULL if
+ * `max_groups` is 0.
+ * @param max_groups The number of elements in `groups`.
+ * @return true if there is a match, false if not or an argument is invalid.
+ */
+bool mu_string_regex_find(const mu_string_regex_t *re,
+                          mu_string_regex_cache_t *cache, mu_string_t s,
+                          mu_string_t *groups, size_t max_groups);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_REGEX_H
@@ -0,0 +1,160 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_static_set.h
+ *
+ * @brief A build-once sorted set of string views laid out for fast lookup.
+ *
+ * Binary search over a plain sorted array touches a different cache line on
+ * every step, and the first steps land on the same few elements of a huge
+ * array but far apart from one another.  Once a set outgrows the cache, each
+ * lookup costs one miss per level.
+ *
+ * This set stores its entries in Eytzinger order: the root of the implicit
+ * search tree first, then its two children, then their four, and so on.  The
+ * entries visited by the first several steps of every search are packed
+ * into the first few cache lines, and the children of entry `k` sit at `2k`
+ * and `2k + 1`, so the lines needed a few steps ahead can be prefetched
+ * before they are known to be needed.
+ *
+ * Each entry carries the first eight bytes of its key as a big-endian
+ * integer.  Most steps are decided by comparing those integers, without
+ * following the key's pointer; the full key is read only on a tie.  The
+ * descent itself has no data-dependent branch.
+ *
+ * Ordering follows mu_string_cmp().  The set holds views of the keys: the
+ * key bytes must outlive it and must not be modified.
+ */
+
+#ifndef MU_STRING_STATIC_SET_H
+#define MU_STRING_STATIC_SET_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Number of entries of storage needed for a set of `n_keys` keys.
+ *
+ * Entry 0 is unused so that the children of entry `k` are `2k` and `2k + 1`.
+ */
+#define MU_STRING_STATIC_SET_ENTRIES(n_keys) ((size_t)(n_keys) + 1)
+
+/**
+ * @brief One key of a static set.
+ */
+typedef struct {
+    uint64_t prefix; ///< First 8 bytes of `key`, big-endian, zero padded.
+    mu_string_t key; ///< The key.
+    size_t rank;     ///< Index of `key` in the sorted input.
+} mu_string_static_set_entry_t;
+
+/**
+ * @brief A static sorted set.
+ *
+ * Treat as opaque: initialize with mu_string_static_set_build().
+ */
+typedef struct {
+    mu_string_static_set_entry_t *entries; ///< Caller-provided storage.
+    size_t n_keys;                         ///< Number of keys.
+} mu_string_static_set_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Builds a static set from a sorted array of keys.
+ *
+ * `keys` must be in ascending mu_string_cmp() order.  Duplicates are allowed;
+ * mu_string_static_set_lower_bound() then reports the first of them.  Only
+ * the `keys` views are copied: the array itself may be discarded after the
+ * build, but the bytes it refers to may not.
+ *
+ * @param set The set to build.
+ * @param entries Storage for the set.
+ * @param n_entries The number of elements in `entries`: at least
+ * MU_STRING_STATIC_SET_ENTRIES(n_keys).
+ * @param keys The keys, sorted.
+ * @param n_keys The number of elements in `keys`.
+ * @return `set`, or NULL if an argument is invalid, `entries` is too small, a
+ * key is invalid or the keys are not sorted.
+ */
+mu_string_static_set_t *mu_string_static_set_build(
+    mu_string_static_set_t *set, mu_string_static_set_entry_t *entries,
+    size_t n_entries, const mu_string_t *keys, size_t n_keys);
+
+/**
+ * @brief Returns the number of keys in a static set.
+ *
+ * @param set A built set.
+ * @return The number of keys, or 0 if `set` is NULL.
+ */
+size_t mu_string_static_set_count(const mu_string_static_set_t *set);
+
+/**
+ * @brief Tests whether a static set contains a key.
+ *
+ * @param set A built set.
+ * @param key The key to look for.
+ * @return true if a key equal to `key` is in the set.
+ */
+bool mu_string_static_set_contains(const mu_string_static_set_t *set,
+                                   mu_string_t key);
+
+/**
+ * @brief Finds the first key in a static set that is not less than a given
+ * key.
+ *
+ * @param set A built set.
+ * @param key The key to search for.
+ * @return The rank (index in the sorted input) of the first key for which
+ * mu_string_cmp(set_key, key) >= 0, or mu_string_static_set_count() if
+ * there is none.
+ */
+size_t mu_string_static_set_lower_bound(const mu_string_static_set_t *set,
+                                        mu_string_t key);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_STATIC_SET_H
@@ -0,0 +1,139 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_trigram.h
+ *
+ * @brief A trigram inverted index answering "which records contain X" over
+ * a fixed collection of views.
+ *
+ * Every 3-byte substring (trigram) of every record is hashed into one of
+ * 2^bucket_bits buckets.  Each bucket keeps a posting list of the record
+ * numbers containing a trigram that hashes there, delta encoded as varints.
+ * A query takes the posting lists for the needle's trigrams, intersects the
+ * shortest few, and confirms each surviving candidate with
+ * mu_string_find_str().  Query cost therefore follows the posting list
+ * lengths and the number of results, not the size of the collection.
+ *
+ * The index is built once into a caller-provided arena of `uint32_t`.  The
+ * arena must hold (2^bucket_bits + 1) offsets, the encoded posting lists
+ * (at most about one byte per trigram occurrence for dense collections),
+ * and 2^bucket_bits further entries of scratch used only while building.
+ * mu_string_trigram_build() reports failure if the arena is too small.
+ *
+ * Needles shorter than three bytes have no trigram to look up and fall back
+ * to checking every record.
+ */
+
+#ifndef MU_STRING_TRIGRAM_H
+#define MU_STRING_TRIGRAM_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Maximum number of posting lists intersected per query.  The
+ * shortest lists are used; the others add little selectivity.
+ */
+#ifndef MU_STRING_TRIGRAM_MAX_LISTS
+#define MU_STRING_TRIGRAM_MAX_LISTS 4
+#endif
+
+/**
+ * @brief A trigram index.  Treat as opaque: initialize with
+ * mu_string_trigram_build().
+ */
+typedef struct {
+    const mu_string_t *records; ///< The indexed records (caller-owned).
+    size_t n_records;           ///< Number of records.
+    const uint32_t *offsets;    ///< Posting list start per bucket, plus end.
+    const uint8_t *postings;    ///< Encoded posting lists.
+    unsigned bucket_bits;       ///< log2 of the number of buckets.
+    size_t arena_used;          ///< Arena entries in use after the build.
+} mu_string_trigram_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Builds a trigram index over an array of records.
+ *
+ * The index refers to `records` and the text they view, which must outlive
+ * it and must not change.
+ *
+ * @param index The index to initialize.
+ * @param records The records to index.
+ * @param n_records The number of records.  Must be less than UINT32_MAX.
+ * @param bucket_bits log2 of the number of hash buckets, 8 to 24.  Around
+ * 16 suits collections of up to a few million trigrams.
+ * @param arena Storage for the index.
+ * @param arena_len The number of entries in `arena`.
+ * @return `index`, or NULL if an argument is invalid or the arena is too
+ * small.
+ */
+mu_string_trigram_t *mu_string_trigram_build(mu_string_trigram_t *index,
+                                             const mu_string_t *records,
+                                             size_t n_records,
+                                             unsigned bucket_bits,
+                                             uint32_t *arena, size_t arena_len);
+
+/**
+ * @brief Finds the records that contain a needle.
+ *
+ * The numbers of up to `max_ids` matching records are written to `ids` in
+ * increasing order.
+ *
+ * @param index A built index.
+ * @param needle The string to look for.  An empty needle matches every
+ * record.
+ * @param ids Receives the record numbers.  May be NULL if `max_ids` is 0.
+ * @param max_ids The number of elements in `ids`.
+ * @return The total number of matching records, which may exceed
+ * `max_ids`, or 0 if an argument is invalid.
+ */
+size_t mu_string_trigram_find(const mu_string_trigram_t *index,
+                              mu_string_t needle, size_t *ids, size_t max_ids);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_TRIGRAM_H
@@ -0,0 +1,168 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file mu_string_utf8.h
+ *
+ * @brief Unicode-aware operations on UTF-8 string views.
+ *
+ * Case folding maps every code point to a canonical case so that strings
+ * which differ only in case compare equal: "Straße", "STRAßE" and "straße"
+ * all fold to "straße".  This module implements the simple (one-to-one)
+ * folding of the Unicode Character Database, so a folded string holds the
+ * same number of code points as its input; full folding, which expands "ß"
+ * to "ss", is not applied.
+ *
+ * Normalization Form C (NFC) gives each string a single canonical encoding:
+ * "é" written as U+00E9 and as "e" followed by U+0301 COMBINING ACUTE
+ * ACCENT are canonically equivalent, and both are U+00E9 in NFC.  Most text
+ * is already in NFC, so mu_string_utf8_nfc_quick_check() answers that
+ * cheaply and mu_string_utf8_to_nfc() does the work only when it is needed.
+ *
+ * Lookups use compact two-level tables generated from the Unicode data by
+ * tools/gen_mu_string_utf8_tables.py.  Spans of ASCII text, which need no
+ * table, are folded eight bytes at a time when MU_STRING_SWAR is enabled,
+ * and the NFC quick check skips text below U+0300, which is always in NFC,
+ * the same way.
+ *
+ * Ill-formed UTF-8 is tolerated: each byte that does not begin a valid
+ * sequence is passed through unchanged and matches only itself.
+ */
+
+#ifndef MU_STRING_UTF8_H
+#define MU_STRING_UTF8_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+#ifndef MU_STRING_UTF8_NFC_SEGMENT
+/**
+ * @brief The most code points mu_string_utf8_to_nfc() can hold in one
+ * segment: a character that cannot combine with what precedes it, with the
+ * combining characters that follow it, after decomposition.
+ *
+ * Text in the Unicode Stream-Safe Text Format (UAX #15) never has more than
+ * 30 combining characters in a row.
+ */
+#define MU_STRING_UTF8_NFC_SEGMENT 64
+#endif
+
+/**
+ * @brief Results of mu_string_utf8_nfc_quick_check(), after the Unicode
+ * NFC_Quick_Check property.
+ */
+typedef enum {
+    MU_STRING_UTF8_NFC_YES,   ///< The string is in NFC.
+    MU_STRING_UTF8_NFC_MAYBE, ///< It may be: only normalizing can tell.
+    MU_STRING_UTF8_NFC_NO,    ///< The string is not in NFC.
+} mu_string_utf8_nfc_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Writes the simple case folding of a UTF-8 string to a buffer.
+ *
+ * A folded code point can take more bytes than the original (U+023A takes
+ * two, its folding U+2C65 three), but never more than half as many again:
+ * a `dst` of `src.len + src.len / 2` bytes is always large enough.  `dst`
+ * must not overlap `src`.
+ *
+ * @param dst The destination buffer.
+ * @param src The UTF-8 string to fold.
+ * @return A view of the folded string in `dst`, or MU_STRING_INVALID if an
+ * argument is invalid or `dst` is too small.
+ */
+mu_string_t mu_string_utf8_casefold(mu_string_mut_t dst, mu_string_t src);
+
+/**
+ * @brief Checks if two UTF-8 strings are equal under simple case folding.
+ *
+ * Equivalent to comparing the results of mu_string_utf8_casefold() on both
+ * strings, but folds as it goes, needs no buffer, and stops at the first
+ * difference.
+ *
+ * @param s1 The first string.
+ * @param s2 The second string.
+ * @return true if the strings fold to the same string, false otherwise or if
+ * either view is invalid.
+ */
+bool mu_string_utf8_eq_casefold(mu_string_t s1, mu_string_t s2);
+
+/**
+ * @brief Checks whether a UTF-8 string is in Normalization Form C without
+ * normalizing it.
+ *
+ * Implements the quick check algorithm of UAX #15, a single pass with no
+ * buffer.  The answer is MU_STRING_UTF8_NFC_MAYBE only if the string holds
+ * characters, such as combining marks, that may compose with the one before
+ * them.
+ *
+ * @param s The UTF-8 string.
+ * @return A mu_string_utf8_nfc_t result, or MU_STRING_UTF8_NFC_NO if `s` is
+ * invalid.
+ */
+mu_string_utf8_nfc_t mu_string_utf8_nfc_quick_check(mu_string_t s);
+
+/**
+ * @brief Converts a UTF-8 string to Normalization Form C.
+ *
+ * If mu_string_utf8_nfc_quick_check() answers MU_STRING_UTF8_NFC_YES, `src`
+ * is returned unchanged and `dst` is not touched.  Otherwise the normalized
+ * string is written to `dst` and a view of it is returned.
+ *
+ * NFC can be longer than its input, though never more than three times as
+ * long.  `dst` must not overlap `src`.
+ *
+ * @param dst The destination buffer, used only if `src` is not in NFC.
+ * @param src The UTF-8 string to normalize.
+ * @return A view of the string in NFC, or MU_STRING_INVALID if an argument
+ * is invalid, `dst` is too small, or a segment holds more than
+ * MU_STRING_UTF8_NFC_SEGMENT code points.
+ */
+mu_string_t mu_string_utf8_to_nfc(mu_string_mut_t dst, mu_string_t src);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MU_STRING_UTF8_H
@@ -0,0 +1,226 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_csv.c
+ *
+ * @brief Implements the mu_csv RFC 4180 reader.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_csv.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Returns the index of the first delimiter, quote, CR or LF at or after
+ * `i`, or `len` if there is none.
+ */
+static size_t scan_unquoted(const char *buf, size_t i, size_t len,
+                            char delimiter, char quote);
+
+/**
+ * @brief Consumes a record terminator (LF, CRLF or CR) at `i`, if present,
+ * and returns the index just past it.
+ */
+static size_t skip_terminator(const char *buf, size_t i, size_t len);
+
+// *****************************************************************************
+// Public code
+
+mu_csv_reader_t *mu_csv_reader_init(mu_csv_reader_t *reader, mu_string_t input,
+                                    char delimiter, char quote) {
+    if (reader == NULL || !mu_string_is_valid(input)) {
+        return NULL;
+    }
+    reader->remaining = input;
+    reader->delimiter = delimiter;
+    reader->quote = quote;
+    return reader;
+}
+
+mu_csv_err_t mu_csv_read_record(mu_csv_reader_t *reader, mu_string_t *fields,
+                                size_t max_fields, size_t *n_fields) {
+    if (reader == NULL || (fields == NULL && max_fields > 0) ||
+        !mu_string_is_valid(reader->remaining)) {
+        return MU_CSV_ERR_INVALID;
+    }
+
+    const char *buf = reader->remaining.buf;
+    size_t len = reader->remaining.len;
+    const char delimiter = reader->delimiter;
+    const char quote = reader->quote;
+    size_t count = 0;
+    size_t i = 0;
+
+    if (n_fields) {
+        *n_fields = 0;
+    }
+    if (len == 0) {
+        return MU_CSV_ERR_END;
+    }
+
+    for (;;) {
+        mu_string_t field;
+
+        if (i < len && buf[i] == quote) {
+            // Quoted field: the content runs to the first quote that is not
+            // immediately followed by another quote.
+            size_t start = ++i;
+            for (;;) {
+                const char *q = memchr(&buf[i], quote, len - i);
+                if (q == NULL) {
+                    return MU_CSV_ERR_UNTERMINATED;
+                }
+                i = (size_t)(q - buf) + 1;
+                if (i < len && buf[i] == quote) {
+                    i += 1; // doubled quote: still inside the field
+                    continue;
+                }
+                break;
+            }
+            field = (mu_string_t){ .buf = &buf[start], .len = i - 1 - start };
+            if (i < len && buf[i] != delimiter && buf[i] != '\n' &&
+                buf[i] != '\r') {
+                return MU_CSV_ERR_SYNTAX;
+            }
+        } else {
+            size_t start = i;
+            i = scan_unquoted(buf, i, len, delimiter, quote);
+            if (i < len && buf[i] == quote) {
+                // A quote inside an unquoted field could not be told apart
+                // from an escaped quote by mu_csv_unescape().
+                return MU_CSV_ERR_SYNTAX;
+            }
+            field = (mu_string_t){ .buf = &buf[start], .len = i - start };
+        }
+
+        if (count < max_fields) {
+            fields[count] = field;
+        }
+        count += 1;
+
+        if (i < len && buf[i] == delimiter) {
+            i += 1; // another field follows, possibly empty
+            continue;
+        }
+        break;
+    }
+
+    i = skip_terminator(buf, i, len);
+    reader->remaining = (mu_string_t){ .buf = &buf[i], .len = len - i };
+    if (n_fields) {
+        *n_fields = count;
+    }
+    return (count > max_fields) ? MU_CSV_ERR_TOO_MANY_FIELDS : MU_CSV_ERR_NONE;
+}
+
+mu_string_t mu_csv_remaining(const mu_csv_reader_t *reader) {
+    if (reader == NULL) {
+        return MU_STRING_INVALID;
+    }
+    return reader->remaining;
+}
+
+bool mu_csv_needs_unescape(const mu_csv_reader_t *reader, mu_string_t field) {
+    if (reader == NULL || !mu_string_is_valid(field) || field.len == 0) {
+        return false;
+    }
+    return memchr(field.buf, reader->quote, field.len) != NULL;
+}
+
+mu_string_t mu_csv_unescape(const mu_csv_reader_t *reader, mu_string_mut_t dst,
+                            mu_string_t field) {
+    if (reader == NULL || !mu_string_is_valid(field)) {
+        return MU_STRING_INVALID;
+    }
+    if (!mu_csv_needs_unescape(reader, field)) {
+        return field; // Common case: nothing to do, no copy.
+    }
+    if (dst.buf == NULL) {
+        return MU_STRING_INVALID;
+    }
+
+    const char quote = reader->quote;
+    size_t out = 0;
+    size_t i = 0;
+    while (i < field.len) {
+        const char *q = memchr(&field.buf[i], quote, field.len - i);
+        // Copy through the quote (or to the end if there is none).
+        size_t run = (q == NULL) ? field.len - i : (size_t)(q - &field.buf[i]) + 1;
+        if (out + run > dst.len) {
+            return MU_STRING_INVALID;
+        }
+        memcpy(&dst.buf[out], &field.buf[i], run);
+        out += run;
+        i += run;
+        if (q != NULL && i < field.len && field.buf[i] == quote) {
+            i += 1; // drop the second quote of a pair
+        }
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = out };
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t scan_unquoted(const char *buf, size_t i, size_t len,
+                            char delimiter, char quote) {
+    // Unquoted fields are usually short, so a tight compare loop beats
+    // setting up four memchr() calls per field.
+    while (i < len) {
+        char ch = buf[i];
+        if (ch == delimiter || ch == quote || ch == '\n' || ch == '\r') {
+            break;
+        }
+        i += 1;
+    }
+    return i;
+}
+
+static size_t skip_terminator(const char *buf, size_t i, size_t len) {
+    if (i < len && buf[i] == '\r') {
+        i += 1;
+    }
+    if (i < len && buf[i] == '\n') {
+        i += 1;
+    }
+    return i;
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,319 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_http.c
+ *
+ * @brief Implements the mu_http request parser.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_http.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define IS_TOKEN(ch) (s_token_chars[(uint8_t)(ch)] != 0)
+#define TO_LOWER(ch) (s_lower[(uint8_t)(ch)])
+
+// *****************************************************************************
+// Private (static) storage
+
+/**
+ * @brief Non-zero for RFC 9110 `tchar` bytes, the characters permitted in
+ * methods and header names.
+ */
+static const uint8_t s_token_chars[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * @brief ASCII lowercase mapping used for case-insensitive name matching.
+ */
+static const uint8_t s_lower[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Searches `buf[start .. len)` for the blank line ending the header
+ * block.  Returns the index just past it, or 0 if it has not been received.
+ */
+static size_t find_header_end(const char *buf, size_t start, size_t len);
+
+/**
+ * @brief Consumes a line ending (CRLF or LF) at `*i`.  Returns false if there
+ * is none.
+ */
+static bool take_eol(const char *buf, size_t *i, size_t len);
+
+/**
+ * @brief Parses "METHOD SP target SP HTTP/1.d EOL" starting at `*i`.
+ */
+static bool parse_request_line(mu_http_request_t *req, const char *buf,
+                               size_t *i, size_t len);
+
+/**
+ * @brief Parses "name: value EOL" starting at `*i` into `hdr`.
+ */
+static bool parse_header_line(mu_http_header_t *hdr, const char *buf,
+                              size_t *i, size_t len);
+
+// *****************************************************************************
+// Public code
+
+mu_http_request_t *mu_http_request_init(mu_http_request_t *req,
+                                        mu_http_header_t *headers,
+                                        size_t max_headers) {
+    if (req == NULL) {
+        return NULL;
+    }
+    memset(req, 0, sizeof(*req));
+    req->headers = headers;
+    req->max_headers = (headers == NULL) ? 0 : max_headers;
+    return req;
+}
+
+mu_http_err_t mu_http_parse_request(mu_http_request_t *req, mu_string_t input,
+                                    size_t prev_len) {
+    if (req == NULL || !mu_string_is_valid(input)) {
+        return MU_HTTP_ERR_INVALID;
+    }
+
+    const char *buf = input.buf;
+    size_t len = input.len;
+    size_t i = 0;
+
+    req->n_headers = 0;
+    req->header_len = 0;
+
+    // Tolerate empty lines preceding the request line (RFC 9112 2.2).
+    while (i < len && (buf[i] == '\r' || buf[i] == '\n')) {
+        i += 1;
+    }
+
+    // A partial "\n\r\n" terminator may straddle the previous read, so back
+    // up three bytes before resuming the scan.
+    size_t resume = (prev_len > 3) ? prev_len - 3 : 0;
+    if (resume < i) {
+        resume = i;
+    }
+    size_t end = find_header_end(buf, resume, len);
+    if (end == 0) {
+        return MU_HTTP_ERR_INCOMPLETE;
+    }
+
+    if (!parse_request_line(req, buf, &i, end)) {
+        return MU_HTTP_ERR_SYNTAX;
+    }
+    for (;;) {
+        if (take_eol(buf, &i, end)) {
+            break; // blank line: end of headers
+        }
+        if (req->n_headers == req->max_headers) {
+            return MU_HTTP_ERR_TOO_MANY_HEADERS;
+        }
+        if (!parse_header_line(&req->headers[req->n_headers], buf, &i, end)) {
+            return MU_HTTP_ERR_SYNTAX;
+        }
+        req->n_headers += 1;
+    }
+    req->header_len = i;
+    return MU_HTTP_ERR_NONE;
+}
+
+bool mu_http_name_eq(mu_string_t a, mu_string_t b) {
+    if (!mu_string_is_valid(a) || !mu_string_is_valid(b) || a.len != b.len) {
+        return false;
+    }
+    for (size_t i = 0; i < a.len; ++i) {
+        if (TO_LOWER(a.buf[i]) != TO_LOWER(b.buf[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+mu_string_t mu_http_find_header(const mu_http_request_t *req, mu_string_t name) {
+    if (req == NULL) {
+        return MU_STRING_NOT_FOUND;
+    }
+    for (size_t i = 0; i < req->n_headers; ++i) {
+        if (mu_http_name_eq(req->headers[i].name, name)) {
+            return req->headers[i].value;
+        }
+    }
+    return MU_STRING_NOT_FOUND;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t find_header_end(const char *buf, size_t start, size_t len) {
+    size_t i = start;
+    while (i < len) {
+        const char *nl = memchr(&buf[i], '\n', len - i);
+        if (nl == NULL) {
+            return 0;
+        }
+        i = (size_t)(nl - buf) + 1;
+        if (i < len && buf[i] == '\n') {
+            return i + 1;
+        }
+        if (i + 1 < len && buf[i] == '\r' && buf[i + 1] == '\n') {
+            return i + 2;
+        }
+    }
+    return 0;
+}
+
+static bool take_eol(const char *buf, size_t *i, size_t len) {
+    size_t j = *i;
+    if (j < len && buf[j] == '\r') {
+        j += 1;
+    }
+    if (j < len && buf[j] == '\n') {
+        *i = j + 1;
+        return true;
+    }
+    return false;
+}
+
+static bool parse_request_line(mu_http_request_t *req, const char *buf,
+                               size_t *i, size_t len) {
+    size_t j = *i;
+    size_t start = j;
+
+    while (j < len && IS_TOKEN(buf[j])) {
+        j += 1;
+    }
+    if (j == start || j >= len || buf[j] != ' ') {
+        return false;
+    }
+    req->method = (mu_string_t){ .buf = &buf[start], .len = j - start };
+
+    start = ++j;
+    while (j < len && (uint8_t)buf[j] > ' ' && buf[j] != 0x7f) {
+        j += 1;
+    }
+    if (j == start || j >= len || buf[j] != ' ') {
+        return false;
+    }
+    req->target = (mu_string_t){ .buf = &buf[start], .len = j - start };
+
+    j += 1;
+    if (len - j < 8 || memcmp(&buf[j], "HTTP/1.", 7) != 0 ||
+        buf[j + 7] < '0' || buf[j + 7] > '9') {
+        return false;
+    }
+    req->minor_version = buf[j + 7] - '0';
+    j += 8;
+
+    if (!take_eol(buf, &j, len)) {
+        return false;
+    }
+    *i = j;
+    return true;
+}
+
+static bool parse_header_line(mu_http_header_t *hdr, const char *buf,
+                              size_t *i, size_t len) {
+    size_t j = *i;
+    size_t start = j;
+
+    // A leading space or tab (obsolete line folding) fails the token test.
+    while (j < len && IS_TOKEN(buf[j])) {
+        j += 1;
+    }
+    if (j == start || j >= len || buf[j] != ':') {
+        return false;
+    }
+    hdr->name = (mu_string_t){ .buf = &buf[start], .len = j - start };
+
+    j += 1;
+    while (j < len && (buf[j] == ' ' || buf[j] == '\t')) {
+        j += 1;
+    }
+    start = j;
+    size_t value_end = j; // one past the last non-whitespace byte
+    while (j < len && buf[j] != '\r' && buf[j] != '\n') {
+        uint8_t ch = (uint8_t)buf[j];
+        if ((ch < ' ' && ch != '\t') || ch == 0x7f) {
+            return false;
+        }
+        j += 1;
+        if (ch != ' ' && ch != '\t') {
+            value_end = j;
+        }
+    }
+    hdr->value = (mu_string_t){ .buf = &buf[start], .len = value_end - start };
+
+    if (!take_eol(buf, &j, len)) {
+        return false;
+    }
+    *i = j;
+    return true;
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,510 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_json.c
+ *
+ * @brief Implements the mu_json tape tokenizer.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_json.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+/**
+ * @brief What the tokenizer expects to see next.
+ */
+typedef enum {
+    EXPECT_VALUE,
+    EXPECT_VALUE_OR_END, // just after '['
+    EXPECT_KEY,          // just after ',' in an object
+    EXPECT_KEY_OR_END,   // just after '{'
+    EXPECT_COLON,
+    EXPECT_COMMA_OR_END,
+    EXPECT_DONE,
+} expect_t;
+
+/**
+ * @brief While a container is open, its start token's `link` holds the index
+ * of the enclosing open container, or NO_PARENT at the top level.  This lets
+ * the tape double as the nesting stack.
+ */
+#define NO_PARENT SIZE_MAX
+
+#define IS_DIGIT(ch) ((ch) >= '0' && (ch) <= '9')
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static size_t skip_whitespace(const char *buf, size_t i, size_t len);
+
+/**
+ * @brief Scans a string starting at the opening quote `buf[*i]`.  On success
+ * sets `*span` to the content and advances `*i` past the closing quote.
+ */
+static mu_json_err_t scan_string(const char *buf, size_t *i, size_t len,
+                                 mu_string_t *span);
+
+/**
+ * @brief Scans a number starting at `buf[*i]` per RFC 8259 section 6.
+ */
+static mu_json_err_t scan_number(const char *buf, size_t *i, size_t len,
+                                 mu_string_t *span);
+
+/**
+ * @brief Matches the literal `lit` at `buf[*i]`.
+ */
+static mu_json_err_t scan_literal(const char *buf, size_t *i, size_t len,
+                                  const char *lit, mu_string_t *span);
+
+static int hex_value(char ch);
+
+/**
+ * @brief Parses the four hex digits at `s` into `*code`.
+ */
+static bool parse_hex4(const char *s, uint32_t *code);
+
+// *****************************************************************************
+// Public code
+
+mu_json_err_t mu_json_tokenize(mu_string_t input, mu_json_token_t *tape,
+                               size_t max_tokens, size_t *n_tokens) {
+    if (!mu_string_is_valid(input) || (tape == NULL && max_tokens > 0)) {
+        return MU_JSON_ERR_INVALID;
+    }
+
+    const char *buf = input.buf;
+    const size_t len = input.len;
+    size_t i = 0;
+    size_t n = 0;
+    size_t open = NO_PARENT;
+    expect_t expect = EXPECT_VALUE;
+    mu_json_err_t err = MU_JSON_ERR_NONE;
+
+    for (;;) {
+        i = skip_whitespace(buf, i, len);
+        if (i == len) {
+            err = (expect == EXPECT_DONE) ? MU_JSON_ERR_NONE
+                                          : MU_JSON_ERR_INCOMPLETE;
+            break;
+        }
+        char ch = buf[i];
+
+        if (expect == EXPECT_DONE) {
+            err = MU_JSON_ERR_SYNTAX; // trailing junk
+            break;
+        }
+        if (expect == EXPECT_COLON) {
+            if (ch != ':') {
+                err = MU_JSON_ERR_SYNTAX;
+                break;
+            }
+            i += 1;
+            expect = EXPECT_VALUE;
+            continue;
+        }
+        if (expect == EXPECT_COMMA_OR_END && ch == ',') {
+            i += 1;
+            expect = (tape[open].kind == MU_JSON_OBJECT_START) ? EXPECT_KEY
+                                                               : EXPECT_VALUE;
+            continue;
+        }
+
+        // Everything below emits a token.
+        if (n == max_tokens) {
+            err = MU_JSON_ERR_TOO_MANY_TOKENS;
+            break;
+        }
+        mu_json_token_t *tok = &tape[n];
+        tok->link = 0;
+
+        if ((ch == '}' || ch == ']') &&
+            (expect == EXPECT_COMMA_OR_END ||
+             (ch == '}' && expect == EXPECT_KEY_OR_END) ||
+             (ch == ']' && expect == EXPECT_VALUE_OR_END))) {
+            mu_json_token_t *start = &tape[open];
+            mu_json_kind_t want = (ch == '}') ? MU_JSON_OBJECT_START
+                                              : MU_JSON_ARRAY_START;
+            if (start->kind != want) {
+                err = MU_JSON_ERR_SYNTAX;
+                break;
+            }
+            size_t parent = start->link;
+            tok->kind = (ch == '}') ? MU_JSON_OBJECT_END : MU_JSON_ARRAY_END;
+            tok->span = (mu_string_t){ .buf = &buf[i], .len = 1 };
+            tok->link = open;
+            start->link = n;
+            start->span.len = (size_t)(&buf[i] - start->span.buf) + 1;
+            open = parent;
+            i += 1;
+        } else if (expect == EXPECT_KEY || expect == EXPECT_KEY_OR_END) {
+            if (ch != '"') {
+                err = MU_JSON_ERR_SYNTAX;
+                break;
+            }
+            tok->kind = MU_JSON_KEY;
+            err = scan_string(buf, &i, len, &tok->span);
+            if (err != MU_JSON_ERR_NONE) {
+                break;
+            }
+            n += 1;
+            expect = EXPECT_COLON;
+            continue;
+        } else if (expect == EXPECT_COMMA_OR_END) {
+            err = MU_JSON_ERR_SYNTAX;
+            break;
+        } else if (ch == '{' || ch == '[') {
+            tok->kind = (ch == '{') ? MU_JSON_OBJECT_START
+                                    : MU_JSON_ARRAY_START;
+            tok->span = (mu_string_t){ .buf = &buf[i], .len = 1 };
+            tok->link = open;
+            open = n;
+            n += 1;
+            i += 1;
+            expect = (ch == '{') ? EXPECT_KEY_OR_END : EXPECT_VALUE_OR_END;
+            continue;
+        } else {
+            if (ch == '"') {
+                tok->kind = MU_JSON_STRING;
+                err = scan_string(buf, &i, len, &tok->span);
+            } else if (ch == '-' || IS_DIGIT(ch)) {
+                tok->kind = MU_JSON_NUMBER;
+                err = scan_number(buf, &i, len, &tok->span);
+            } else if (ch == 't') {
+                tok->kind = MU_JSON_TRUE;
+                err = scan_literal(buf, &i, len, "true", &tok->span);
+            } else if (ch == 'f') {
+                tok->kind = MU_JSON_FALSE;
+                err = scan_literal(buf, &i, len, "false", &tok->span);
+            } else if (ch == 'n') {
+                tok->kind = MU_JSON_NULL;
+                err = scan_literal(buf, &i, len, "null", &tok->span);
+            } else {
+                err = MU_JSON_ERR_SYNTAX;
+            }
+            if (err != MU_JSON_ERR_NONE) {
+                break;
+            }
+        }
+
+        // A complete value (scalar or closed container) was emitted.
+        n += 1;
+        expect = (open == NO_PARENT) ? EXPECT_DONE : EXPECT_COMMA_OR_END;
+    }
+
+    if (n_tokens) {
+        *n_tokens = n;
+    }
+    return err;
+}
+
+size_t mu_json_next(const mu_json_token_t *tape, size_t n_tokens, size_t index) {
+    if (tape == NULL || index >= n_tokens) {
+        return MU_JSON_NOT_FOUND;
+    }
+    switch (tape[index].kind) {
+    case MU_JSON_OBJECT_START:
+    case MU_JSON_ARRAY_START:
+        return tape[index].link + 1;
+    case MU_JSON_OBJECT_END:
+    case MU_JSON_ARRAY_END:
+        return MU_JSON_NOT_FOUND;
+    default:
+        return index + 1;
+    }
+}
+
+size_t mu_json_find_key(const mu_json_token_t *tape, size_t n_tokens,
+                        size_t object, mu_string_t key) {
+    if (tape == NULL || object >= n_tokens ||
+        tape[object].kind != MU_JSON_OBJECT_START) {
+        return MU_JSON_NOT_FOUND;
+    }
+    size_t end = tape[object].link;
+    size_t i = object + 1;
+    while (i < end) {
+        // tape[i] is a key and tape[i + 1] its value.
+        if (mu_string_eq(tape[i].span, key)) {
+            return i + 1;
+        }
+        i = mu_json_next(tape, n_tokens, i + 1);
+    }
+    return MU_JSON_NOT_FOUND;
+}
+
+mu_string_t mu_json_unescape(mu_string_mut_t dst, mu_string_t span) {
+    if (!mu_string_is_valid(span)) {
+        return MU_STRING_INVALID;
+    }
+    if (span.len == 0 || memchr(span.buf, '\\', span.len) == NULL) {
+        return span; // Common case: nothing to decode, no copy.
+    }
+    if (dst.buf == NULL) {
+        return MU_STRING_INVALID;
+    }
+
+    const char *s = span.buf;
+    size_t i = 0;
+    size_t out = 0;
+    while (i < span.len) {
+        char ch = s[i++];
+        uint32_t code;
+        if (ch != '\\') {
+            if (out == dst.len) {
+                return MU_STRING_INVALID;
+            }
+            dst.buf[out++] = ch;
+            continue;
+        }
+        if (i == span.len) {
+            return MU_STRING_INVALID;
+        }
+        switch (s[i++]) {
+        case '"': code = '"'; break;
+        case '\\': code = '\\'; break;
+        case '/': code = '/'; break;
+        case 'b': code = '\b'; break;
+        case 'f': code = '\f'; break;
+        case 'n': code = '\n'; break;
+        case 'r': code = '\r'; break;
+        case 't': code = '\t'; break;
+        case 'u':
+            if (span.len - i < 4 || !parse_hex4(&s[i], &code)) {
+                return MU_STRING_INVALID;
+            }
+            i += 4;
+            if (code >= 0xD800 && code <= 0xDBFF) {
+                // High surrogate: must be followed by an escaped low surrogate.
+                uint32_t low;
+                if (span.len - i < 6 || s[i] != '\\' || s[i + 1] != 'u' ||
+                    !parse_hex4(&s[i + 2], &low) || low < 0xDC00 ||
+                    low > 0xDFFF) {
+                    return MU_STRING_INVALID;
+                }
+                i += 6;
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                return MU_STRING_INVALID;
+            }
+            break;
+        default:
+            return MU_STRING_INVALID;
+        }
+
+        // Encode `code` as UTF-8.
+        char enc[4];
+        size_t n;
+        if (code < 0x80) {
+            enc[0] = (char)code;
+            n = 1;
+        } else if (code < 0x800) {
+            enc[0] = (char)(0xC0 | (code >> 6));
+            enc[1] = (char)(0x80 | (code & 0x3F));
+            n = 2;
+        } else if (code < 0x10000) {
+            enc[0] = (char)(0xE0 | (code >> 12));
+            enc[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+            enc[2] = (char)(0x80 | (code & 0x3F));
+            n = 3;
+        } else {
+            enc[0] = (char)(0xF0 | (code >> 18));
+            enc[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+            enc[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+            enc[3] = (char)(0x80 | (code & 0x3F));
+            n = 4;
+        }
+        if (dst.len - out < n) {
+            return MU_STRING_INVALID;
+        }
+        memcpy(&dst.buf[out], enc, n);
+        out += n;
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = out };
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t skip_whitespace(const char *buf, size_t i, size_t len) {
+    while (i < len && (buf[i] == ' ' || buf[i] == '\n' || buf[i] == '\r' ||
+                       buf[i] == '\t')) {
+        i += 1;
+    }
+    return i;
+}
+
+static mu_json_err_t scan_string(const char *buf, size_t *i, size_t len,
+                                 mu_string_t *span) {
+    size_t start = *i + 1;
+    size_t j = start;
+
+    while (j < len) {
+        uint8_t ch = (uint8_t)buf[j];
+        if (ch == '"') {
+            *span = (mu_string_t){ .buf = &buf[start], .len = j - start };
+            *i = j + 1;
+            return MU_JSON_ERR_NONE;
+        }
+        if (ch < 0x20) {
+            return MU_JSON_ERR_SYNTAX; // unescaped control character
+        }
+        if (ch != '\\') {
+            j += 1;
+            continue;
+        }
+        if (j + 1 >= len) {
+            return MU_JSON_ERR_INCOMPLETE;
+        }
+        switch (buf[j + 1]) {
+        case '"': case '\\': case '/': case 'b':
+        case 'f': case 'n': case 'r': case 't':
+            j += 2;
+            break;
+        case 'u': {
+            uint32_t code;
+            if (len - j < 6) {
+                return MU_JSON_ERR_INCOMPLETE;
+            }
+            if (!parse_hex4(&buf[j + 2], &code)) {
+                return MU_JSON_ERR_SYNTAX;
+            }
+            j += 6;
+            break;
+        }
+        default:
+            return MU_JSON_ERR_SYNTAX;
+        }
+    }
+    return MU_JSON_ERR_INCOMPLETE;
+}
+
+static mu_json_err_t scan_number(const char *buf, size_t *i, size_t len,
+                                 mu_string_t *span) {
+    size_t start = *i;
+    size_t j = start;
+
+    if (buf[j] == '-') {
+        j += 1;
+    }
+    if (j == len) {
+        return MU_JSON_ERR_INCOMPLETE;
+    }
+    if (buf[j] == '0') {
+        j += 1;
+    } else if (IS_DIGIT(buf[j])) {
+        while (j < len && IS_DIGIT(buf[j])) {
+            j += 1;
+        }
+    } else {
+        return MU_JSON_ERR_SYNTAX;
+    }
+    if (j < len && buf[j] == '.') {
+        j += 1;
+        if (j == len) {
+            return MU_JSON_ERR_INCOMPLETE;
+        }
+        if (!IS_DIGIT(buf[j])) {
+            return MU_JSON_ERR_SYNTAX;
+        }
+        while (j < len && IS_DIGIT(buf[j])) {
+            j += 1;
+        }
+    }
+    if (j < len && (buf[j] == 'e' || buf[j] == 'E')) {
+        j += 1;
+        if (j < len && (buf[j] == '+' || buf[j] == '-')) {
+            j += 1;
+        }
+        if (j == len) {
+            return MU_JSON_ERR_INCOMPLETE;
+        }
+        if (!IS_DIGIT(buf[j])) {
+            return MU_JSON_ERR_SYNTAX;
+        }
+        while (j < len && IS_DIGIT(buf[j])) {
+            j += 1;
+        }
+    }
+    *span = (mu_string_t){ .buf = &buf[start], .len = j - start };
+    *i = j;
+    return MU_JSON_ERR_NONE;
+}
+
+static mu_json_err_t scan_literal(const char *buf, size_t *i, size_t len,
+                                  const char *lit, mu_string_t *span) {
+    size_t lit_len = strlen(lit);
+    size_t avail = len - *i;
+
+    if (avail < lit_len) {
+        return (memcmp(&buf[*i], lit, avail) == 0) ? MU_JSON_ERR_INCOMPLETE
+                                                    : MU_JSON_ERR_SYNTAX;
+    }
+    if (memcmp(&buf[*i], lit, lit_len) != 0) {
+        return MU_JSON_ERR_SYNTAX;
+    }
+    *span = (mu_string_t){ .buf = &buf[*i], .len = lit_len };
+    *i += lit_len;
+    return MU_JSON_ERR_NONE;
+}
+
+static int hex_value(char ch) {
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+static bool parse_hex4(const char *s, uint32_t *code) {
+    uint32_t v = 0;
+    for (int k = 0; k < 4; ++k) {
+        int h = hex_value(s[k]);
+        if (h < 0) {
+            return false;
+        }
+        v = (v << 4) | (uint32_t)h;
+    }
+    *code = v;
+    return true;
+}
+
+// *****************************************************************************
+// End of file
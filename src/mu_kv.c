@@ -0,0 +1,238 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_kv.c
+ *
+ * @brief Implements the mu_kv key/value reader.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_kv.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define IS_BLANK(ch) ((ch) == ' ' || (ch) == '\t')
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Returns the index of the first `a` or `b` at or after `i`, or `len`.
+ */
+static size_t scan_either(const char *buf, size_t i, size_t len, char a, char b);
+
+/**
+ * @brief Returns `end` moved back over any trailing blanks, but not before
+ * `start`.
+ */
+static size_t trim_end(const char *buf, size_t start, size_t end);
+
+// *****************************************************************************
+// Public code
+
+mu_kv_reader_t *mu_kv_reader_init(mu_kv_reader_t *reader, mu_string_t input,
+                                  char pair_sep, char kv_sep, char quote) {
+    if (reader == NULL || !mu_string_is_valid(input)) {
+        return NULL;
+    }
+    reader->remaining = input;
+    reader->pair_sep = pair_sep;
+    reader->kv_sep = kv_sep;
+    reader->quote = quote;
+    return reader;
+}
+
+mu_kv_err_t mu_kv_next(mu_kv_reader_t *reader, mu_string_t *key,
+                       mu_string_t *value) {
+    if (reader == NULL || key == NULL || value == NULL ||
+        !mu_string_is_valid(reader->remaining)) {
+        return MU_KV_ERR_INVALID;
+    }
+
+    const char *buf = reader->remaining.buf;
+    const size_t len = reader->remaining.len;
+    const char pair_sep = reader->pair_sep;
+    const char kv_sep = reader->kv_sep;
+    const char quote = reader->quote;
+    size_t i = 0;
+
+    // Skip separators and blanks between pairs.
+    while (i < len && (buf[i] == pair_sep || IS_BLANK(buf[i]))) {
+        i += 1;
+    }
+    if (i == len) {
+        reader->remaining = (mu_string_t){ .buf = &buf[len], .len = 0 };
+        return MU_KV_ERR_END;
+    }
+    const size_t pair_start = i;
+
+    // Key: up to the key/value separator or the end of the pair.
+    size_t key_start = i;
+    if (IS_BLANK(pair_sep)) {
+        // logfmt: any blank ends the key.
+        while (i < len && buf[i] != kv_sep && !IS_BLANK(buf[i])) {
+            i += 1;
+        }
+        *key = (mu_string_t){ .buf = &buf[key_start], .len = i - key_start };
+    } else {
+        i = scan_either(buf, i, len, kv_sep, pair_sep);
+        *key = (mu_string_t){ .buf = &buf[key_start],
+                              .len = trim_end(buf, key_start, i) - key_start };
+    }
+
+    if (i == len || buf[i] != kv_sep) {
+        // Bare key with no value.
+        *value = (mu_string_t){ .buf = &buf[i], .len = 0 };
+        reader->remaining = (mu_string_t){ .buf = &buf[i], .len = len - i };
+        return MU_KV_ERR_NONE;
+    }
+    i += 1; // skip kv_sep
+
+    if (!IS_BLANK(pair_sep)) {
+        while (i < len && IS_BLANK(buf[i])) {
+            i += 1;
+        }
+    }
+
+    if (quote != '\0' && i < len && buf[i] == quote) {
+        size_t start = ++i;
+        for (;;) {
+            const char *q = memchr(&buf[i], quote, len - i);
+            if (q == NULL) {
+                reader->remaining =
+                    (mu_string_t){ .buf = &buf[pair_start], .len = len - pair_start };
+                return MU_KV_ERR_UNTERMINATED;
+            }
+            i = (size_t)(q - buf);
+            // Count the backslashes immediately before the quote: an odd
+            // number means the quote itself is escaped.
+            size_t k = i;
+            while (k > start && buf[k - 1] == '\\') {
+                k -= 1;
+            }
+            if (((i - k) & 1) == 0) {
+                break;
+            }
+            i += 1;
+        }
+        *value = (mu_string_t){ .buf = &buf[start], .len = i - start };
+        i += 1; // skip closing quote
+        if (i < len && buf[i] != pair_sep && !IS_BLANK(buf[i])) {
+            reader->remaining =
+                (mu_string_t){ .buf = &buf[pair_start], .len = len - pair_start };
+            return MU_KV_ERR_SYNTAX;
+        }
+    } else {
+        size_t start = i;
+        if (IS_BLANK(pair_sep)) {
+            while (i < len && !IS_BLANK(buf[i])) {
+                i += 1;
+            }
+        } else {
+            const char *sep = memchr(&buf[i], pair_sep, len - i);
+            i = (sep == NULL) ? len : (size_t)(sep - buf);
+        }
+        *value = (mu_string_t){ .buf = &buf[start],
+                                .len = trim_end(buf, start, i) - start };
+    }
+
+    reader->remaining = (mu_string_t){ .buf = &buf[i], .len = len - i };
+    return MU_KV_ERR_NONE;
+}
+
+mu_string_t mu_kv_find(mu_string_t input, char pair_sep, char kv_sep,
+                       char quote, mu_string_t key) {
+    mu_kv_reader_t reader;
+    mu_string_t k;
+    mu_string_t v;
+
+    if (mu_kv_reader_init(&reader, input, pair_sep, kv_sep, quote) == NULL) {
+        return MU_STRING_NOT_FOUND;
+    }
+    while (mu_kv_next(&reader, &k, &v) == MU_KV_ERR_NONE) {
+        if (mu_string_eq(k, key)) {
+            return v;
+        }
+    }
+    return MU_STRING_NOT_FOUND;
+}
+
+mu_string_t mu_kv_unescape(mu_string_mut_t dst, mu_string_t value) {
+    if (!mu_string_is_valid(value)) {
+        return MU_STRING_INVALID;
+    }
+    if (value.len == 0 || memchr(value.buf, '\\', value.len) == NULL) {
+        return value; // Common case: nothing to decode, no copy.
+    }
+    if (dst.buf == NULL) {
+        return MU_STRING_INVALID;
+    }
+
+    size_t out = 0;
+    for (size_t i = 0; i < value.len; ++i) {
+        char ch = value.buf[i];
+        if (ch == '\\') {
+            if (++i == value.len) {
+                return MU_STRING_INVALID;
+            }
+            ch = value.buf[i];
+        }
+        if (out == dst.len) {
+            return MU_STRING_INVALID;
+        }
+        dst.buf[out++] = ch;
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = out };
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t scan_either(const char *buf, size_t i, size_t len, char a, char b) {
+    while (i < len && buf[i] != a && buf[i] != b) {
+        i += 1;
+    }
+    return i;
+}
+
+static size_t trim_end(const char *buf, size_t start, size_t end) {
+    while (end > start && IS_BLANK(buf[end - 1])) {
+        end -= 1;
+    }
+    return end;
+}
+
+// *****************************************************************************
+// End of file
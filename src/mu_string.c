@@ -37,6 +37,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#if MU_STRING_STREAM_THRESHOLD && defined(__SSE2__)
+#include <emmintrin.h>
+#define MU_STRING_STREAM 1
+#else
+#define MU_STRING_STREAM 0
+#endif
+
 #ifndef INT_MAX
 #error INT_MAX is not defined
 #endif
@@ -50,6 +57,73 @@
 
 // Note: mu_string_is_valid is now public.
 
+#if MU_STRING_SWAR
+#define SWAR_ONES 0x0101010101010101ULL
+#define SWAR_LOW7 0x7F7F7F7F7F7F7F7FULL
+#define SWAR_HIGH 0x8080808080808080ULL
+#define SWAR_MISALIGN(p) ((uintptr_t)(p) & (sizeof(uint64_t) - 1))
+#endif
+
+/**
+ * @brief A set of bytes prepared once for repeated membership tests and
+ * scans.
+ */
+typedef struct {
+    uint8_t member[32]; ///< One bit per byte value.
+#if MU_STRING_SWAR
+    uint64_t pattern[4]; ///< Members repeated in every byte, when `small`.
+    uint64_t bound;      ///< Largest member + 1 in every byte, or 0.
+    bool small;          ///< The set has one to four members.
+#endif
+} mu_string_byte_set_t;
+
+/**
+ * @brief What mu_string_filter() does with a run of bytes from its set.
+ */
+typedef enum {
+    MU_STRING_FILTER_REMOVE,   ///< Drop the run.
+    MU_STRING_FILTER_SQUEEZE,  ///< Keep one of each run of a repeated byte.
+    MU_STRING_FILTER_COLLAPSE, ///< Replace the run with one space.
+} mu_string_filter_mode_t;
+
+#if MU_STRING_SWAR
+/**
+ * @brief A run of consecutive ASCII bytes that a translation table changes
+ * in the same way, as constants for a branch-free word step.
+ *
+ * With `m` set to 1 in each byte of the run, a word becomes
+ * `((w & ~(m * clear)) | (set & m * clear)) + m * add - m * sub`: a shifted
+ * run has one of `add` and `sub`, a run mapped to a constant has `clear` and
+ * `set`.  A zeroed run matches no bytes.
+ */
+typedef struct {
+    uint64_t ge_lo; ///< Added to the low 7 bits: high bit set if >= first.
+    uint64_t gt_hi; ///< Added to the low 7 bits: high bit set if > last.
+    uint64_t clear; ///< 0xFF for a run mapped to a constant, else 0.
+    uint64_t set;   ///< The constant, in every byte.
+    uint64_t add;   ///< Offset to add.
+    uint64_t sub;   ///< Offset to subtract.
+} mu_string_translate_run_t;
+#endif
+
+/**
+ * @brief The bytes mu_string_collapse_space() treats as white space.
+ */
+#define SPACE_SET                                                              \
+    (mu_string_t) { .buf = " \t\n\v\f\r", .len = 6 }
+
+/**
+ * @brief Most runs of changed bytes a translation table may have and still
+ * be applied a word at a time.
+ */
+#define TRANSLATE_MAX_RUNS 2
+
+/**
+ * @brief Views shorter than this are translated without looking at the
+ * table's shape first.
+ */
+#define TRANSLATE_MIN_ANALYZE 64
+
 // *****************************************************************************
 // Private (static) storage
 
@@ -73,6 +147,171 @@ static mu_string_t mu_string_split_handle_result(mu_string_t s,
                                                  mu_string_t *after,
                                                  size_t found_idx);
 
+/**
+ * @brief Returns the index of the first `c` in buf[0..len), or `len`.
+ */
+static size_t mu_string_scan_char(const char *buf, size_t len, char c);
+
+/**
+ * @brief Returns the index of the last `c` in buf[0..len), or `len`.
+ */
+static size_t mu_string_rscan_char(const char *buf, size_t len, char c);
+
+/**
+ * @brief Returns the number of bytes in buf[0..len) equal to `c`.
+ */
+static size_t mu_string_count_bytes(const char *buf, size_t len, char c);
+
+/**
+ * @brief Prepares the bytes of `set`, which must be valid, for
+ * mu_string_byte_set_has() and mu_string_byte_set_scan().
+ */
+static void mu_string_byte_set_init(mu_string_byte_set_t *bs, mu_string_t set);
+
+static inline bool mu_string_byte_set_has(const mu_string_byte_set_t *bs,
+                                          unsigned char ch);
+
+/**
+ * @brief Returns the index of the first byte of buf[0..len) in the set, or
+ * `len`.
+ *
+ * Words of eight bytes are screened first.  Sets of up to four bytes are
+ * tested exactly; larger sets whose members are all ASCII pass over any word
+ * with no byte below the largest member, such as plain text when looking for
+ * control characters.  Other words are tested a byte at a time against the
+ * bitmap.
+ */
+static size_t mu_string_byte_set_scan(const mu_string_byte_set_t *bs,
+                                      const char *buf, size_t len);
+
+/**
+ * @brief Copies `src` to `dst`, treating runs of bytes from `set` as `mode`
+ * directs.  `dst.buf` may equal `src.buf`.
+ */
+static mu_string_t mu_string_filter(mu_string_mut_t dst, mu_string_t src,
+                                    mu_string_t set,
+                                    mu_string_filter_mode_t mode);
+
+/**
+ * @brief Maps `n` bytes from `src` to `dst` through `table`.  `dst` may equal
+ * `src`.
+ */
+static void mu_string_translate_bytes(char *dst, const char *src, size_t n,
+                                      const uint8_t table[256]);
+
+#if MU_STRING_SWAR
+/**
+ * @brief Replaces the bytes of `out` whose source bytes in `w` fall in `run`
+ * with their translation.
+ */
+static inline uint64_t
+mu_string_translate_word(uint64_t w, const mu_string_translate_run_t *run,
+                         uint64_t out);
+
+/**
+ * @brief Describes `table` as at most TRANSLATE_MAX_RUNS runs of ASCII bytes
+ * that are each shifted by a constant or mapped to a constant, with all
+ * other bytes unchanged.
+ *
+ * @return The number of runs (0 for the identity), or -1 if the table has
+ * some other shape.
+ */
+static int mu_string_translate_analyze(const uint8_t table[256],
+                                       mu_string_translate_run_t *runs);
+#endif
+
+/**
+ * @brief Returns true if the `n` bytes at `a` and `b` are equal.
+ */
+static inline bool mu_string_bytes_eq(const char *a, const char *b, size_t n);
+
+/**
+ * @brief Compares `n` bytes at `a` and `b` as unsigned chars, returning a
+ * result with the same sign as memcmp().
+ */
+static inline int mu_string_bytes_cmp(const char *a, const char *b, size_t n);
+
+/**
+ * @brief Returns the length of the common prefix of the `n` bytes at `a` and
+ * `b`.
+ */
+static size_t mu_string_prefix_bytes(const char *a, const char *b, size_t n);
+
+/**
+ * @brief Compares a valid `elem` with a valid `key` whose first `skip` bytes
+ * are known to match, as mu_string_cmp(elem, key).  Stores the length of
+ * their common prefix in `*lcp`.
+ */
+static int mu_string_cmp_from(mu_string_t elem, mu_string_t key, size_t skip,
+                              size_t *lcp);
+
+/**
+ * @brief Copies `n` bytes from `src` to `dst`, choosing memcpy(), memmove()
+ * or streaming stores by size and overlap.
+ */
+static void mu_string_copy_bytes(char *dst, const char *src, size_t n);
+
+#if MU_STRING_STREAM
+/**
+ * @brief Copies `n` bytes between non-overlapping buffers with non-temporal
+ * stores.
+ */
+static void mu_string_stream_copy(char *dst, const char *src, size_t n);
+#endif
+
+/**
+ * @brief Maps A-Z to a-z and leaves other bytes unchanged.
+ */
+static inline unsigned char mu_string_fold(unsigned char ch);
+
+#if MU_STRING_SWAR
+/**
+ * @brief Loads eight bytes from `p`, which need not be aligned.
+ */
+static inline uint64_t mu_string_swar_load(const char *p);
+
+/**
+ * @brief Loads four bytes from `p`, which need not be aligned.
+ */
+static inline uint32_t mu_string_swar_load32(const char *p);
+
+/**
+ * @brief Loads eight bytes from `p` as a big-endian word, so that comparing
+ * two such words as integers orders them as memcmp() would.
+ */
+static inline uint64_t mu_string_swar_load_be(const char *p);
+
+/**
+ * @brief As mu_string_swar_load_be(), for four bytes.
+ */
+static inline uint32_t mu_string_swar_load_be32(const char *p);
+
+/**
+ * @brief Returns -1, 0 or 1 as `x` is less than, equal to or greater than `y`.
+ */
+static inline int mu_string_swar_order(uint64_t x, uint64_t y);
+
+/**
+ * @brief Returns the offset of the first nonzero byte, in memory order, of a
+ * word read with mu_string_swar_load().  `x` must not be zero.
+ */
+static inline size_t mu_string_swar_first_byte(uint64_t x);
+
+/**
+ * @brief Returns a word with the high bit set in each byte that is zero in
+ * `x`, and all other bits clear.
+ *
+ * Unlike the shorter `(x - 0x01..) & ~x & 0x80..`, there are no false hits
+ * from borrows, so the result can be counted as well as tested.
+ */
+static inline uint64_t mu_string_swar_zero_bytes(uint64_t x);
+
+/**
+ * @brief Applies mu_string_fold() to each byte of `x`.
+ */
+static inline uint64_t mu_string_swar_fold(uint64_t x);
+#endif
+
 // *****************************************************************************
 // Public code
 
@@ -153,11 +392,8 @@ bool mu_string_eq(mu_string_t s1, mu_string_t s2) {
     if (s1.len != s2.len) {
         return false;
     }
-    if (s1.len == 0) {
-        return true; // Both empty and valid
-    }
-    // Valid, non-empty, same length - compare content
-    return memcmp(s1.buf, s2.buf, s1.len) == 0;
+    // Valid, same length - compare content (trivially equal when empty)
+    return mu_string_bytes_eq(s1.buf, s2.buf, s1.len);
 }
 
 int mu_string_cmp(mu_string_t s1, mu_string_t s2) {
@@ -168,25 +404,81 @@ int mu_string_cmp(mu_string_t s1, mu_string_t s2) {
     if (!s1_is_valid) return -1; // Invalid < valid
     if (!s2_is_valid) return 1; // Valid > invalid
 
-    // Handle comparison with empty strings explicitly for clarity, though memcmp/length check covers it
-    if (s1.len == 0 && s2.len == 0) return 0;
-    if (s1.len == 0) return -1; // Empty < non-empty
-    if (s2.len == 0) return 1; // Non-empty > empty
-
-
+    // Empty views need no special case: they compare zero bytes and are then
+    // ordered by length.
     size_t min_len = (s1.len < s2.len) ? s1.len : s2.len;
-    int cmp_result = memcmp(s1.buf, s2.buf, min_len);
+    int cmp_result = mu_string_bytes_cmp(s1.buf, s2.buf, min_len);
 
     if (cmp_result != 0) {
         return cmp_result;
     }
-    // Content is equal up to min_len, compare lengths
+    // Content is equal up to min_len: the shorter is less
+    return (s1.len > s2.len) - (s1.len < s2.len);
+}
+
+
+bool mu_string_eq_nocase(mu_string_t s1, mu_string_t s2) {
+    bool s1_is_valid = mu_string_is_valid(s1);
+    bool s2_is_valid = mu_string_is_valid(s2);
+
+    if (!s1_is_valid || !s2_is_valid) {
+        return !s1_is_valid == !s2_is_valid; // Both must be invalid to be equal
+    }
+    if (s1.len != s2.len) {
+        return false;
+    }
+
+    size_t i = 0;
+#if MU_STRING_SWAR
+    for (; i + 8 <= s1.len; i += 8) {
+        uint64_t a = mu_string_swar_load(s1.buf + i);
+        uint64_t b = mu_string_swar_load(s2.buf + i);
+        if (a != b && mu_string_swar_fold(a) != mu_string_swar_fold(b)) {
+            return false;
+        }
+    }
+#endif
+    for (; i < s1.len; i++) {
+        if (mu_string_fold((unsigned char)s1.buf[i]) !=
+            mu_string_fold((unsigned char)s2.buf[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int mu_string_cmp_nocase(mu_string_t s1, mu_string_t s2) {
+    bool s1_is_valid = mu_string_is_valid(s1);
+    bool s2_is_valid = mu_string_is_valid(s2);
+
+    if (!s1_is_valid && !s2_is_valid) return 0; // Invalid == Invalid
+    if (!s1_is_valid) return -1; // Invalid < valid
+    if (!s2_is_valid) return 1; // Valid > invalid
+
+    size_t min_len = (s1.len < s2.len) ? s1.len : s2.len;
+    size_t i = 0;
+#if MU_STRING_SWAR
+    // Skip whole words that match; the byte loop below finds the difference.
+    for (; i + 8 <= min_len; i += 8) {
+        uint64_t a = mu_string_swar_load(s1.buf + i);
+        uint64_t b = mu_string_swar_load(s2.buf + i);
+        if (a != b && mu_string_swar_fold(a) != mu_string_swar_fold(b)) {
+            break;
+        }
+    }
+#endif
+    for (; i < min_len; i++) {
+        int a = mu_string_fold((unsigned char)s1.buf[i]);
+        int b = mu_string_fold((unsigned char)s2.buf[i]);
+        if (a != b) {
+            return a - b;
+        }
+    }
     if (s1.len < s2.len) return -1; // shorter is less
     if (s1.len > s2.len) return 1; // longer is greater
-    return 0; // lengths are equal, and content was equal
+    return 0;
 }
 
-
 bool mu_string_starts_with(mu_string_t s, mu_string_t prefix) {
     if (!mu_string_is_valid(s) || !mu_string_is_valid(prefix)) {
         return false; // Invalid inputs
@@ -201,7 +493,7 @@ bool mu_string_starts_with(mu_string_t s, mu_string_t prefix) {
     if (s.len == 0) return false; // Non-empty prefix cannot start an empty string
 
 
-    return memcmp(s.buf, prefix.buf, prefix.len) == 0;
+    return mu_string_bytes_eq(s.buf, prefix.buf, prefix.len);
 }
 
 bool mu_string_ends_with(mu_string_t s, mu_string_t suffix) {
@@ -217,19 +509,55 @@ bool mu_string_ends_with(mu_string_t s, mu_string_t suffix) {
      // Handle empty string case explicitly although len check covers it
     if (s.len == 0) return false; // Non-empty suffix cannot end an empty string
 
-    return memcmp(s.buf + s.len - suffix.len, suffix.buf, suffix.len) == 0;
+    return mu_string_bytes_eq(s.buf + s.len - suffix.len, suffix.buf, suffix.len);
+}
+
+
+size_t mu_string_common_prefix_len(mu_string_t s1, mu_string_t s2) {
+    if (!mu_string_is_valid(s1) || !mu_string_is_valid(s2)) {
+        return 0;
+    }
+    size_t min_len = (s1.len < s2.len) ? s1.len : s2.len;
+    return mu_string_prefix_bytes(s1.buf, s2.buf, min_len);
 }
 
+size_t mu_string_lower_bound(const mu_string_t *sorted, size_t n,
+                             mu_string_t key) {
+    if (sorted == NULL || !mu_string_is_valid(key)) {
+        return 0; // MU_STRING_INVALID sorts before everything
+    }
+    size_t lo = 0;
+    size_t hi = n;
+    size_t lo_lcp = 0; // prefix shared with sorted[lo - 1], which is < key
+    size_t hi_lcp = 0; // prefix shared with sorted[hi], which is >= key
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t lcp = 0;
+        int c = -1; // an invalid element is less than any valid key
+        if (mu_string_is_valid(sorted[mid])) {
+            size_t skip = (lo_lcp < hi_lcp) ? lo_lcp : hi_lcp;
+            c = mu_string_cmp_from(sorted[mid], key, skip, &lcp);
+        }
+        if (c < 0) {
+            lo = mid + 1;
+            lo_lcp = lcp;
+        } else {
+            hi = mid;
+            hi_lcp = lcp;
+        }
+    }
+    return lo;
+}
 
 mu_string_t mu_string_find_char(mu_string_t s, char c) {
     if (!mu_string_is_valid(s)) return MU_STRING_INVALID;
     if (s.len == 0) return MU_STRING_EMPTY;
 
-    for (size_t i = 0; i < s.len; ++i) {
-        if (s.buf[i] == c) {
-            // Return view from found character to the end
-            return (mu_string_t){ .buf = s.buf + i, .len = s.len - i };
-        }
+    size_t i = mu_string_scan_char(s.buf, s.len, c);
+    if (i < s.len) {
+        // Return view from found character to the end
+        return (mu_string_t){ .buf = s.buf + i, .len = s.len - i };
     }
     return MU_STRING_EMPTY; // Not found
 }
@@ -238,12 +566,28 @@ mu_string_t mu_string_rfind_char(mu_string_t s, char c) {
     if (!mu_string_is_valid(s)) return MU_STRING_INVALID;
     if (s.len == 0) return MU_STRING_EMPTY;
 
-    // Iterate backwards using signed int index to handle i >= 0 condition easily
-    for (int i = (int)s.len - 1; i >= 0; --i) {
-        if (s.buf[i] == c) {
-            // Return view from found character to the end
-            return (mu_string_t){ .buf = s.buf + i, .len = s.len - (size_t)i };
-        }
+    size_t i = mu_string_rscan_char(s.buf, s.len, c);
+    if (i < s.len) {
+        // Return view from found character to the end
+        return (mu_string_t){ .buf = s.buf + i, .len = s.len - i };
+    }
+    return MU_STRING_EMPTY; // Not found
+}
+
+size_t mu_string_count_char(mu_string_t s, char c) {
+    if (!mu_string_is_valid(s) || s.len == 0) return 0;
+    return mu_string_count_bytes(s.buf, s.len, c);
+}
+
+mu_string_t mu_string_find_any(mu_string_t s, mu_string_t set) {
+    if (!mu_string_is_valid(s) || !mu_string_is_valid(set)) return MU_STRING_INVALID;
+    if (s.len == 0 || set.len == 0) return MU_STRING_EMPTY;
+
+    mu_string_byte_set_t bs;
+    mu_string_byte_set_init(&bs, set);
+    size_t i = mu_string_byte_set_scan(&bs, s.buf, s.len);
+    if (i < s.len) {
+        return (mu_string_t){ .buf = s.buf + i, .len = s.len - i };
     }
     return MU_STRING_EMPTY; // Not found
 }
@@ -520,7 +864,7 @@ mu_string_t mu_string_copy(mu_string_mut_t dst, mu_string_t src) {
 
     // Perform the copy
     if (bytes_to_copy > 0) {
-        memcpy(dst.buf, src.buf, bytes_to_copy);
+        mu_string_copy_bytes(dst.buf, src.buf, bytes_to_copy);
     }
 
     // Return a view of the data that was actually copied
@@ -545,7 +889,7 @@ mu_string_mut_t mu_string_append(mu_string_mut_t dst_segment, mu_string_t src) {
 
     // Perform the copy
     if (bytes_to_copy > 0) {
-        memcpy(dst_segment.buf, src.buf, bytes_to_copy);
+        mu_string_copy_bytes(dst_segment.buf, src.buf, bytes_to_copy);
     }
 
     // Return a view of the remaining space
@@ -553,6 +897,165 @@ mu_string_mut_t mu_string_append(mu_string_mut_t dst_segment, mu_string_t src) {
 }
 
 
+mu_string_t mu_string_remove_set(mu_string_mut_t dst, mu_string_t src,
+                                 mu_string_t set) {
+    return mu_string_filter(dst, src, set, MU_STRING_FILTER_REMOVE);
+}
+
+mu_string_t mu_string_squeeze(mu_string_mut_t dst, mu_string_t src,
+                              mu_string_t set) {
+    return mu_string_filter(dst, src, set, MU_STRING_FILTER_SQUEEZE);
+}
+
+mu_string_t mu_string_collapse_space(mu_string_mut_t dst, mu_string_t src) {
+    return mu_string_filter(dst, src, SPACE_SET, MU_STRING_FILTER_COLLAPSE);
+}
+
+mu_string_t mu_string_mut_remove_set(mu_string_mut_t dst, size_t used,
+                                     mu_string_t set) {
+    if (used > dst.len) {
+        return MU_STRING_INVALID;
+    }
+    mu_string_t src = { .buf = dst.buf, .len = used };
+    return mu_string_filter(dst, src, set, MU_STRING_FILTER_REMOVE);
+}
+
+mu_string_t mu_string_mut_squeeze(mu_string_mut_t dst, size_t used,
+                                  mu_string_t set) {
+    if (used > dst.len) {
+        return MU_STRING_INVALID;
+    }
+    mu_string_t src = { .buf = dst.buf, .len = used };
+    return mu_string_filter(dst, src, set, MU_STRING_FILTER_SQUEEZE);
+}
+
+mu_string_t mu_string_mut_collapse_space(mu_string_mut_t dst, size_t used) {
+    if (used > dst.len) {
+        return MU_STRING_INVALID;
+    }
+    mu_string_t src = { .buf = dst.buf, .len = used };
+    return mu_string_filter(dst, src, SPACE_SET,
+                            MU_STRING_FILTER_COLLAPSE);
+}
+
+mu_string_t mu_string_translate(mu_string_mut_t dst, mu_string_t src,
+                                const uint8_t table[256]) {
+    if (dst.buf == NULL || !mu_string_is_valid(src) || table == NULL ||
+        dst.len < src.len) {
+        return MU_STRING_INVALID;
+    }
+    mu_string_translate_bytes(dst.buf, src.buf, src.len, table);
+    return (mu_string_t){ .buf = dst.buf, .len = src.len };
+}
+
+mu_string_t mu_string_mut_translate(mu_string_mut_t dst, size_t used,
+                                    const uint8_t table[256]) {
+    if (dst.buf == NULL || used > dst.len || table == NULL) {
+        return MU_STRING_INVALID;
+    }
+    mu_string_translate_bytes(dst.buf, dst.buf, used, table);
+    return (mu_string_t){ .buf = dst.buf, .len = used };
+}
+
+mu_string_t mu_string_mut_splice(mu_string_mut_t dst, size_t used, size_t pos,
+                                 size_t count, mu_string_t src) {
+    if (dst.buf == NULL || used > dst.len || pos > used ||
+        !mu_string_is_valid(src)) {
+        return MU_STRING_INVALID;
+    }
+    if (count > used - pos) {
+        count = used - pos;
+    }
+    if (src.len > dst.len - (used - count)) {
+        return MU_STRING_INVALID; // would not fit
+    }
+    size_t tail = used - pos - count;
+    if (src.len != count && tail > 0) {
+        memmove(dst.buf + pos + src.len, dst.buf + pos + count, tail);
+    }
+    if (src.len > 0) {
+        memcpy(dst.buf + pos, src.buf, src.len);
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = used - count + src.len };
+}
+
+mu_string_t mu_string_mut_insert(mu_string_mut_t dst, size_t used, size_t pos,
+                                 mu_string_t src) {
+    return mu_string_mut_splice(dst, used, pos, 0, src);
+}
+
+mu_string_t mu_string_mut_erase(mu_string_mut_t dst, size_t used, size_t pos,
+                                size_t count) {
+    return mu_string_mut_splice(dst, used, pos, count, MU_STRING_EMPTY);
+}
+
+mu_string_t mu_string_mut_apply_edits(mu_string_mut_t dst, size_t used,
+                                      const mu_string_edit_t *edits,
+                                      size_t n_edits) {
+    if (dst.buf == NULL || used > dst.len || (edits == NULL && n_edits > 0)) {
+        return MU_STRING_INVALID;
+    }
+    // Check everything before touching the buffer, and find the final length.
+    size_t end = 0; // end of the previous edit
+    size_t final_len = used;
+    for (size_t i = 0; i < n_edits; i++) {
+        const mu_string_edit_t *e = &edits[i];
+        if (e->pos < end || e->pos > used || e->count > used - e->pos ||
+            !mu_string_is_valid(e->text)) {
+            return MU_STRING_INVALID;
+        }
+        end = e->pos + e->count;
+        final_len -= e->count;
+        if (e->text.len > SIZE_MAX - final_len) {
+            return MU_STRING_INVALID;
+        }
+        final_len += e->text.len;
+    }
+    if (final_len > dst.len) {
+        return MU_STRING_INVALID; // would not fit
+    }
+
+    // The content between edits moves by the net size change of the edits
+    // before it.  Runs moving left are moved in ascending order and runs
+    // moving right in descending order: either way, a run's destination
+    // never covers content that has yet to be moved.
+    size_t shift_left = 0;  // running totals of bytes removed and inserted
+    size_t shift_right = 0;
+    for (size_t i = 0; i < n_edits; i++) {
+        shift_left += edits[i].count;
+        shift_right += edits[i].text.len;
+        size_t from = edits[i].pos + edits[i].count;
+        size_t to_end = (i + 1 < n_edits) ? edits[i + 1].pos : used;
+        if (shift_right < shift_left && to_end > from) {
+            size_t to = from - (shift_left - shift_right);
+            memmove(dst.buf + to, dst.buf + from, to_end - from);
+        }
+    }
+    for (size_t i = n_edits; i-- > 0;) {
+        size_t from = edits[i].pos + edits[i].count;
+        size_t to_end = (i + 1 < n_edits) ? edits[i + 1].pos : used;
+        if (shift_right > shift_left && to_end > from) {
+            size_t to = from + (shift_right - shift_left);
+            memmove(dst.buf + to, dst.buf + from, to_end - from);
+        }
+        shift_left -= edits[i].count;
+        shift_right -= edits[i].text.len;
+    }
+
+    // With every run in place, the replacement text fills the gaps.
+    size_t out = 0; // edited output position of the start of the run
+    size_t in = 0;  // original position of the start of the run
+    for (size_t i = 0; i < n_edits; i++) {
+        out += edits[i].pos - in;
+        if (edits[i].text.len > 0) {
+            memcpy(dst.buf + out, edits[i].text.buf, edits[i].text.len);
+        }
+        out += edits[i].text.len;
+        in = edits[i].pos + edits[i].count;
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = final_len };
+}
+
 // *****************************************************************************
 // Private (static) code
 
@@ -577,5 +1080,534 @@ static mu_string_t mu_string_split_handle_result(mu_string_t s,
     return s;
 }
 
+// The word loops below only read whole words inside [buf, buf + len), and
+// leave any word containing a hit to the byte loop that follows them.
+
+static size_t mu_string_scan_char(const char *buf, size_t len, char c) {
+    size_t i = 0;
+#if MU_STRING_SWAR
+    const uint64_t pattern = (unsigned char)c * SWAR_ONES;
+    for (; i < len && SWAR_MISALIGN(buf + i); i++) {
+        if (buf[i] == c) return i;
+    }
+    for (; i + 8 <= len; i += 8) {
+        if (mu_string_swar_zero_bytes(mu_string_swar_load(buf + i) ^ pattern)) {
+            break;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (buf[i] == c) return i;
+    }
+    return len;
+}
+
+static size_t mu_string_rscan_char(const char *buf, size_t len, char c) {
+    size_t i = len;
+#if MU_STRING_SWAR
+    const uint64_t pattern = (unsigned char)c * SWAR_ONES;
+    while (i > 0 && SWAR_MISALIGN(buf + i)) {
+        if (buf[--i] == c) return i;
+    }
+    for (; i >= 8; i -= 8) {
+        if (mu_string_swar_zero_bytes(mu_string_swar_load(buf + i - 8) ^ pattern)) {
+            break;
+        }
+    }
+#endif
+    while (i > 0) {
+        if (buf[--i] == c) return i;
+    }
+    return len;
+}
+
+static size_t mu_string_count_bytes(const char *buf, size_t len, char c) {
+    size_t i = 0;
+    size_t count = 0;
+#if MU_STRING_SWAR
+    const uint64_t pattern = (unsigned char)c * SWAR_ONES;
+    for (; i < len && SWAR_MISALIGN(buf + i); i++) {
+        count += (buf[i] == c);
+    }
+    for (; i + 8 <= len; i += 8) {
+        uint64_t hits = mu_string_swar_zero_bytes(mu_string_swar_load(buf + i) ^ pattern);
+        // One bit per hit at the top of its byte: sum them into the top byte.
+        count += (size_t)(((hits >> 7) * SWAR_ONES) >> 56);
+    }
+#endif
+    for (; i < len; i++) {
+        count += (buf[i] == c);
+    }
+    return count;
+}
+
+static void mu_string_byte_set_init(mu_string_byte_set_t *bs, mu_string_t set) {
+    unsigned max = 0;
+    memset(bs->member, 0, sizeof(bs->member));
+    for (size_t k = 0; k < set.len; k++) {
+        unsigned char ch = (unsigned char)set.buf[k];
+        bs->member[ch >> 3] |= (uint8_t)(1u << (ch & 7));
+        max = (ch > max) ? ch : max;
+    }
+#if MU_STRING_SWAR
+    bs->small = set.len > 0 && set.len <= 4;
+    for (size_t k = 0; bs->small && k < 4; k++) {
+        // Repeat members to fill four patterns: no branches on set size.
+        bs->pattern[k] = (unsigned char)set.buf[k % set.len] * SWAR_ONES;
+    }
+    bs->bound = (set.len > 0 && max < 0x80) ? (max + 1) * SWAR_ONES : 0;
+#else
+    (void)max;
+#endif
+}
+
+static inline bool mu_string_byte_set_has(const mu_string_byte_set_t *bs,
+                                          unsigned char ch) {
+    return (bs->member[ch >> 3] >> (ch & 7)) & 1u;
+}
+
+static size_t mu_string_byte_set_scan(const mu_string_byte_set_t *bs,
+                                      const char *buf, size_t len) {
+    size_t i = 0;
+#if MU_STRING_SWAR
+    if (bs->small || bs->bound) {
+        for (; i < len && SWAR_MISALIGN(buf + i); i++) {
+            if (mu_string_byte_set_has(bs, (unsigned char)buf[i])) return i;
+        }
+        for (; i + 8 <= len; i += 8) {
+            uint64_t w = mu_string_swar_load(buf + i);
+            uint64_t hit;
+            if (bs->small) {
+                hit = mu_string_swar_zero_bytes(w ^ bs->pattern[0]) |
+                      mu_string_swar_zero_bytes(w ^ bs->pattern[1]) |
+                      mu_string_swar_zero_bytes(w ^ bs->pattern[2]) |
+                      mu_string_swar_zero_bytes(w ^ bs->pattern[3]);
+            } else {
+                hit = (w - bs->bound) & ~w & SWAR_HIGH; // some byte < bound
+            }
+            if (hit == 0) {
+                continue;
+            }
+            for (size_t k = 0; k < 8; k++) {
+                if (mu_string_byte_set_has(bs, (unsigned char)buf[i + k])) {
+                    return i + k;
+                }
+            }
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (mu_string_byte_set_has(bs, (unsigned char)buf[i])) return i;
+    }
+    return len;
+}
+
+static mu_string_t mu_string_filter(mu_string_mut_t dst, mu_string_t src,
+                                    mu_string_t set,
+                                    mu_string_filter_mode_t mode) {
+    if (dst.buf == NULL || !mu_string_is_valid(src) || !mu_string_is_valid(set)) {
+        return MU_STRING_INVALID;
+    }
+    mu_string_byte_set_t bs;
+    mu_string_byte_set_init(&bs, set);
+    size_t out = 0;
+    size_t i = 0;
+
+    while (i < src.len) {
+        // Move the run up to the next byte from the set as a block: in place,
+        // nothing moves until the first such byte.
+        size_t run = (set.len == 0) ? src.len - i
+                                    : mu_string_byte_set_scan(&bs, src.buf + i,
+                                                              src.len - i);
+        bool more = i + run < src.len;
+        if (run + (more && mode != MU_STRING_FILTER_REMOVE) > dst.len - out) {
+            return MU_STRING_INVALID; // does not fit
+        }
+        if (run > 0 && dst.buf + out != src.buf + i) {
+            memmove(dst.buf + out, src.buf + i, run);
+        }
+        out += run;
+        i += run;
+        if (!more) {
+            break;
+        }
+
+        unsigned char ch = (unsigned char)src.buf[i++];
+        switch (mode) {
+        case MU_STRING_FILTER_REMOVE:
+            while (i < src.len && mu_string_byte_set_has(&bs, (unsigned char)src.buf[i])) {
+                i += 1;
+            }
+            break;
+        case MU_STRING_FILTER_SQUEEZE:
+            dst.buf[out++] = (char)ch;
+            while (i < src.len && (unsigned char)src.buf[i] == ch) {
+                i += 1;
+            }
+            break;
+        case MU_STRING_FILTER_COLLAPSE:
+            dst.buf[out++] = ' ';
+            while (i < src.len && mu_string_byte_set_has(&bs, (unsigned char)src.buf[i])) {
+                i += 1;
+            }
+            break;
+        }
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = out };
+}
+
+static inline bool mu_string_bytes_eq(const char *a, const char *b, size_t n) {
+#if MU_STRING_SWAR
+    // Most views compared are short, where a call to memcmp() costs more than
+    // the comparison.  Each size class is covered by two (or four) loads that
+    // overlap as needed, so no byte outside [0, n) is ever read.
+    if (n <= 32) {
+        if (n >= 16) {
+            uint64_t d = (mu_string_swar_load(a) ^ mu_string_swar_load(b)) |
+                         (mu_string_swar_load(a + 8) ^ mu_string_swar_load(b + 8)) |
+                         (mu_string_swar_load(a + n - 16) ^
+                          mu_string_swar_load(b + n - 16)) |
+                         (mu_string_swar_load(a + n - 8) ^
+                          mu_string_swar_load(b + n - 8));
+            return d == 0;
+        }
+        if (n >= 8) {
+            uint64_t d = (mu_string_swar_load(a) ^ mu_string_swar_load(b)) |
+                         (mu_string_swar_load(a + n - 8) ^
+                          mu_string_swar_load(b + n - 8));
+            return d == 0;
+        }
+        if (n >= 4) {
+            uint32_t d = (mu_string_swar_load32(a) ^ mu_string_swar_load32(b)) |
+                         (mu_string_swar_load32(a + n - 4) ^
+                          mu_string_swar_load32(b + n - 4));
+            return d == 0;
+        }
+        if (n > 0) {
+            // Bytes 0, n/2 and n-1 cover every length from 1 to 3.
+            unsigned d = (unsigned)((a[0] ^ b[0]) | (a[n / 2] ^ b[n / 2]) |
+                                    (a[n - 1] ^ b[n - 1]));
+            return d == 0;
+        }
+        return true;
+    }
+#endif
+    return n == 0 || memcmp(a, b, n) == 0;
+}
+
+static inline int mu_string_bytes_cmp(const char *a, const char *b, size_t n) {
+#if MU_STRING_SWAR
+    // As mu_string_bytes_eq(), but with big-endian loads so that the first
+    // differing byte decides the integer comparison.  Where loads overlap,
+    // the shared bytes have already been found equal by the earlier load.
+    if (n <= 32) {
+        if (n >= 8) {
+            // Words at 0, 8, n-16 and n-8 cover 16..32 bytes in order;
+            // 8..16 needs only the first and last.  Pick the first pair
+            // that differs, which compiles to selects rather than branches.
+            uint64_t x = mu_string_swar_load_be(a);
+            uint64_t y = mu_string_swar_load_be(b);
+            if (n > 16) {
+                uint64_t x1 = mu_string_swar_load_be(a + 8);
+                uint64_t y1 = mu_string_swar_load_be(b + 8);
+                uint64_t x2 = mu_string_swar_load_be(a + n - 16);
+                uint64_t y2 = mu_string_swar_load_be(b + n - 16);
+                bool same = x == y;
+                x = same ? x1 : x;
+                y = same ? y1 : y;
+                same = x == y;
+                x = same ? x2 : x;
+                y = same ? y2 : y;
+            }
+            uint64_t xn = mu_string_swar_load_be(a + n - 8);
+            uint64_t yn = mu_string_swar_load_be(b + n - 8);
+            bool same = x == y;
+            return mu_string_swar_order(same ? xn : x, same ? yn : y);
+        }
+        if (n >= 4) {
+            uint64_t x = ((uint64_t)mu_string_swar_load_be32(a) << 32) |
+                         mu_string_swar_load_be32(a + n - 4);
+            uint64_t y = ((uint64_t)mu_string_swar_load_be32(b) << 32) |
+                         mu_string_swar_load_be32(b + n - 4);
+            return mu_string_swar_order(x, y);
+        }
+        if (n > 0) {
+            const unsigned char *ua = (const unsigned char *)a;
+            const unsigned char *ub = (const unsigned char *)b;
+            uint32_t x = ((uint32_t)ua[0] << 16) | ((uint32_t)ua[n / 2] << 8) |
+                         ua[n - 1];
+            uint32_t y = ((uint32_t)ub[0] << 16) | ((uint32_t)ub[n / 2] << 8) |
+                         ub[n - 1];
+            return mu_string_swar_order(x, y);
+        }
+        return 0;
+    }
+#endif
+    return n == 0 ? 0 : memcmp(a, b, n);
+}
+
+static size_t mu_string_prefix_bytes(const char *a, const char *b, size_t n) {
+    size_t i = 0;
+#if MU_STRING_SWAR
+    for (; i + 8 <= n; i += 8) {
+        uint64_t d = mu_string_swar_load(a + i) ^ mu_string_swar_load(b + i);
+        if (d != 0) {
+            return i + mu_string_swar_first_byte(d);
+        }
+    }
+    if (n >= 8 && i < n) {
+        // Finish with one word that overlaps bytes already known to match.
+        i = n - 8;
+        uint64_t d = mu_string_swar_load(a + i) ^ mu_string_swar_load(b + i);
+        return (d != 0) ? i + mu_string_swar_first_byte(d) : n;
+    }
+#endif
+    while (i < n && a[i] == b[i]) {
+        i += 1;
+    }
+    return i;
+}
+
+static int mu_string_cmp_from(mu_string_t elem, mu_string_t key, size_t skip,
+                              size_t *lcp) {
+    size_t min_len = (elem.len < key.len) ? elem.len : key.len;
+    size_t i = skip;
+    if (i < min_len) {
+        i += mu_string_prefix_bytes(elem.buf + i, key.buf + i, min_len - i);
+    }
+    *lcp = i;
+    if (i < min_len) {
+        return (int)(unsigned char)elem.buf[i] - (int)(unsigned char)key.buf[i];
+    }
+    return (elem.len > key.len) - (elem.len < key.len);
+}
+
+static void mu_string_copy_bytes(char *dst, const char *src, size_t n) {
+    uintptr_t d = (uintptr_t)dst;
+    uintptr_t s = (uintptr_t)src;
+    if (d - s < n || s - d < n) {
+        memmove(dst, src, n); // in-buffer compaction and the like
+        return;
+    }
+#if MU_STRING_STREAM
+    if (n >= MU_STRING_STREAM_THRESHOLD) {
+        mu_string_stream_copy(dst, src, n);
+        return;
+    }
+#endif
+    memcpy(dst, src, n);
+}
+
+#if MU_STRING_STREAM
+static void mu_string_stream_copy(char *dst, const char *src, size_t n) {
+    // Bring `dst` to a 16-byte boundary, stream whole 64-byte groups, then
+    // copy what is left normally.
+    size_t head = (16 - ((uintptr_t)dst & 15)) & 15;
+    if (head > n) {
+        head = n;
+    }
+    memcpy(dst, src, head);
+    size_t i = head;
+    for (; i + 64 <= n; i += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(const void *)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(const void *)(src + i + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(const void *)(src + i + 32));
+        __m128i e = _mm_loadu_si128((const __m128i *)(const void *)(src + i + 48));
+        _mm_stream_si128((__m128i *)(void *)(dst + i), a);
+        _mm_stream_si128((__m128i *)(void *)(dst + i + 16), b);
+        _mm_stream_si128((__m128i *)(void *)(dst + i + 32), c);
+        _mm_stream_si128((__m128i *)(void *)(dst + i + 48), e);
+    }
+    _mm_sfence(); // order the streamed stores before any that follow
+    memcpy(dst + i, src + i, n - i);
+}
+#endif
+
+static void mu_string_translate_bytes(char *dst, const char *src, size_t n,
+                                      const uint8_t table[256]) {
+    size_t i = 0;
+#if MU_STRING_SWAR
+    mu_string_translate_run_t runs[TRANSLATE_MAX_RUNS];
+    int n_runs = (n >= TRANSLATE_MIN_ANALYZE)
+                     ? mu_string_translate_analyze(table, runs)
+                     : -1;
+    if (n_runs == 0) {
+        if (dst != src) {
+            memmove(dst, src, n);
+        }
+        return;
+    }
+    if (n_runs > 0) {
+        // Stores through `dst` may alias `runs`: take local copies so the
+        // constants stay in registers.
+        const mu_string_translate_run_t r0 = runs[0], r1 = runs[1];
+        for (; n_runs == 1 && i + 8 <= n; i += 8) {
+            uint64_t w = mu_string_swar_load(src + i);
+            uint64_t out = mu_string_translate_word(w, &r0, w);
+            memcpy(dst + i, &out, sizeof(out));
+        }
+        for (; i + 8 <= n; i += 8) {
+            uint64_t w = mu_string_swar_load(src + i);
+            uint64_t out = mu_string_translate_word(w, &r0, w);
+            out = mu_string_translate_word(w, &r1, out);
+            memcpy(dst + i, &out, sizeof(out));
+        }
+    }
+#endif
+    const unsigned char *s = (const unsigned char *)src;
+    unsigned char *d = (unsigned char *)dst;
+    for (; i + 4 <= n; i += 4) {
+        unsigned char c0 = table[s[i]], c1 = table[s[i + 1]];
+        unsigned char c2 = table[s[i + 2]], c3 = table[s[i + 3]];
+        d[i] = c0;
+        d[i + 1] = c1;
+        d[i + 2] = c2;
+        d[i + 3] = c3;
+    }
+    for (; i < n; i++) {
+        d[i] = table[s[i]];
+    }
+}
+
+#if MU_STRING_SWAR
+static inline uint64_t
+mu_string_translate_word(uint64_t w, const mu_string_translate_run_t *run,
+                         uint64_t out) {
+    uint64_t low = w & SWAR_LOW7;
+    uint64_t in = (low + run->ge_lo) & ~(low + run->gt_hi) & ~w & SWAR_HIGH;
+    uint64_t m = in >> 7;
+    uint64_t clear = m * run->clear;
+    // Runs do not overlap and each mapped byte stays within 0..255, so no
+    // carry or borrow crosses into a neighbouring byte.
+    out = (out & ~clear) | (run->set & clear);
+    return out + m * run->add - m * run->sub;
+}
+
+static int mu_string_translate_analyze(const uint8_t table[256],
+                                       mu_string_translate_run_t *runs) {
+    int n_runs = 0;
+    for (unsigned c = 128; c < 256; c++) {
+        if (table[c] != c) {
+            return -1;
+        }
+    }
+    memset(runs, 0, TRANSLATE_MAX_RUNS * sizeof(*runs)); // matches nothing
+    unsigned c = 0;
+    while (c < 128) {
+        if (table[c] == c) {
+            c += 1;
+            continue;
+        }
+        if (n_runs == TRANSLATE_MAX_RUNS) {
+            return -1;
+        }
+        // Extend the run while the bytes keep the same offset, or, if the
+        // next byte maps to the same value, the same constant.
+        unsigned first = c;
+        int offset = (int)table[c] - (int)c;
+        bool constant = c + 1 < 128 && table[c + 1] == table[c];
+        while (c + 1 < 128 && table[c + 1] != c + 1 &&
+               (constant ? table[c + 1] == table[first]
+                         : (int)table[c + 1] - (int)(c + 1) == offset)) {
+            c += 1;
+        }
+        mu_string_translate_run_t *run = &runs[n_runs++];
+        run->ge_lo = (0x80 - first) * SWAR_ONES;
+        run->gt_hi = (0x7F - c) * SWAR_ONES;
+        if (constant) {
+            run->clear = 0xFF;
+            run->set = table[first] * SWAR_ONES;
+        } else {
+            run->add = (offset > 0) ? (uint64_t)offset : 0;
+            run->sub = (offset < 0) ? (uint64_t)-offset : 0;
+        }
+        c += 1;
+    }
+    return n_runs;
+}
+#endif
+
+static inline unsigned char mu_string_fold(unsigned char ch) {
+    return (ch >= 'A' && ch <= 'Z') ? (unsigned char)(ch + ('a' - 'A')) : ch;
+}
+
+#if MU_STRING_SWAR
+static inline uint64_t mu_string_swar_load(const char *p) {
+    uint64_t w;
+    memcpy(&w, p, sizeof(w)); // a single load on any current compiler
+    return w;
+}
+
+static inline uint32_t mu_string_swar_load32(const char *p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline uint64_t mu_string_swar_load_be(const char *p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return mu_string_swar_load(p);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__)
+    return __builtin_bswap64(mu_string_swar_load(p));
+#else
+    const unsigned char *u = (const unsigned char *)p;
+    uint64_t w = 0;
+    for (size_t i = 0; i < 8; i++) {
+        w = (w << 8) | u[i];
+    }
+    return w;
+#endif
+}
+
+static inline uint32_t mu_string_swar_load_be32(const char *p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return mu_string_swar_load32(p);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__)
+    return __builtin_bswap32(mu_string_swar_load32(p));
+#else
+    const unsigned char *u = (const unsigned char *)p;
+    return ((uint32_t)u[0] << 24) | ((uint32_t)u[1] << 16) |
+           ((uint32_t)u[2] << 8) | u[3];
+#endif
+}
+
+static inline int mu_string_swar_order(uint64_t x, uint64_t y) {
+    return (x > y) - (x < y);
+}
+
+static inline size_t mu_string_swar_first_byte(uint64_t x) {
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return (size_t)__builtin_ctzll(x) >> 3;
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (size_t)__builtin_clzll(x) >> 3;
+#else
+    unsigned char bytes[sizeof(x)];
+    size_t i = 0;
+    memcpy(bytes, &x, sizeof(x));
+    while (bytes[i] == 0) {
+        i += 1;
+    }
+    return i;
+#endif
+}
+
+static inline uint64_t mu_string_swar_zero_bytes(uint64_t x) {
+    uint64_t t = (x & SWAR_LOW7) + SWAR_LOW7; // high bit set if low 7 bits != 0
+    return ~(t | x | SWAR_LOW7);
+}
+
+static inline uint64_t mu_string_swar_fold(uint64_t x) {
+    // Work on the low 7 bits of each byte so that the adds cannot carry into
+    // the next byte, then drop bytes whose high bit was set.
+    uint64_t low = x & SWAR_LOW7;
+    uint64_t ge_a = low + (0x80 - 'A') * SWAR_ONES; // high bit: byte >= 'A'
+    uint64_t gt_z = low + (0x7F - 'Z') * SWAR_ONES; // high bit: byte > 'Z'
+    uint64_t upper = ge_a & ~gt_z & ~x & SWAR_HIGH;
+    return x | (upper >> 2); // 0x80 >> 2 == 'a' - 'A'
+}
+#endif
+
 // *****************************************************************************
 // End of file
@@ -0,0 +1,270 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_approx.c
+ *
+ * @brief Implements Myers' bit-vector edit distance and approximate search.
+ *
+ * The pattern (the shorter string, or the needle) runs down the rows of the
+ * dynamic programming matrix and the text runs across the columns.  Each
+ * column is held as two bit vectors of vertical deltas, `pv` (+1) and `mv`
+ * (-1), one bit per row.  A pattern longer than 64 bytes is split into
+ * 64-row blocks; the horizontal delta leaving the bottom of one block is
+ * carried into the top of the next (Hyyrö, "A bit-vector algorithm for
+ * computing Levenshtein and Damerau edit distances", 2003).
+ *
+ * The score (the value in the bottom row) is tracked incrementally.  Row 0
+ * is fixed at D[0][j] = j when computing a distance and at D[0][j] = 0 when
+ * searching, which lets a match start anywhere in the text.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_approx.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MAX_WORDS ((MU_STRING_APPROX_MAX_LEN + 63) / 64)
+
+// Row 0 of the peq table is the all-zero vector shared by every byte that
+// does not occur in the pattern.
+#define MAX_ROWS                                                               \
+    ((MU_STRING_APPROX_MAX_LEN < 256 ? MU_STRING_APPROX_MAX_LEN : 256) + 1)
+
+typedef struct {
+    uint16_t map[256];                  // byte -> row of peq, 0 to 256
+    uint64_t peq[MAX_ROWS][MAX_WORDS];  // bit i set: pattern[i] == byte
+    uint64_t pv[MAX_WORDS];
+    uint64_t mv[MAX_WORDS];
+    uint64_t last_bit; // row m - 1 within the last word
+    size_t words;
+    size_t score;
+    bool anchored; // D[0][j] = j (distance) rather than 0 (search)
+} myers_t;
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Builds the match vectors for `pattern`, read backwards if
+ * `reverse` is set, and resets the matrix to column 0.
+ */
+static void myers_init(myers_t *my, mu_string_t pattern, bool reverse,
+                       bool anchored);
+
+/**
+ * @brief Advances the matrix by one text byte and returns the new score.
+ */
+static size_t myers_step(myers_t *my, uint8_t ch);
+
+// *****************************************************************************
+// Public code
+
+size_t mu_string_edit_distance(mu_string_t a, mu_string_t b, size_t max_dist) {
+    if (!mu_string_is_valid(a) || !mu_string_is_valid(b)) {
+        return SIZE_MAX;
+    }
+    if (a.len > b.len) {
+        mu_string_t t = a;
+        a = b;
+        b = t;
+    }
+    // Now a is the pattern (rows) and b the text (columns), a.len <= b.len.
+    if (b.len - a.len > max_dist) {
+        return SIZE_MAX; // the length difference alone is too much
+    }
+    if (a.len == 0) {
+        return b.len;
+    }
+    if (a.len > MU_STRING_APPROX_MAX_LEN) {
+        return SIZE_MAX;
+    }
+
+    myers_t my;
+    myers_init(&my, a, false, true);
+    const uint8_t *text = (const uint8_t *)b.buf;
+    for (size_t j = 0; j < b.len; j++) {
+        size_t score = myers_step(&my, text[j]);
+        // Each remaining column can lower the score by at most one.
+        size_t remaining = b.len - j - 1;
+        if (score > remaining && score - remaining > max_dist) {
+            return SIZE_MAX;
+        }
+    }
+    return (my.score <= max_dist) ? my.score : SIZE_MAX;
+}
+
+mu_string_t mu_string_find_approx(mu_string_t haystack, mu_string_t needle,
+                                  size_t max_dist) {
+    if (!mu_string_is_valid(haystack) || !mu_string_is_valid(needle) ||
+        needle.len > MU_STRING_APPROX_MAX_LEN) {
+        return MU_STRING_INVALID;
+    }
+    if (needle.len <= max_dist) {
+        // Deleting the whole needle is within budget: match at the start.
+        return (mu_string_t){ .buf = haystack.buf, .len = 0 };
+    }
+
+    // Forward pass: find the end of the first match, extended while the
+    // distance keeps improving.
+    myers_t my;
+    myers_init(&my, needle, false, false);
+    const uint8_t *text = (const uint8_t *)haystack.buf;
+    size_t end = SIZE_MAX;
+    size_t best = SIZE_MAX;
+    for (size_t j = 0; j < haystack.len; j++) {
+        size_t score = myers_step(&my, text[j]);
+        if (end == SIZE_MAX) {
+            if (score <= max_dist) {
+                end = j + 1;
+                best = score;
+            }
+        } else if (score < best) {
+            end = j + 1;
+            best = score;
+        } else {
+            break;
+        }
+    }
+    if (end == SIZE_MAX) {
+        return MU_STRING_NOT_FOUND;
+    }
+
+    // Backward pass: with the end fixed, run the reversed needle leftwards
+    // from `end` to pick the start giving the smallest distance.  A match
+    // cannot be longer than needle.len + max_dist.
+    myers_init(&my, needle, true, true);
+    size_t window = needle.len + best;
+    if (window > end) {
+        window = end;
+    }
+    size_t start_len = 0;
+    size_t least = my.score;
+    for (size_t j = 1; j <= window; j++) {
+        size_t score = myers_step(&my, text[end - j]);
+        if (score < least) {
+            least = score;
+            start_len = j;
+        }
+    }
+    return (mu_string_t){ .buf = &haystack.buf[end - start_len],
+                          .len = start_len };
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static void myers_init(myers_t *my, mu_string_t pattern, bool reverse,
+                       bool anchored) {
+    size_t m = pattern.len;
+    size_t rows = 1;
+
+    memset(my->map, 0, sizeof(my->map));
+    my->words = (m + 63) / 64;
+    memset(my->peq[0], 0, sizeof(my->peq[0]));
+    for (size_t i = 0; i < m; i++) {
+        uint8_t ch = (uint8_t)pattern.buf[reverse ? m - 1 - i : i];
+        if (my->map[ch] == 0) {
+            my->map[ch] = (uint16_t)rows;
+            memset(my->peq[rows], 0, sizeof(my->peq[rows]));
+            rows += 1;
+        }
+        my->peq[my->map[ch]][i / 64] |= (uint64_t)1 << (i % 64);
+    }
+    for (size_t w = 0; w < my->words; w++) {
+        my->pv[w] = ~(uint64_t)0; // column 0: D[i][0] = i
+        my->mv[w] = 0;
+    }
+    my->last_bit = (uint64_t)1 << ((m - 1) % 64);
+    my->score = m;
+    my->anchored = anchored;
+}
+
+static size_t myers_step(myers_t *my, uint8_t ch) {
+    const uint64_t *peq = my->peq[my->map[ch]];
+
+    if (my->words == 1) {
+        // Single-word fast path.
+        uint64_t pv = my->pv[0];
+        uint64_t mv = my->mv[0];
+        uint64_t eq = peq[0];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & my->last_bit) {
+            my->score += 1;
+        } else if (mh & my->last_bit) {
+            my->score -= 1;
+        }
+        ph = (ph << 1) | (my->anchored ? 1 : 0);
+        mh <<= 1;
+        my->pv[0] = mh | ~(xv | ph);
+        my->mv[0] = ph & xv;
+        return my->score;
+    }
+
+    // Blocked form: `hin` is the horizontal delta entering the top of each
+    // block, +1 / 0 / -1.
+    int hin = my->anchored ? 1 : 0;
+    for (size_t w = 0; w < my->words; w++) {
+        uint64_t pv = my->pv[w];
+        uint64_t mv = my->mv[w];
+        uint64_t eq = peq[w];
+        uint64_t hin_neg = (hin < 0) ? 1 : 0;
+        uint64_t xv = eq | mv;
+        eq |= hin_neg;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        uint64_t high = (w + 1 == my->words) ? my->last_bit
+                                              : (uint64_t)1 << 63;
+        int hout = (ph & high) ? 1 : (mh & high) ? -1 : 0;
+        ph = (ph << 1) | ((hin > 0) ? 1 : 0);
+        mh = (mh << 1) | hin_neg;
+        my->pv[w] = mh | ~(xv | ph);
+        my->mv[w] = ph & xv;
+        hin = hout;
+    }
+    if (hin > 0) {
+        my->score += 1;
+    } else if (hin < 0) {
+        my->score -= 1;
+    }
+    return my->score;
+}
+
+// *****************************************************************************
+// End of file
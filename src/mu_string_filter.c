@@ -0,0 +1,568 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_filter.c
+ *
+ * @brief Implements the mu_string_filter Bloom and cuckoo filters.
+ *
+ * Both filters take everything they need from one call to
+ * mu_string_hash64(): the Bloom filter splits the hash into a block number
+ * and a start and stride for its bit positions, and the cuckoo filter into a
+ * bucket number and a fingerprint.  The second cuckoo bucket is the first
+ * XORed with a hash of the fingerprint, so either bucket can be computed from
+ * the other without the key, which is what lets entries be moved.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_filter.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define PRIME1 0x9E3779B185EBCA87ULL
+#define PRIME2 0xC2B2AE3D27D4EB4FULL
+#define PRIME3 0x165667B19E3779F9ULL
+#define PRIME4 0x85EBCA77C2B2AE63ULL
+#define PRIME5 0x27D4EB2F165667C5ULL
+
+#define BLOOM_SEED 0x626C6F6F6DULL  // "bloom"
+#define CUCKOO_SEED 0x6375636B6FULL // "cucko"
+
+#define BLOCK_BITS (MU_STRING_BLOOM_BLOCK_WORDS * 64)
+
+/**
+ * @brief Number of keys hashed and prefetched before any is used.
+ */
+#define BATCH 16
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(p, rw) __builtin_prefetch((p), (rw), 3)
+#else
+#define PREFETCH(p, rw) ((void)(p))
+#endif
+
+#define LANES16 0x0001000100010001ULL
+#define HIGH16 0x8000800080008000ULL
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Reads `n` (at most 8) bytes at `p` as a little-endian integer.
+ */
+static inline uint64_t read_le(const uint8_t *p, size_t n);
+
+static inline uint64_t rotl64(uint64_t x, unsigned r);
+
+/**
+ * @brief Returns the index of the first word of the block a Bloom filter hash
+ * selects.
+ */
+static inline size_t bloom_block(const mu_string_bloom_t *bloom, uint64_t h);
+
+/**
+ * @brief Sets `mask` to the bits of a block a Bloom filter hash selects.
+ */
+static void bloom_mask(uint64_t h, unsigned k,
+                       uint64_t mask[MU_STRING_BLOOM_BLOCK_WORDS]);
+
+static void bloom_add_hash(mu_string_bloom_t *bloom, uint64_t h);
+
+static bool bloom_test_hash(const mu_string_bloom_t *bloom, uint64_t h);
+
+/**
+ * @brief Splits a cuckoo filter hash into a fingerprint and first bucket.
+ */
+static inline uint16_t cuckoo_split(const mu_string_cuckoo_t *cuckoo,
+                                    uint64_t h, size_t *bucket);
+
+/**
+ * @brief Returns the other bucket a fingerprint in `bucket` may live in.
+ */
+static inline size_t cuckoo_alt(const mu_string_cuckoo_t *cuckoo,
+                                size_t bucket, uint16_t fp);
+
+/**
+ * @brief Returns a bit set for each slot of `bucket` holding `fp`.
+ */
+static inline uint64_t cuckoo_match(const mu_string_cuckoo_t *cuckoo,
+                                    size_t bucket, uint16_t fp);
+
+/**
+ * @brief Stores `fp` in a free slot of `bucket`.  Returns false if there is
+ * none.
+ */
+static bool cuckoo_put(mu_string_cuckoo_t *cuckoo, size_t bucket, uint16_t fp);
+
+/**
+ * @brief Stores `fp` in `bucket` or its alternate, evicting other
+ * fingerprints as needed.  If evictions run out, the last one evicted is
+ * kept as the victim and the filter is full.
+ */
+static void cuckoo_place(mu_string_cuckoo_t *cuckoo, size_t bucket,
+                         uint16_t fp);
+
+static bool cuckoo_add_hash(mu_string_cuckoo_t *cuckoo, uint64_t h);
+
+static bool cuckoo_test_hash(const mu_string_cuckoo_t *cuckoo, uint64_t h);
+
+// *****************************************************************************
+// Public code
+
+uint64_t mu_string_hash64(mu_string_t s, uint64_t seed) {
+    if (!mu_string_is_valid(s)) {
+        return 0;
+    }
+    // XXH64's short-input path: one lane of 8-byte rounds, then the tail.
+    const uint8_t *p = (const uint8_t *)s.buf;
+    size_t n = s.len;
+    uint64_t h = seed + PRIME5 + (uint64_t)s.len;
+
+    while (n >= 8) {
+        uint64_t k = rotl64(read_le(p, 8) * PRIME2, 31) * PRIME1;
+        h = rotl64(h ^ k, 27) * PRIME1 + PRIME4;
+        p += 8;
+        n -= 8;
+    }
+    if (n >= 4) {
+        h = rotl64(h ^ (read_le(p, 4) * PRIME1), 23) * PRIME2 + PRIME3;
+        p += 4;
+        n -= 4;
+    }
+    while (n > 0) {
+        h = rotl64(h ^ (*p * PRIME5), 11) * PRIME1;
+        p += 1;
+        n -= 1;
+    }
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+mu_string_bloom_t *mu_string_bloom_init(mu_string_bloom_t *bloom,
+                                        uint64_t *words, size_t n_words,
+                                        unsigned k) {
+    if (bloom == NULL || words == NULL || n_words == 0 ||
+        n_words % MU_STRING_BLOOM_BLOCK_WORDS != 0 ||
+        n_words / MU_STRING_BLOOM_BLOCK_WORDS > UINT32_MAX || k < 1 ||
+        k > 16) {
+        return NULL;
+    }
+    bloom->words = words;
+    bloom->n_blocks = n_words / MU_STRING_BLOOM_BLOCK_WORDS;
+    bloom->k = k;
+    mu_string_bloom_clear(bloom);
+    return bloom;
+}
+
+void mu_string_bloom_clear(mu_string_bloom_t *bloom) {
+    if (bloom == NULL || bloom->words == NULL) {
+        return;
+    }
+    memset(bloom->words, 0,
+           bloom->n_blocks * MU_STRING_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+}
+
+bool mu_string_bloom_add(mu_string_bloom_t *bloom, mu_string_t key) {
+    if (bloom == NULL || !mu_string_is_valid(key)) {
+        return false;
+    }
+    bloom_add_hash(bloom, mu_string_hash64(key, BLOOM_SEED));
+    return true;
+}
+
+bool mu_string_bloom_may_contain(const mu_string_bloom_t *bloom,
+                                 mu_string_t key) {
+    if (bloom == NULL || !mu_string_is_valid(key)) {
+        return false;
+    }
+    return bloom_test_hash(bloom, mu_string_hash64(key, BLOOM_SEED));
+}
+
+size_t mu_string_bloom_add_batch(mu_string_bloom_t *bloom,
+                                 const mu_string_t *keys, size_t n_keys) {
+    if (bloom == NULL || keys == NULL) {
+        return 0;
+    }
+    uint64_t h[BATCH];
+    size_t added = 0;
+
+    for (size_t base = 0; base < n_keys; base += BATCH) {
+        size_t n = (n_keys - base < BATCH) ? n_keys - base : BATCH;
+        for (size_t j = 0; j < n; j++) {
+            h[j] = mu_string_hash64(keys[base + j], BLOOM_SEED);
+            PREFETCH(&bloom->words[bloom_block(bloom, h[j])], 1);
+        }
+        for (size_t j = 0; j < n; j++) {
+            if (mu_string_is_valid(keys[base + j])) {
+                bloom_add_hash(bloom, h[j]);
+                added += 1;
+            }
+        }
+    }
+    return added;
+}
+
+size_t mu_string_bloom_query_batch(const mu_string_bloom_t *bloom,
+                                   const mu_string_t *keys, size_t n_keys,
+                                   bool *results) {
+    if (bloom == NULL || keys == NULL || results == NULL) {
+        return 0;
+    }
+    uint64_t h[BATCH];
+    size_t hits = 0;
+
+    for (size_t base = 0; base < n_keys; base += BATCH) {
+        size_t n = (n_keys - base < BATCH) ? n_keys - base : BATCH;
+        for (size_t j = 0; j < n; j++) {
+            h[j] = mu_string_hash64(keys[base + j], BLOOM_SEED);
+            PREFETCH(&bloom->words[bloom_block(bloom, h[j])], 0);
+        }
+        for (size_t j = 0; j < n; j++) {
+            bool hit = mu_string_is_valid(keys[base + j]) &&
+                       bloom_test_hash(bloom, h[j]);
+            results[base + j] = hit;
+            hits += hit;
+        }
+    }
+    return hits;
+}
+
+mu_string_cuckoo_t *mu_string_cuckoo_init(mu_string_cuckoo_t *cuckoo,
+                                          uint16_t *slots, size_t n_slots) {
+    size_t n_buckets = n_slots / MU_STRING_CUCKOO_BUCKET_SLOTS;
+    if (cuckoo == NULL || slots == NULL || n_buckets == 0 ||
+        n_slots % MU_STRING_CUCKOO_BUCKET_SLOTS != 0 ||
+        (n_buckets & (n_buckets - 1)) != 0) {
+        return NULL;
+    }
+    cuckoo->slots = slots;
+    cuckoo->n_buckets = n_buckets;
+    mu_string_cuckoo_clear(cuckoo);
+    return cuckoo;
+}
+
+void mu_string_cuckoo_clear(mu_string_cuckoo_t *cuckoo) {
+    if (cuckoo == NULL || cuckoo->slots == NULL) {
+        return;
+    }
+    memset(cuckoo->slots, 0,
+           cuckoo->n_buckets * MU_STRING_CUCKOO_BUCKET_SLOTS * sizeof(uint16_t));
+    cuckoo->count = 0;
+    cuckoo->rng = 0x9E3779B9u;
+    cuckoo->victim_fp = 0;
+    cuckoo->victim_bucket = 0;
+    cuckoo->has_victim = false;
+}
+
+bool mu_string_cuckoo_add(mu_string_cuckoo_t *cuckoo, mu_string_t key) {
+    if (cuckoo == NULL || !mu_string_is_valid(key)) {
+        return false;
+    }
+    return cuckoo_add_hash(cuckoo, mu_string_hash64(key, CUCKOO_SEED));
+}
+
+bool mu_string_cuckoo_may_contain(const mu_string_cuckoo_t *cuckoo,
+                                  mu_string_t key) {
+    if (cuckoo == NULL || !mu_string_is_valid(key)) {
+        return false;
+    }
+    return cuckoo_test_hash(cuckoo, mu_string_hash64(key, CUCKOO_SEED));
+}
+
+bool mu_string_cuckoo_remove(mu_string_cuckoo_t *cuckoo, mu_string_t key) {
+    if (cuckoo == NULL || !mu_string_is_valid(key)) {
+        return false;
+    }
+    size_t i1;
+    uint16_t fp = cuckoo_split(cuckoo, mu_string_hash64(key, CUCKOO_SEED), &i1);
+    size_t i2 = cuckoo_alt(cuckoo, i1, fp);
+
+    if (cuckoo->has_victim && cuckoo->victim_fp == fp &&
+        (cuckoo->victim_bucket == i1 || cuckoo->victim_bucket == i2)) {
+        cuckoo->has_victim = false;
+        cuckoo->count -= 1;
+        return true;
+    }
+    for (int b = 0; b < 2; b++) {
+        size_t bucket = b ? i2 : i1;
+        uint64_t m = cuckoo_match(cuckoo, bucket, fp);
+        if (m == 0) {
+            continue;
+        }
+        size_t slot = 0;
+        while (!(m & 1)) {
+            m >>= 1;
+            slot += 1;
+        }
+        cuckoo->slots[bucket * MU_STRING_CUCKOO_BUCKET_SLOTS + slot] = 0;
+        cuckoo->count -= 1;
+        if (cuckoo->has_victim) {
+            // There is room again: give the victim another chance.
+            cuckoo->has_victim = false;
+            cuckoo->count -= 1;
+            cuckoo_place(cuckoo, cuckoo->victim_bucket, cuckoo->victim_fp);
+        }
+        return true;
+    }
+    return false;
+}
+
+size_t mu_string_cuckoo_count(const mu_string_cuckoo_t *cuckoo) {
+    return (cuckoo == NULL) ? 0 : cuckoo->count;
+}
+
+size_t mu_string_cuckoo_add_batch(mu_string_cuckoo_t *cuckoo,
+                                  const mu_string_t *keys, size_t n_keys) {
+    if (cuckoo == NULL || keys == NULL) {
+        return 0;
+    }
+    uint64_t h[BATCH];
+
+    for (size_t base = 0; base < n_keys; base += BATCH) {
+        size_t n = (n_keys - base < BATCH) ? n_keys - base : BATCH;
+        for (size_t j = 0; j < n; j++) {
+            size_t i1;
+            h[j] = mu_string_hash64(keys[base + j], CUCKOO_SEED);
+            uint16_t fp = cuckoo_split(cuckoo, h[j], &i1);
+            size_t i2 = cuckoo_alt(cuckoo, i1, fp);
+            PREFETCH(&cuckoo->slots[i1 * MU_STRING_CUCKOO_BUCKET_SLOTS], 1);
+            PREFETCH(&cuckoo->slots[i2 * MU_STRING_CUCKOO_BUCKET_SLOTS], 1);
+        }
+        for (size_t j = 0; j < n; j++) {
+            if (!mu_string_is_valid(keys[base + j]) ||
+                !cuckoo_add_hash(cuckoo, h[j])) {
+                return base + j;
+            }
+        }
+    }
+    return n_keys;
+}
+
+size_t mu_string_cuckoo_query_batch(const mu_string_cuckoo_t *cuckoo,
+                                    const mu_string_t *keys, size_t n_keys,
+                                    bool *results) {
+    if (cuckoo == NULL || keys == NULL || results == NULL) {
+        return 0;
+    }
+    uint64_t h[BATCH];
+    size_t hits = 0;
+
+    for (size_t base = 0; base < n_keys; base += BATCH) {
+        size_t n = (n_keys - base < BATCH) ? n_keys - base : BATCH;
+        for (size_t j = 0; j < n; j++) {
+            size_t i1;
+            h[j] = mu_string_hash64(keys[base + j], CUCKOO_SEED);
+            uint16_t fp = cuckoo_split(cuckoo, h[j], &i1);
+            size_t i2 = cuckoo_alt(cuckoo, i1, fp);
+            PREFETCH(&cuckoo->slots[i1 * MU_STRING_CUCKOO_BUCKET_SLOTS], 0);
+            PREFETCH(&cuckoo->slots[i2 * MU_STRING_CUCKOO_BUCKET_SLOTS], 0);
+        }
+        for (size_t j = 0; j < n; j++) {
+            bool hit = mu_string_is_valid(keys[base + j]) &&
+                       cuckoo_test_hash(cuckoo, h[j]);
+            results[base + j] = hit;
+            hits += hit;
+        }
+    }
+    return hits;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static inline uint64_t read_le(const uint8_t *p, size_t n) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < n; i++) {
+        v |= (uint64_t)p[i] << (8 * i);
+    }
+    return v;
+}
+
+static inline uint64_t rotl64(uint64_t x, unsigned r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline size_t bloom_block(const mu_string_bloom_t *bloom, uint64_t h) {
+    // Multiply-shift maps the high 32 bits onto [0, n_blocks) without a
+    // division.
+    size_t block = (size_t)(((h >> 32) * (uint64_t)bloom->n_blocks) >> 32);
+    return block * MU_STRING_BLOOM_BLOCK_WORDS;
+}
+
+static void bloom_mask(uint64_t h, unsigned k,
+                       uint64_t mask[MU_STRING_BLOOM_BLOCK_WORDS]) {
+    // Double hashing within the block: an odd stride visits k distinct bits.
+    unsigned bit = (unsigned)h & (BLOCK_BITS - 1);
+    unsigned stride = ((unsigned)(h >> 9) & (BLOCK_BITS - 1)) | 1u;
+
+    memset(mask, 0, MU_STRING_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+    for (unsigned i = 0; i < k; i++) {
+        mask[bit / 64] |= (uint64_t)1 << (bit % 64);
+        bit = (bit + stride) & (BLOCK_BITS - 1);
+    }
+}
+
+static void bloom_add_hash(mu_string_bloom_t *bloom, uint64_t h) {
+    uint64_t mask[MU_STRING_BLOOM_BLOCK_WORDS];
+    uint64_t *block = &bloom->words[bloom_block(bloom, h)];
+    bloom_mask(h, bloom->k, mask);
+    for (size_t w = 0; w < MU_STRING_BLOOM_BLOCK_WORDS; w++) {
+        block[w] |= mask[w];
+    }
+}
+
+static bool bloom_test_hash(const mu_string_bloom_t *bloom, uint64_t h) {
+    uint64_t mask[MU_STRING_BLOOM_BLOCK_WORDS];
+    const uint64_t *block = &bloom->words[bloom_block(bloom, h)];
+    uint64_t missing = 0;
+    bloom_mask(h, bloom->k, mask);
+    for (size_t w = 0; w < MU_STRING_BLOOM_BLOCK_WORDS; w++) {
+        missing |= mask[w] & ~block[w];
+    }
+    return missing == 0;
+}
+
+static inline uint16_t cuckoo_split(const mu_string_cuckoo_t *cuckoo,
+                                    uint64_t h, size_t *bucket) {
+    uint16_t fp = (uint16_t)(h >> 48);
+    *bucket = (size_t)h & (cuckoo->n_buckets - 1);
+    return fp ? fp : 1; // 0 marks an empty slot
+}
+
+static inline size_t cuckoo_alt(const mu_string_cuckoo_t *cuckoo,
+                                size_t bucket, uint16_t fp) {
+    uint32_t x = fp * 0x5BD1E995u;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return (bucket ^ x) & (cuckoo->n_buckets - 1);
+}
+
+static inline uint64_t cuckoo_match(const mu_string_cuckoo_t *cuckoo,
+                                    size_t bucket, uint16_t fp) {
+    // Compare all four slots at once: a lane of `v` is zero where the slot
+    // holds `fp`.  The borrow trick can also flag the lane above a true
+    // match, so the result is confirmed slot by slot.
+    uint64_t w;
+    const uint16_t *s = &cuckoo->slots[bucket * MU_STRING_CUCKOO_BUCKET_SLOTS];
+    memcpy(&w, s, sizeof(w));
+    uint64_t v = w ^ (fp * LANES16);
+    if (((v - LANES16) & ~v & HIGH16) == 0) {
+        return 0;
+    }
+    uint64_t m = 0;
+    for (size_t i = 0; i < MU_STRING_CUCKOO_BUCKET_SLOTS; i++) {
+        m |= (uint64_t)(s[i] == fp) << i;
+    }
+    return m;
+}
+
+static bool cuckoo_put(mu_string_cuckoo_t *cuckoo, size_t bucket, uint16_t fp) {
+    uint16_t *s = &cuckoo->slots[bucket * MU_STRING_CUCKOO_BUCKET_SLOTS];
+    for (size_t i = 0; i < MU_STRING_CUCKOO_BUCKET_SLOTS; i++) {
+        if (s[i] == 0) {
+            s[i] = fp;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void cuckoo_place(mu_string_cuckoo_t *cuckoo, size_t bucket,
+                         uint16_t fp) {
+    cuckoo->count += 1;
+    if (cuckoo_put(cuckoo, bucket, fp)) {
+        return;
+    }
+    size_t alt = cuckoo_alt(cuckoo, bucket, fp);
+    if (cuckoo_put(cuckoo, alt, fp)) {
+        return;
+    }
+
+    uint32_t r = cuckoo->rng;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    if (r & 0x80000000u) {
+        bucket = alt;
+    }
+    for (int kick = 0; kick < MU_STRING_CUCKOO_MAX_KICKS; kick++) {
+        r ^= r << 13;
+        r ^= r >> 17;
+        r ^= r << 5;
+        uint16_t *slot = &cuckoo->slots[bucket * MU_STRING_CUCKOO_BUCKET_SLOTS +
+                                        (r % MU_STRING_CUCKOO_BUCKET_SLOTS)];
+        uint16_t evicted = *slot;
+        *slot = fp;
+        fp = evicted;
+        bucket = cuckoo_alt(cuckoo, bucket, fp);
+        if (cuckoo_put(cuckoo, bucket, fp)) {
+            cuckoo->rng = r;
+            return;
+        }
+    }
+    cuckoo->rng = r;
+    cuckoo->victim_fp = fp;
+    cuckoo->victim_bucket = bucket;
+    cuckoo->has_victim = true;
+}
+
+static bool cuckoo_add_hash(mu_string_cuckoo_t *cuckoo, uint64_t h) {
+    if (cuckoo->has_victim) {
+        return false; // full
+    }
+    size_t bucket;
+    uint16_t fp = cuckoo_split(cuckoo, h, &bucket);
+    cuckoo_place(cuckoo, bucket, fp);
+    return true;
+}
+
+static bool cuckoo_test_hash(const mu_string_cuckoo_t *cuckoo, uint64_t h) {
+    size_t i1;
+    uint16_t fp = cuckoo_split(cuckoo, h, &i1);
+    size_t i2 = cuckoo_alt(cuckoo, i1, fp);
+    if (cuckoo->has_victim && cuckoo->victim_fp == fp &&
+        (cuckoo->victim_bucket == i1 || cuckoo->victim_bucket == i2)) {
+        return true;
+    }
+    return (cuckoo_match(cuckoo, i1, fp) | cuckoo_match(cuckoo, i2, fp)) != 0;
+}
+
+// *****************************************************************************
+// End of file
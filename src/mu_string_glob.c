@@ -0,0 +1,342 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_glob.c
+ *
+ * @brief Implements the mu_string_glob wildcard matcher.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_glob.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Returns the length of the `[...]` class starting at `p[i]`, or 0 if
+ * it is not closed.
+ */
+static size_t class_len(const char *p, size_t i, size_t len);
+
+/**
+ * @brief Returns true if `ch` is a member of the class `p[0 .. n)`, which
+ * includes the surrounding brackets.
+ */
+static bool class_matches(const char *p, size_t n, char ch);
+
+/**
+ * @brief Analyzes the `*`-free segment `seg` and fills in `out`.  Returns
+ * false if it is malformed.
+ */
+static bool compile_segment(mu_string_t seg, mu_string_glob_segment_t *out);
+
+/**
+ * @brief Returns true if `seg` matches the `seg->len` bytes at `s`.
+ */
+static bool segment_matches_at(const mu_string_glob_segment_t *seg,
+                               const char *s);
+
+/**
+ * @brief Finds the leftmost match of `seg` in `window`.  Returns the offset
+ * of the match, or SIZE_MAX if there is none.
+ */
+static size_t segment_find(const mu_string_glob_segment_t *seg,
+                           mu_string_t window);
+
+// *****************************************************************************
+// Public code
+
+mu_string_glob_t *mu_string_glob_compile(mu_string_glob_t *glob,
+                                         mu_string_t pattern) {
+    if (glob == NULL || !mu_string_is_valid(pattern)) {
+        return NULL;
+    }
+    memset(glob, 0, sizeof(*glob));
+
+    const char *p = pattern.buf;
+    const size_t len = pattern.len;
+    size_t seg_start = 0;
+    size_t i = 0;
+
+    while (i <= len) {
+        if (i < len && p[i] == '\\') {
+            if (i + 1 == len) {
+                return NULL; // trailing backslash
+            }
+            i += 2;
+            continue;
+        }
+        if (i < len && p[i] == '[') {
+            size_t n = class_len(p, i, len);
+            if (n == 0) {
+                return NULL;
+            }
+            i += n;
+            continue;
+        }
+        if (i < len && p[i] != '*') {
+            i += 1;
+            continue;
+        }
+        // At a '*' or the end of the pattern: close the current segment.
+        if (i > seg_start) {
+            if (glob->n_segments == MU_STRING_GLOB_MAX_SEGMENTS) {
+                return NULL;
+            }
+            mu_string_glob_segment_t *seg = &glob->segments[glob->n_segments];
+            mu_string_t text = { .buf = &p[seg_start], .len = i - seg_start };
+            if (!compile_segment(text, seg)) {
+                return NULL;
+            }
+            glob->min_len += seg->len;
+            glob->n_segments += 1;
+        }
+        if (i < len) {
+            glob->has_star = true;
+            if (i == 0) {
+                glob->leading_star = true;
+            }
+            if (i == len - 1) {
+                glob->trailing_star = true;
+            }
+        }
+        i += 1;
+        seg_start = i;
+    }
+    return glob;
+}
+
+bool mu_string_glob_match(const mu_string_glob_t *glob, mu_string_t s) {
+    if (glob == NULL || !mu_string_is_valid(s) || s.len < glob->min_len) {
+        return false;
+    }
+    if (!glob->has_star) {
+        return (glob->n_segments == 0)
+                   ? s.len == 0
+                   : s.len == glob->segments[0].len &&
+                         segment_matches_at(&glob->segments[0], s.buf);
+    }
+
+    size_t first = 0;
+    size_t last = glob->n_segments;
+    size_t pos = 0;
+    size_t end = s.len;
+
+    if (!glob->leading_star) {
+        const mu_string_glob_segment_t *seg = &glob->segments[0];
+        if (!segment_matches_at(seg, s.buf)) {
+            return false;
+        }
+        pos = seg->len;
+        first = 1;
+    }
+    if (!glob->trailing_star && last > first) {
+        const mu_string_glob_segment_t *seg = &glob->segments[last - 1];
+        // min_len guarantees the anchored segments do not overlap.
+        if (!segment_matches_at(seg, s.buf + s.len - seg->len)) {
+            return false;
+        }
+        end -= seg->len;
+        last -= 1;
+    }
+    for (size_t k = first; k < last; ++k) {
+        const mu_string_glob_segment_t *seg = &glob->segments[k];
+        mu_string_t window = { .buf = s.buf + pos, .len = end - pos };
+        size_t hit = segment_find(seg, window);
+        if (hit == SIZE_MAX) {
+            return false;
+        }
+        pos += hit + seg->len;
+    }
+    return true;
+}
+
+mu_string_t mu_string_glob_prefix(const mu_string_glob_t *glob) {
+    if (glob == NULL) {
+        return MU_STRING_INVALID;
+    }
+    if (glob->leading_star || glob->n_segments == 0) {
+        return MU_STRING_EMPTY;
+    }
+    return glob->segments[0].literal;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t class_len(const char *p, size_t i, size_t len) {
+    size_t j = i + 1;
+    if (j < len && (p[j] == '!' || p[j] == '^')) {
+        j += 1;
+    }
+    if (j < len && p[j] == ']') {
+        j += 1; // leading ']' is literal
+    }
+    while (j < len && p[j] != ']') {
+        j += 1;
+    }
+    return (j < len) ? j - i + 1 : 0;
+}
+
+static bool class_matches(const char *p, size_t n, char ch) {
+    size_t j = 1;
+    size_t end = n - 1; // index of the closing ']'
+    bool negate = false;
+    bool found = false;
+
+    if (p[j] == '!' || p[j] == '^') {
+        negate = true;
+        j += 1;
+    }
+    // The first member may be ']', so test before checking for the end.
+    do {
+        unsigned char lo = (unsigned char)p[j];
+        unsigned char hi = lo;
+        if (j + 2 < end && p[j + 1] == '-') {
+            hi = (unsigned char)p[j + 2];
+            j += 2;
+        }
+        if ((unsigned char)ch >= lo && (unsigned char)ch <= hi) {
+            found = true;
+        }
+        j += 1;
+    } while (j < end);
+    return found != negate;
+}
+
+static bool compile_segment(mu_string_t seg, mu_string_glob_segment_t *out) {
+    const char *p = seg.buf;
+    size_t i = 0;
+    size_t atoms = 0;
+    size_t literal_len = 0;
+    bool in_literal = true;
+
+    while (i < seg.len) {
+        if (p[i] == '\\') {
+            if (i + 1 == seg.len) {
+                return false;
+            }
+            in_literal = false;
+            i += 2;
+        } else if (p[i] == '[') {
+            size_t n = class_len(p, i, seg.len);
+            if (n == 0) {
+                return false;
+            }
+            in_literal = false;
+            i += n;
+        } else if (p[i] == '?') {
+            in_literal = false;
+            i += 1;
+        } else {
+            if (in_literal) {
+                literal_len += 1;
+            }
+            i += 1;
+        }
+        atoms += 1;
+    }
+    out->pattern = seg;
+    out->literal = (mu_string_t){ .buf = seg.buf, .len = literal_len };
+    out->len = atoms;
+    out->is_literal = (literal_len == atoms);
+    return true;
+}
+
+static bool segment_matches_at(const mu_string_glob_segment_t *seg,
+                               const char *s) {
+    if (seg->is_literal) {
+        return memcmp(s, seg->literal.buf, seg->len) == 0;
+    }
+    const char *p = seg->pattern.buf;
+    const size_t len = seg->pattern.len;
+    size_t i = 0;
+    size_t k = 0;
+
+    while (i < len) {
+        if (p[i] == '\\') {
+            if (s[k] != p[i + 1]) {
+                return false;
+            }
+            i += 2;
+        } else if (p[i] == '[') {
+            size_t n = class_len(p, i, len);
+            if (!class_matches(&p[i], n, s[k])) {
+                return false;
+            }
+            i += n;
+        } else if (p[i] == '?') {
+            i += 1;
+        } else {
+            if (s[k] != p[i]) {
+                return false;
+            }
+            i += 1;
+        }
+        k += 1;
+    }
+    return true;
+}
+
+static size_t segment_find(const mu_string_glob_segment_t *seg,
+                           mu_string_t window) {
+    size_t offset = 0;
+
+    while (window.len - offset >= seg->len) {
+        if (seg->literal.len > 0) {
+            // Jump to the next occurrence of the segment's literal text.
+            mu_string_t rest = { .buf = window.buf + offset,
+                                 .len = window.len - offset };
+            mu_string_t hit = mu_string_find_str(rest, seg->literal);
+            if (hit.len == 0) {
+                return SIZE_MAX; // literal not found
+            }
+            offset = (size_t)(hit.buf - window.buf);
+            if (window.len - offset < seg->len) {
+                return SIZE_MAX;
+            }
+        }
+        if (segment_matches_at(seg, window.buf + offset)) {
+            return offset;
+        }
+        offset += 1;
+    }
+    return SIZE_MAX;
+}
+
+// *****************************************************************************
+// End of file
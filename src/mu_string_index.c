@@ -0,0 +1,395 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_index.c
+ *
+ * @brief Implements the mu_string_index suffix array.
+ *
+ * The construction follows the reference SA-IS code of Nong, Zhang and
+ * Chan.  The reduced problem is stored in the suffix array itself: the
+ * sorted LMS substrings in the head and their names in the tail.  Only the
+ * L/S type bits and the bucket counts need separate storage, and they are
+ * taken in stack order from the caller's work area.
+ *
+ * The corpus is treated as if followed by a unique sentinel that is smaller
+ * than every byte.  Bytes are shifted up by one so the sentinel can be 0.
+ * The sentinel's suffix always sorts first; it is stored in `sa[0]` and
+ * hidden from queries.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_index.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define EMPTY UINT32_MAX
+
+/**
+ * @brief The string being sorted at one level of the recursion.  At the top
+ * level it is the corpus plus the virtual sentinel; below that it is the
+ * array of LMS substring names.
+ */
+typedef struct {
+    const uint8_t *bytes; // top level only
+    const uint32_t *ints; // reduced levels only
+    size_t n;             // length, including the sentinel
+} text_t;
+
+/**
+ * @brief Bump allocator over the caller's work area.
+ */
+typedef struct {
+    uint32_t *base;
+    size_t len;
+    size_t used;
+} arena_t;
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Computes the suffix array of `s` (alphabet 0..k, sentinel last)
+ * into `sa`.  Returns false if the work area is exhausted.
+ */
+static bool sais(const text_t *s, uint32_t *sa, size_t k, arena_t *arena);
+
+/**
+ * @brief Fills `bkt` with the start (or end, if `end`) of each bucket.
+ */
+static void get_buckets(const text_t *s, uint32_t *bkt, size_t k, bool end);
+
+static void induce_l(const text_t *s, const uint32_t *t, uint32_t *sa,
+                     uint32_t *bkt, size_t k);
+static void induce_s(const text_t *s, const uint32_t *t, uint32_t *sa,
+                     uint32_t *bkt, size_t k);
+
+/**
+ * @brief Returns the range [*lo, *hi) of suffix array entries whose
+ * suffixes begin with `needle`.
+ */
+static void find_range(const mu_string_index_t *index, mu_string_t needle,
+                       size_t *lo, size_t *hi);
+
+static inline uint32_t chr(const text_t *s, size_t i) {
+    if (s->bytes) {
+        return (i + 1 == s->n) ? 0 : (uint32_t)s->bytes[i] + 1;
+    }
+    return s->ints[i];
+}
+
+static inline bool tget(const uint32_t *t, size_t i) {
+    return (t[i >> 5] >> (i & 31)) & 1;
+}
+
+static inline void tset(uint32_t *t, size_t i, bool is_s) {
+    if (is_s) {
+        t[i >> 5] |= (uint32_t)1 << (i & 31);
+    } else {
+        t[i >> 5] &= ~((uint32_t)1 << (i & 31));
+    }
+}
+
+static inline bool is_lms(const uint32_t *t, size_t i) {
+    return i > 0 && i != EMPTY && tget(t, i) && !tget(t, i - 1);
+}
+
+static inline uint32_t *arena_take(arena_t *arena, size_t n) {
+    if (arena->len - arena->used < n) {
+        return NULL;
+    }
+    uint32_t *p = &arena->base[arena->used];
+    arena->used += n;
+    return p;
+}
+
+// *****************************************************************************
+// Public code
+
+mu_string_index_t *mu_string_index_build(mu_string_index_t *index,
+                                         mu_string_t corpus, uint32_t *sa,
+                                         uint32_t *work, size_t work_len) {
+    if (index == NULL || !mu_string_is_valid(corpus) || sa == NULL ||
+        work == NULL || corpus.len >= UINT32_MAX - 1) {
+        return NULL;
+    }
+    text_t s = { .bytes = (const uint8_t *)corpus.buf, .ints = NULL,
+                 .n = corpus.len + 1 };
+    arena_t arena = { .base = work, .len = work_len, .used = 0 };
+    if (s.n == 1) {
+        sa[0] = 0;
+    } else if (!sais(&s, sa, 256, &arena)) {
+        return NULL;
+    }
+    index->corpus = corpus;
+    index->sa = &sa[1]; // skip the sentinel suffix
+    return index;
+}
+
+size_t mu_string_index_count(const mu_string_index_t *index, mu_string_t needle) {
+    if (index == NULL || !mu_string_is_valid(needle)) {
+        return 0;
+    }
+    size_t lo, hi;
+    find_range(index, needle, &lo, &hi);
+    return hi - lo;
+}
+
+mu_string_t mu_string_index_find(const mu_string_index_t *index,
+                                 mu_string_t needle) {
+    if (index == NULL || !mu_string_is_valid(needle)) {
+        return MU_STRING_INVALID;
+    }
+    size_t lo, hi;
+    find_range(index, needle, &lo, &hi);
+    if (lo == hi) {
+        return MU_STRING_NOT_FOUND;
+    }
+    return (mu_string_t){ .buf = &index->corpus.buf[index->sa[lo]],
+                          .len = needle.len };
+}
+
+size_t mu_string_index_find_all(const mu_string_index_t *index,
+                                mu_string_t needle, mu_string_t *results,
+                                size_t max_results) {
+    if (index == NULL || !mu_string_is_valid(needle) ||
+        (results == NULL && max_results > 0)) {
+        return 0;
+    }
+    size_t lo, hi;
+    find_range(index, needle, &lo, &hi);
+    for (size_t i = lo; i < hi && i - lo < max_results; i++) {
+        results[i - lo] = (mu_string_t){
+            .buf = &index->corpus.buf[index->sa[i]], .len = needle.len };
+    }
+    return hi - lo;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static bool sais(const text_t *s, uint32_t *sa, size_t k, arena_t *arena) {
+    const size_t n = s->n;
+    uint32_t *t = arena_take(arena, (n + 31) / 32);
+    if (t == NULL) {
+        return false;
+    }
+
+    // Classify each suffix as S-type (smaller than its successor) or L-type.
+    // The sentinel is S-type and the byte before it L-type.
+    tset(t, n - 1, true);
+    tset(t, n - 2, false);
+    for (size_t i = n - 2; i-- > 0;) {
+        uint32_t a = chr(s, i);
+        uint32_t b = chr(s, i + 1);
+        tset(t, i, a < b || (a == b && tget(t, i + 1)));
+    }
+
+    // Stage 1: sort the LMS substrings by induced sorting.
+    uint32_t *bkt = arena_take(arena, k + 1);
+    if (bkt == NULL) {
+        return false;
+    }
+    get_buckets(s, bkt, k, true);
+    for (size_t i = 0; i < n; i++) {
+        sa[i] = EMPTY;
+    }
+    for (size_t i = 1; i < n; i++) {
+        if (is_lms(t, i)) {
+            sa[--bkt[chr(s, i)]] = (uint32_t)i;
+        }
+    }
+    induce_l(s, t, sa, bkt, k);
+    induce_s(s, t, sa, bkt, k);
+    arena->used -= k + 1;
+
+    // Compact the sorted LMS substrings into the head of `sa`; at most half
+    // of the positions can be LMS.
+    size_t n1 = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (is_lms(t, sa[i])) {
+            sa[n1++] = sa[i];
+        }
+    }
+
+    // Name the LMS substrings: equal substrings get equal names.  Names are
+    // parked at sa[n1 + pos / 2], which is unique because LMS positions are
+    // at least two apart.
+    for (size_t i = n1; i < n; i++) {
+        sa[i] = EMPTY;
+    }
+    size_t name = 0;
+    size_t prev = EMPTY;
+    for (size_t i = 0; i < n1; i++) {
+        size_t pos = sa[i];
+        bool diff = false;
+        for (size_t d = 0; d < n; d++) {
+            if (prev == EMPTY || chr(s, pos + d) != chr(s, prev + d) ||
+                tget(t, pos + d) != tget(t, prev + d)) {
+                diff = true;
+                break;
+            }
+            if (d > 0 && (is_lms(t, pos + d) || is_lms(t, prev + d))) {
+                break;
+            }
+        }
+        if (diff) {
+            name += 1;
+            prev = pos;
+        }
+        sa[n1 + pos / 2] = (uint32_t)(name - 1);
+    }
+    for (size_t i = n, j = n; i-- > n1;) {
+        if (sa[i] != EMPTY) {
+            sa[--j] = sa[i];
+        }
+    }
+
+    // Stage 2: sort the reduced string s1, recursing only if some names
+    // repeat.
+    uint32_t *sa1 = sa;
+    uint32_t *s1 = &sa[n - n1];
+    if (name < n1) {
+        text_t sub = { .bytes = NULL, .ints = s1, .n = n1 };
+        if (!sais(&sub, sa1, name - 1, arena)) {
+            return false;
+        }
+    } else {
+        for (size_t i = 0; i < n1; i++) {
+            sa1[s1[i]] = (uint32_t)i;
+        }
+    }
+
+    // Stage 3: place the LMS suffixes in sorted order at the ends of their
+    // buckets and induce the rest.
+    bkt = arena_take(arena, k + 1);
+    if (bkt == NULL) {
+        return false;
+    }
+    get_buckets(s, bkt, k, true);
+    for (size_t i = 1, j = 0; i < n; i++) {
+        if (is_lms(t, i)) {
+            s1[j++] = (uint32_t)i; // s1 is free again: reuse it for offsets
+        }
+    }
+    for (size_t i = 0; i < n1; i++) {
+        sa1[i] = s1[sa1[i]];
+    }
+    for (size_t i = n1; i < n; i++) {
+        sa[i] = EMPTY;
+    }
+    for (size_t i = n1; i-- > 0;) {
+        uint32_t j = sa[i];
+        sa[i] = EMPTY;
+        sa[--bkt[chr(s, j)]] = j;
+    }
+    induce_l(s, t, sa, bkt, k);
+    induce_s(s, t, sa, bkt, k);
+    arena->used -= k + 1;
+    arena->used -= (n + 31) / 32;
+    return true;
+}
+
+static void get_buckets(const text_t *s, uint32_t *bkt, size_t k, bool end) {
+    memset(bkt, 0, (k + 1) * sizeof(uint32_t));
+    for (size_t i = 0; i < s->n; i++) {
+        bkt[chr(s, i)] += 1;
+    }
+    uint32_t sum = 0;
+    for (size_t c = 0; c <= k; c++) {
+        sum += bkt[c];
+        bkt[c] = end ? sum : sum - bkt[c];
+    }
+}
+
+static void induce_l(const text_t *s, const uint32_t *t, uint32_t *sa,
+                     uint32_t *bkt, size_t k) {
+    get_buckets(s, bkt, k, false);
+    for (size_t i = 0; i < s->n; i++) {
+        uint32_t j = sa[i];
+        if (j != EMPTY && j > 0 && !tget(t, j - 1)) {
+            sa[bkt[chr(s, j - 1)]++] = j - 1;
+        }
+    }
+}
+
+static void induce_s(const text_t *s, const uint32_t *t, uint32_t *sa,
+                     uint32_t *bkt, size_t k) {
+    get_buckets(s, bkt, k, true);
+    for (size_t i = s->n; i-- > 0;) {
+        uint32_t j = sa[i];
+        if (j != EMPTY && j > 0 && tget(t, j - 1)) {
+            sa[--bkt[chr(s, j - 1)]] = j - 1;
+        }
+    }
+}
+
+static void find_range(const mu_string_index_t *index, mu_string_t needle,
+                       size_t *lo, size_t *hi) {
+    const char *text = index->corpus.buf;
+    const size_t n = index->corpus.len;
+
+    // Lower bound: the first suffix not less than the needle.
+    size_t a = 0, b = n;
+    while (a < b) {
+        size_t mid = a + (b - a) / 2;
+        size_t off = index->sa[mid];
+        size_t rem = n - off;
+        int c = memcmp(&text[off], needle.buf, rem < needle.len ? rem : needle.len);
+        if (c < 0 || (c == 0 && rem < needle.len)) {
+            a = mid + 1;
+        } else {
+            b = mid;
+        }
+    }
+    *lo = a;
+
+    // Upper bound: the first suffix that does not start with the needle.
+    b = n;
+    while (a < b) {
+        size_t mid = a + (b - a) / 2;
+        size_t off = index->sa[mid];
+        size_t rem = n - off;
+        if (rem >= needle.len && memcmp(&text[off], needle.buf, needle.len) == 0) {
+            a = mid + 1;
+        } else {
+            b = mid;
+        }
+    }
+    *hi = a;
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,570 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_parse.c
+ *
+ * @brief Implements the mu_string_parse field parsers.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_parse.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define IS_DIGIT(ch) ((ch) >= '0' && (ch) <= '9')
+
+#define NS_PER_SECOND 1000000000LL
+
+/**
+ * @brief Byte masks selecting the digit positions of "YYYY-MM-" and
+ * "DDThh:mm" when loaded as little-endian 64-bit words.
+ */
+#define DATE_DIGIT_MASK 0x00FFFF00FFFFFFFFULL
+#define TIME_DIGIT_MASK 0xFFFF00FFFF00FFFFULL
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Loads 8 bytes as a little-endian word regardless of host byte order
+ * or alignment.
+ */
+static uint64_t load_le64(const char *p);
+
+/**
+ * @brief Returns true if every byte of `v` selected by `mask` is an ASCII
+ * digit, testing all eight bytes at once.
+ */
+static bool swar_all_digits(uint64_t v, uint64_t mask);
+
+/**
+ * @brief Returns the two-digit value at `p`; digits must already be
+ * validated.
+ */
+static int two_digits(const char *p);
+
+/**
+ * @brief Days since 1970-01-01 for a proleptic Gregorian date.
+ */
+static int64_t days_from_civil(int y, int m, int d);
+
+static int days_in_month(int y, int m);
+
+static int hex_value(char ch);
+
+/**
+ * @brief Formats `addr` as a dotted quad into `out`, which must have room for
+ * MU_STRING_IPV4_MAX_LEN bytes.  Returns the number of bytes written.
+ */
+static size_t ipv4_to_text(char *out, const uint8_t addr[4]);
+
+/**
+ * @brief Formats `addr` per RFC 5952 into `out`, which must have room for
+ * MU_STRING_IPV6_MAX_LEN bytes.  Returns the number of bytes written.
+ */
+static size_t ipv6_to_text(char *out, const uint8_t addr[16]);
+
+/**
+ * @brief Copies `len` bytes of `text` to the start of `dst` if they fit.
+ */
+static mu_string_t emit(mu_string_mut_t dst, const char *text, size_t len);
+
+// *****************************************************************************
+// Public code
+
+bool mu_string_parse_iso8601(mu_string_t s, mu_string_timestamp_t *out,
+                             mu_string_t *rest) {
+    if (!mu_string_is_valid(s) || out == NULL || s.len < 10) {
+        return false;
+    }
+    const char *p = s.buf;
+    size_t i;
+    int year, month, day;
+    int hour = 0, minute = 0, second = 0;
+    int64_t frac_ns = 0;
+    int offset = 0;
+
+    bool has_time = false;
+    if (s.len > 10 && (p[10] == 'T' || p[10] == 't')) {
+        if (s.len < 19) {
+            return false; // 'T' must be followed by a full hh:mm:ss
+        }
+        has_time = true;
+    } else if (s.len >= 19 && p[10] == ' ') {
+        // A space introduces a time only when "hh:mm:ss" follows; otherwise
+        // it ends a date-only timestamp.
+        has_time = IS_DIGIT(p[11]) && IS_DIGIT(p[12]) && p[13] == ':' &&
+                   IS_DIGIT(p[14]) && IS_DIGIT(p[15]) && p[16] == ':' &&
+                   IS_DIGIT(p[17]) && IS_DIGIT(p[18]);
+    }
+
+    if (has_time) {
+        // Validate the 16 bytes "YYYY-MM-DDThh:mm" as two words, then the
+        // remaining ":ss" individually.
+        uint64_t w0 = load_le64(p);
+        uint64_t w1 = load_le64(p + 8);
+        if (!swar_all_digits(w0, DATE_DIGIT_MASK) ||
+            !swar_all_digits(w1, TIME_DIGIT_MASK) ||
+            p[4] != '-' || p[7] != '-' || p[13] != ':' || p[16] != ':' ||
+            !IS_DIGIT(p[17]) || !IS_DIGIT(p[18])) {
+            return false;
+        }
+        hour = two_digits(p + 11);
+        minute = two_digits(p + 14);
+        second = two_digits(p + 17);
+        if (hour > 23 || minute > 59 || second > 60) {
+            return false;
+        }
+        i = 19;
+
+        if (i < s.len && p[i] == '.') {
+            size_t start = ++i;
+            int64_t scale = NS_PER_SECOND;
+            while (i < s.len && IS_DIGIT(p[i])) {
+                if (scale > 1) {
+                    scale /= 10;
+                    frac_ns += (p[i] - '0') * scale;
+                }
+                i += 1;
+            }
+            if (i == start) {
+                return false; // '.' with no digits
+            }
+        }
+
+        if (i < s.len && (p[i] == 'Z' || p[i] == 'z')) {
+            i += 1;
+        } else if (i < s.len && (p[i] == '+' || p[i] == '-')) {
+            int sign = (p[i] == '-') ? -1 : 1;
+            if (s.len - i < 5 || !IS_DIGIT(p[i + 1]) || !IS_DIGIT(p[i + 2])) {
+                return false;
+            }
+            int oh = two_digits(p + i + 1);
+            size_t j = i + 3;
+            if (p[j] == ':') {
+                j += 1;
+            }
+            if (s.len - j < 2 || !IS_DIGIT(p[j]) || !IS_DIGIT(p[j + 1])) {
+                return false;
+            }
+            int om = two_digits(p + j);
+            if (oh > 23 || om > 59) {
+                return false;
+            }
+            offset = sign * (oh * 60 + om);
+            i = j + 2;
+        }
+    } else {
+        uint64_t w0 = load_le64(p);
+        if (!swar_all_digits(w0, DATE_DIGIT_MASK) || p[4] != '-' ||
+            p[7] != '-' || !IS_DIGIT(p[8]) || !IS_DIGIT(p[9])) {
+            return false;
+        }
+        i = 10;
+    }
+
+    year = two_digits(p) * 100 + two_digits(p + 2);
+    month = two_digits(p + 5);
+    day = two_digits(p + 8);
+    if (month < 1 || month > 12 || day < 1 || day > days_in_month(year, month)) {
+        return false;
+    }
+    // Keep the result within int64_t nanoseconds.
+    if (year < 1678 || year > 2261) {
+        return false;
+    }
+
+    int64_t seconds = days_from_civil(year, month, day) * 86400 +
+                      hour * 3600 + minute * 60 + second -
+                      (int64_t)offset * 60;
+    out->epoch_ns = seconds * NS_PER_SECOND + frac_ns;
+    out->offset_minutes = (int16_t)offset;
+    if (rest) {
+        *rest = (mu_string_t){ .buf = p + i, .len = s.len - i };
+    }
+    return true;
+}
+
+bool mu_string_parse_ipv4(mu_string_t s, uint8_t out[4], mu_string_t *rest) {
+    if (!mu_string_is_valid(s) || out == NULL) {
+        return false;
+    }
+    const char *p = s.buf;
+    const size_t len = s.len;
+    uint8_t addr[4];
+    size_t i = 0;
+
+    for (int octet = 0; octet < 4; ++octet) {
+        if (octet > 0) {
+            if (i == len || p[i] != '.') {
+                return false;
+            }
+            i += 1;
+        }
+        // One to three digits; a leading zero must stand alone.
+        if (i == len || !IS_DIGIT(p[i])) {
+            return false;
+        }
+        unsigned v = (unsigned)(p[i++] - '0');
+        if (v != 0) {
+            if (i < len && IS_DIGIT(p[i])) {
+                v = v * 10 + (unsigned)(p[i++] - '0');
+                if (i < len && IS_DIGIT(p[i])) {
+                    v = v * 10 + (unsigned)(p[i++] - '0');
+                }
+            }
+        }
+        if (v > 255 || (i < len && IS_DIGIT(p[i]))) {
+            return false;
+        }
+        addr[octet] = (uint8_t)v;
+    }
+    if (i < len && p[i] == '.') {
+        return false; // more than four octets
+    }
+
+    memcpy(out, addr, sizeof(addr));
+    if (rest) {
+        *rest = (mu_string_t){ .buf = p + i, .len = len - i };
+    }
+    return true;
+}
+
+bool mu_string_parse_ipv6(mu_string_t s, uint8_t out[16], mu_string_t *rest) {
+    if (!mu_string_is_valid(s) || out == NULL) {
+        return false;
+    }
+    const char *p = s.buf;
+    const size_t len = s.len;
+    uint8_t addr[16] = { 0 };
+    size_t n = 0;          // bytes of addr filled
+    size_t gap = SIZE_MAX; // where "::" was seen, as a byte offset in addr
+    size_t i = 0;
+    bool need_group = true;
+
+    if (len >= 2 && p[0] == ':' && p[1] == ':') {
+        gap = 0;
+        i = 2;
+        need_group = false;
+    }
+
+    while (n < 16) {
+        size_t start = i;
+        unsigned v = 0;
+        while (i < len && i - start < 4) {
+            int h = hex_value(p[i]);
+            if (h < 0) {
+                break;
+            }
+            v = (v << 4) | (unsigned)h;
+            i += 1;
+        }
+        if (i == start) {
+            break; // no group here; valid only directly after "::"
+        }
+        if (i < len && p[i] == '.') {
+            // Embedded IPv4 in the last 32 bits.
+            mu_string_t v4_rest;
+            if (n > 12 || !mu_string_parse_ipv4((mu_string_t){ .buf = p + start,
+                                                                .len = len - start },
+                                                 &addr[n], &v4_rest)) {
+                return false;
+            }
+            n += 4;
+            i = (size_t)(v4_rest.buf - p);
+            need_group = false;
+            break;
+        }
+        if (i < len && hex_value(p[i]) >= 0) {
+            return false; // more than four hex digits
+        }
+        addr[n++] = (uint8_t)(v >> 8);
+        addr[n++] = (uint8_t)v;
+        need_group = false;
+
+        if (i + 1 < len && p[i] == ':' && p[i + 1] == ':') {
+            if (gap != SIZE_MAX) {
+                return false; // only one "::" allowed
+            }
+            gap = n;
+            i += 2;
+        } else if (i < len && p[i] == ':' && n < 16) {
+            i += 1;
+            need_group = true;
+        } else {
+            break;
+        }
+    }
+
+    if (need_group) {
+        return false;
+    }
+    if (i < len && (p[i] == ':' || p[i] == '.' || hex_value(p[i]) >= 0)) {
+        return false; // address runs on past eight groups
+    }
+    if (gap != SIZE_MAX) {
+        if (n == 16) {
+            return false; // "::" must stand for at least one group
+        }
+        // Slide the groups after the gap to the end of the address.
+        size_t tail = n - gap;
+        memmove(&addr[16 - tail], &addr[gap], tail);
+        memset(&addr[gap], 0, 16 - tail - gap);
+    } else if (n != 16) {
+        return false;
+    }
+
+    memcpy(out, addr, sizeof(addr));
+    if (rest) {
+        *rest = (mu_string_t){ .buf = p + i, .len = len - i };
+    }
+    return true;
+}
+
+bool mu_string_parse_cidr(mu_string_t s, mu_string_cidr_t *out,
+                          mu_string_t *rest) {
+    if (!mu_string_is_valid(s) || out == NULL) {
+        return false;
+    }
+    mu_string_cidr_t cidr = { 0 };
+    mu_string_t after;
+    unsigned max_prefix;
+
+    if (mu_string_parse_ipv4(s, cidr.addr, &after) && after.len > 0 &&
+        after.buf[0] == '/') {
+        cidr.is_ipv6 = false;
+        max_prefix = 32;
+    } else if (mu_string_parse_ipv6(s, cidr.addr, &after)) {
+        cidr.is_ipv6 = true;
+        max_prefix = 128;
+    } else {
+        return false;
+    }
+    if (after.len < 2 || after.buf[0] != '/' || !IS_DIGIT(after.buf[1])) {
+        return false;
+    }
+
+    size_t i = 1;
+    unsigned prefix = 0;
+    while (i < after.len && IS_DIGIT(after.buf[i]) && i <= 3) {
+        prefix = prefix * 10 + (unsigned)(after.buf[i] - '0');
+        i += 1;
+    }
+    if (prefix > max_prefix || (i < after.len && IS_DIGIT(after.buf[i])) ||
+        (after.buf[1] == '0' && i > 2)) {
+        return false;
+    }
+    cidr.prefix_len = (uint8_t)prefix;
+
+    *out = cidr;
+    if (rest) {
+        *rest = (mu_string_t){ .buf = after.buf + i, .len = after.len - i };
+    }
+    return true;
+}
+
+mu_string_t mu_string_format_ipv4(mu_string_mut_t dst, const uint8_t addr[4]) {
+    char text[MU_STRING_IPV4_MAX_LEN];
+    if (addr == NULL) {
+        return MU_STRING_INVALID;
+    }
+    return emit(dst, text, ipv4_to_text(text, addr));
+}
+
+mu_string_t mu_string_format_ipv6(mu_string_mut_t dst, const uint8_t addr[16]) {
+    char text[MU_STRING_IPV6_MAX_LEN];
+    if (addr == NULL) {
+        return MU_STRING_INVALID;
+    }
+    return emit(dst, text, ipv6_to_text(text, addr));
+}
+
+mu_string_t mu_string_format_cidr(mu_string_mut_t dst,
+                                  const mu_string_cidr_t *cidr) {
+    char text[MU_STRING_CIDR_MAX_LEN];
+    if (cidr == NULL) {
+        return MU_STRING_INVALID;
+    }
+    size_t n = cidr->is_ipv6 ? ipv6_to_text(text, cidr->addr)
+                             : ipv4_to_text(text, cidr->addr);
+    unsigned prefix = cidr->prefix_len;
+    text[n++] = '/';
+    if (prefix >= 100) {
+        text[n++] = (char)('0' + prefix / 100);
+    }
+    if (prefix >= 10) {
+        text[n++] = (char)('0' + (prefix / 10) % 10);
+    }
+    text[n++] = (char)('0' + prefix % 10);
+    return emit(dst, text, n);
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static uint64_t load_le64(const char *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return (uint64_t)b[0] | ((uint64_t)b[1] << 8) | ((uint64_t)b[2] << 16) |
+           ((uint64_t)b[3] << 24) | ((uint64_t)b[4] << 32) |
+           ((uint64_t)b[5] << 40) | ((uint64_t)b[6] << 48) |
+           ((uint64_t)b[7] << 56);
+}
+
+static bool swar_all_digits(uint64_t v, uint64_t mask) {
+    // A byte is a digit iff its high nibble is 3 and adding 6 leaves the
+    // high nibble at 3 (i.e. the low nibble is at most 9).
+    const uint64_t hi = 0xF0F0F0F0F0F0F0F0ULL & mask;
+    const uint64_t threes = 0x3030303030303030ULL & mask;
+    const uint64_t sixes = 0x0606060606060606ULL & mask;
+    return ((v & hi) == threes) && (((v & mask) + sixes) & hi) == threes;
+}
+
+static int two_digits(const char *p) {
+    return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+static int64_t days_from_civil(int y, int m, int d) {
+    // H. Hinnant, "chrono-Compatible Low-Level Date Algorithms".
+    y -= (m <= 2);
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static int days_in_month(int y, int m) {
+    static const uint8_t days[12] = { 31, 28, 31, 30, 31, 30,
+                                      31, 31, 30, 31, 30, 31 };
+    if (m == 2 && (y % 4 == 0) && (y % 100 != 0 || y % 400 == 0)) {
+        return 29;
+    }
+    return days[m - 1];
+}
+
+static int hex_value(char ch) {
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+static size_t ipv4_to_text(char *out, const uint8_t addr[4]) {
+    size_t n = 0;
+    for (int k = 0; k < 4; ++k) {
+        unsigned v = addr[k];
+        if (k > 0) {
+            out[n++] = '.';
+        }
+        if (v >= 100) {
+            out[n++] = (char)('0' + v / 100);
+        }
+        if (v >= 10) {
+            out[n++] = (char)('0' + (v / 10) % 10);
+        }
+        out[n++] = (char)('0' + v % 10);
+    }
+    return n;
+}
+
+static size_t ipv6_to_text(char *out, const uint8_t addr[16]) {
+    static const char hex[] = "0123456789abcdef";
+    static const uint8_t mapped_prefix[12] = { 0, 0, 0, 0, 0, 0,
+                                               0, 0, 0, 0, 0xff, 0xff };
+    size_t n = 0;
+
+    if (memcmp(addr, mapped_prefix, sizeof(mapped_prefix)) == 0) {
+        memcpy(out, "::ffff:", 7);
+        return 7 + ipv4_to_text(out + 7, addr + 12);
+    }
+
+    // Find the longest run of two or more zero groups (first one wins ties).
+    int best_start = -1;
+    int best_len = 1;
+    for (int g = 0; g < 8;) {
+        if (addr[2 * g] != 0 || addr[2 * g + 1] != 0) {
+            g += 1;
+            continue;
+        }
+        int start = g;
+        while (g < 8 && addr[2 * g] == 0 && addr[2 * g + 1] == 0) {
+            g += 1;
+        }
+        if (g - start > best_len) {
+            best_start = start;
+            best_len = g - start;
+        }
+    }
+
+    for (int g = 0; g < 8; ++g) {
+        if (g == best_start) {
+            out[n++] = ':';
+            out[n++] = ':';
+            g += best_len - 1;
+            continue;
+        }
+        if (g > 0 && out[n - 1] != ':') {
+            out[n++] = ':';
+        }
+        unsigned v = ((unsigned)addr[2 * g] << 8) | addr[2 * g + 1];
+        bool started = false;
+        for (int shift = 12; shift >= 0; shift -= 4) {
+            unsigned nibble = (v >> shift) & 0xF;
+            if (nibble != 0 || started || shift == 0) {
+                out[n++] = hex[nibble];
+                started = true;
+            }
+        }
+    }
+    return n;
+}
+
+static mu_string_t emit(mu_string_mut_t dst, const char *text, size_t len) {
+    if (dst.buf == NULL || dst.len < len) {
+        return MU_STRING_INVALID;
+    }
+    memcpy(dst.buf, text, len);
+    return (mu_string_t){ .buf = dst.buf, .len = len };
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,1006 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_regex.c
+ *
+ * @brief Implements the mu_string_regex engine.
+ *
+ * Patterns compile to a Thompson program (see Cox, "Regular Expression
+ * Matching: the Virtual Machine Approach").  The program is parsed by
+ * recursive descent and emitted in place; a quantifier that follows an atom
+ * inserts its SPLIT in front of the code already emitted for that atom.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_regex.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+typedef enum {
+    OP_CHAR,  // consume byte `arg`
+    OP_ANY,   // consume any byte except '\n'
+    OP_CLASS, // consume a byte in class `arg`
+    OP_SPLIT, // fork to `x` (preferred) and `y`
+    OP_JMP,   // continue at `x`
+    OP_SAVE,  // record the current offset in capture slot `arg`
+    OP_BOL,   // assert offset 0
+    OP_EOL,   // assert end of input
+    OP_MATCH, // success
+} op_t;
+
+#define DFA_MATCH 0x01        // a match ends before the next byte
+#define DFA_MATCH_AT_EOF 0x02 // a match ends here if this is end of input
+#define DFA_DEAD 0x04         // no thread can ever match
+
+#define CAP_UNSET UINT32_MAX
+
+typedef struct {
+    mu_string_regex_t *re;
+    const char *p;
+    size_t i;
+    size_t len;
+    bool ok;
+} parser_t;
+
+typedef struct {
+    const mu_string_regex_t *re;
+    mu_string_regex_cache_t *cache;
+    size_t len;
+    size_t n[2]; // threads in each list
+} pike_t;
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Appends an instruction and returns its index, or fails the parse.
+ */
+static size_t emit(parser_t *ps, uint8_t op, uint8_t arg);
+
+/**
+ * @brief Inserts an instruction at `pos`, shifting the code after it.
+ *
+ * Jump targets held by instructions in the shifted code that point at or
+ * past `pos` move with it.  Targets in earlier code that point exactly at
+ * `pos` are left alone: they refer to whatever starts there, which is now
+ * the inserted instruction.
+ */
+static bool insert_at(parser_t *ps, size_t pos, uint8_t op, uint8_t x,
+                      uint8_t y);
+
+static void parse_alt(parser_t *ps);
+static void parse_concat(parser_t *ps);
+static bool parse_atom(parser_t *ps);
+static void parse_class(parser_t *ps);
+
+/**
+ * @brief Adds the class for escape `ch` (`d`, `w`, `s` or their negations)
+ * to `set`.  Returns false if `ch` is not a class escape.
+ */
+static bool escape_class(char ch, uint32_t set[8]);
+
+/**
+ * @brief Decodes a single-byte escape (`\n`, `\xHH`, `\.` ...) whose letter
+ * is at `ps->p[ps->i]`, advancing past it.  Returns -1 if it is invalid.
+ */
+static int escape_byte(parser_t *ps);
+
+/**
+ * @brief Emits an OP_CLASS for `set`, reusing an identical class if one
+ * already exists.
+ */
+static void emit_class(parser_t *ps, const uint32_t set[8]);
+
+/**
+ * @brief Computes the byte equivalence classes, literal prefix and anchoring
+ * of a freshly compiled program.
+ */
+static void analyze(mu_string_regex_t *re);
+
+/**
+ * @brief Returns true if consuming instruction `in` accepts byte `b`.
+ */
+static bool inst_accepts(const mu_string_regex_t *re,
+                         const mu_string_regex_inst_t *in, uint8_t b);
+
+/**
+ * @brief Follows empty transitions from the instructions in `seeds` and
+ * stores the reachable consuming and MATCH instructions in `out`.
+ */
+static void closure(const mu_string_regex_t *re, const uint64_t *seeds,
+                    bool at_bol, bool at_eol, uint64_t *out);
+
+/**
+ * @brief Returns the index of the DFA state reached from `seeds`, adding it
+ * to the cache.  If the cache is full it is flushed first, which forgets
+ * every other state and transition.
+ */
+static size_t dfa_state(mu_string_regex_cache_t *cache, const uint64_t *seeds,
+                        bool at_bol);
+
+/**
+ * @brief Returns the DFA state for a thread starting at offset 0 (`at_bol`)
+ * or elsewhere.
+ */
+static size_t dfa_start(mu_string_regex_cache_t *cache, bool at_bol);
+
+/**
+ * @brief Returns the DFA state reached from state `cur` on byte `b`.
+ */
+static size_t dfa_next(mu_string_regex_cache_t *cache, size_t cur, uint8_t b);
+
+/**
+ * @brief Runs the DFA over `s` from `start`.  Returns true if any match
+ * exists.
+ */
+static bool dfa_search(const mu_string_regex_t *re,
+                       mu_string_regex_cache_t *cache, mu_string_t s,
+                       size_t start);
+
+/**
+ * @brief Adds a Pike VM thread at `pc` with captures `caps` to list
+ * `which`, following empty transitions at offset `pos`.
+ */
+static void pike_add(pike_t *vm, int which, size_t pc, uint32_t *caps,
+                     size_t pos, uint64_t *on_list);
+
+/**
+ * @brief Runs the Pike VM over `s` from `start` and stores the capture
+ * offsets of the leftmost-first match in `caps`.  Returns true on a match.
+ */
+static bool pike_search(const mu_string_regex_t *re,
+                        mu_string_regex_cache_t *cache, mu_string_t s,
+                        size_t start, uint32_t caps[MU_STRING_REGEX_SLOTS]);
+
+/**
+ * @brief Returns the offset at which a search of `s` should begin, or
+ * SIZE_MAX if the literal prefix shows there can be no match.
+ */
+static size_t search_start(const mu_string_regex_t *re, mu_string_t s);
+
+/**
+ * @brief Returns the offset of the first occurrence of the literal prefix
+ * in `s` at or after `from`, or SIZE_MAX if there is none.
+ */
+static size_t skip_to_prefix(const mu_string_regex_t *re, mu_string_t s,
+                             size_t from);
+
+static inline bool set_has(const uint64_t *set, size_t i) {
+    return (set[i >> 6] >> (i & 63)) & 1;
+}
+
+static inline void set_add(uint64_t *set, size_t i) {
+    set[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+static inline bool set_is_empty(const uint64_t *set) {
+    for (size_t w = 0; w < MU_STRING_REGEX_SET_WORDS; w++) {
+        if (set[w]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline bool class_has(const uint32_t set[8], uint8_t b) {
+    return (set[b >> 5] >> (b & 31)) & 1;
+}
+
+static inline void class_add(uint32_t set[8], uint8_t b) {
+    set[b >> 5] |= (uint32_t)1 << (b & 31);
+}
+
+// *****************************************************************************
+// Public code
+
+mu_string_regex_t *mu_string_regex_compile(mu_string_regex_t *re,
+                                           mu_string_t pattern) {
+    if (re == NULL || !mu_string_is_valid(pattern)) {
+        return NULL;
+    }
+    memset(re, 0, sizeof(*re));
+    parser_t ps = { .re = re, .p = pattern.buf, .i = 0, .len = pattern.len,
+                    .ok = true };
+    parse_alt(&ps);
+    if (ps.i < ps.len) {
+        ps.ok = false; // unbalanced ')'
+    }
+    emit(&ps, OP_MATCH, 0);
+    if (!ps.ok) {
+        return NULL;
+    }
+    analyze(re);
+    return re;
+}
+
+mu_string_regex_cache_t *mu_string_regex_cache_init(mu_string_regex_cache_t *cache,
+                                                    const mu_string_regex_t *re) {
+    if (cache == NULL || re == NULL) {
+        return NULL;
+    }
+    cache->re = re;
+    cache->n_states = 0;
+    cache->start_state = 0;
+    cache->mid_state = 0;
+    memset(cache->trans, 0, sizeof(cache->trans));
+    return cache;
+}
+
+size_t mu_string_regex_group_count(const mu_string_regex_t *re) {
+    return (re == NULL) ? 0 : re->n_groups;
+}
+
+bool mu_string_regex_is_match(const mu_string_regex_t *re,
+                              mu_string_regex_cache_t *cache, mu_string_t s) {
+    if (re == NULL || cache == NULL || !mu_string_is_valid(s) ||
+        s.len >= UINT32_MAX) {
+        return false;
+    }
+    if (cache->re != re) {
+        mu_string_regex_cache_init(cache, re);
+    }
+    size_t start = search_start(re, s);
+    if (start == SIZE_MAX) {
+        return false;
+    }
+    if (re->n_byte_classes <= MU_STRING_REGEX_MAX_BYTE_CLASSES) {
+        return dfa_search(re, cache, s, start);
+    }
+    uint32_t caps[MU_STRING_REGEX_SLOTS];
+    return pike_search(re, cache, s, start, caps);
+}
+
+bool mu_string_regex_find(const mu_string_regex_t *re,
+                          mu_string_regex_cache_t *cache, mu_string_t s,
+                          mu_string_t *groups, size_t max_groups) {
+    if (re == NULL || cache == NULL || !mu_string_is_valid(s) ||
+        s.len >= UINT32_MAX || (groups == NULL && max_groups > 0)) {
+        return false;
+    }
+    if (cache->re != re) {
+        mu_string_regex_cache_init(cache, re);
+    }
+    size_t start = search_start(re, s);
+    if (start == SIZE_MAX) {
+        return false;
+    }
+    // Most searches fail; let the DFA reject those before paying for the VM.
+    if (re->n_byte_classes <= MU_STRING_REGEX_MAX_BYTE_CLASSES &&
+        !dfa_search(re, cache, s, start)) {
+        return false;
+    }
+    uint32_t caps[MU_STRING_REGEX_SLOTS];
+    if (!pike_search(re, cache, s, start, caps)) {
+        return false;
+    }
+    for (size_t g = 0; g < max_groups; g++) {
+        if (g > re->n_groups || caps[2 * g] == CAP_UNSET ||
+            caps[2 * g + 1] == CAP_UNSET) {
+            groups[g] = MU_STRING_NOT_FOUND;
+        } else {
+            groups[g] = (mu_string_t){ .buf = &s.buf[caps[2 * g]],
+                                       .len = caps[2 * g + 1] - caps[2 * g] };
+        }
+    }
+    return true;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t emit(parser_t *ps, uint8_t op, uint8_t arg) {
+    mu_string_regex_t *re = ps->re;
+    if (re->n_insts >= MU_STRING_REGEX_MAX_INSTS) {
+        ps->ok = false;
+        return 0;
+    }
+    size_t pc = re->n_insts++;
+    re->prog[pc] = (mu_string_regex_inst_t){ .op = op, .arg = arg };
+    return pc;
+}
+
+static bool insert_at(parser_t *ps, size_t pos, uint8_t op, uint8_t x,
+                      uint8_t y) {
+    mu_string_regex_t *re = ps->re;
+    if (re->n_insts >= MU_STRING_REGEX_MAX_INSTS) {
+        ps->ok = false;
+        return false;
+    }
+    for (size_t pc = 0; pc < re->n_insts; pc++) {
+        mu_string_regex_inst_t *in = &re->prog[pc];
+        if (in->op != OP_SPLIT && in->op != OP_JMP) {
+            continue;
+        }
+        size_t lo = (pc < pos) ? pos + 1 : pos;
+        if (in->x >= lo) {
+            in->x += 1;
+        }
+        if (in->op == OP_SPLIT && in->y >= lo) {
+            in->y += 1;
+        }
+    }
+    memmove(&re->prog[pos + 1], &re->prog[pos],
+            (re->n_insts - pos) * sizeof(re->prog[0]));
+    re->n_insts += 1;
+    re->prog[pos] = (mu_string_regex_inst_t){ .op = op, .x = x, .y = y };
+    return true;
+}
+
+static void parse_alt(parser_t *ps) {
+    size_t start = ps->re->n_insts;
+    parse_concat(ps);
+    while (ps->ok && ps->i < ps->len && ps->p[ps->i] == '|') {
+        ps->i += 1;
+        // start: SPLIT start+1, L2
+        //        <previous alternatives>
+        //        JMP end
+        //    L2: <next alternative>
+        //   end:
+        if (!insert_at(ps, start, OP_SPLIT, (uint8_t)(start + 1), 0)) {
+            return;
+        }
+        size_t jmp = emit(ps, OP_JMP, 0);
+        ps->re->prog[start].y = (uint8_t)ps->re->n_insts;
+        parse_concat(ps);
+        ps->re->prog[jmp].x = (uint8_t)ps->re->n_insts;
+    }
+}
+
+static void parse_concat(parser_t *ps) {
+    while (ps->ok && ps->i < ps->len && ps->p[ps->i] != '|' &&
+           ps->p[ps->i] != ')') {
+        size_t start = ps->re->n_insts;
+        if (!parse_atom(ps)) {
+            return;
+        }
+        while (ps->ok && ps->i < ps->len &&
+               (ps->p[ps->i] == '*' || ps->p[ps->i] == '+' ||
+                ps->p[ps->i] == '?')) {
+            char q = ps->p[ps->i++];
+            bool lazy = (ps->i < ps->len && ps->p[ps->i] == '?');
+            if (lazy) {
+                ps->i += 1;
+            }
+            size_t end = ps->re->n_insts;
+            if (end == start) {
+                continue; // empty atom, e.g. "(?:)*": nothing to repeat
+            }
+            mu_string_regex_inst_t *prog = ps->re->prog;
+            if (q == '*') {
+                // start: SPLIT start+1, exit ; body ; JMP start ; exit:
+                if (!insert_at(ps, start, OP_SPLIT, 0, 0)) {
+                    return;
+                }
+                size_t jmp = emit(ps, OP_JMP, 0);
+                prog[jmp].x = (uint8_t)start;
+                uint8_t body = (uint8_t)(start + 1);
+                uint8_t exit = (uint8_t)ps->re->n_insts;
+                prog[start].x = lazy ? exit : body;
+                prog[start].y = lazy ? body : exit;
+            } else if (q == '+') {
+                // start: body ; SPLIT start, exit ; exit:
+                size_t split = emit(ps, OP_SPLIT, 0);
+                uint8_t exit = (uint8_t)ps->re->n_insts;
+                prog[split].x = lazy ? exit : (uint8_t)start;
+                prog[split].y = lazy ? (uint8_t)start : exit;
+            } else {
+                // start: SPLIT start+1, exit ; body ; exit:
+                if (!insert_at(ps, start, OP_SPLIT, 0, 0)) {
+                    return;
+                }
+                uint8_t body = (uint8_t)(start + 1);
+                uint8_t exit = (uint8_t)ps->re->n_insts;
+                prog[start].x = lazy ? exit : body;
+                prog[start].y = lazy ? body : exit;
+            }
+        }
+    }
+}
+
+static bool parse_atom(parser_t *ps) {
+    mu_string_regex_t *re = ps->re;
+    char ch = ps->p[ps->i++];
+    switch (ch) {
+    case '(': {
+        bool capture = true;
+        if (ps->i + 1 < ps->len && ps->p[ps->i] == '?' &&
+            ps->p[ps->i + 1] == ':') {
+            capture = false;
+            ps->i += 2;
+        }
+        size_t group = 0;
+        if (capture) {
+            if (re->n_groups >= MU_STRING_REGEX_MAX_GROUPS) {
+                ps->ok = false;
+                return false;
+            }
+            group = ++re->n_groups;
+            emit(ps, OP_SAVE, (uint8_t)(2 * group));
+        }
+        parse_alt(ps);
+        if (ps->i >= ps->len || ps->p[ps->i] != ')') {
+            ps->ok = false;
+            return false;
+        }
+        ps->i += 1;
+        if (capture) {
+            emit(ps, OP_SAVE, (uint8_t)(2 * group + 1));
+        }
+        break;
+    }
+    case '[':
+        parse_class(ps);
+        break;
+    case '.':
+        emit(ps, OP_ANY, 0);
+        break;
+    case '^':
+        emit(ps, OP_BOL, 0);
+        break;
+    case '$':
+        emit(ps, OP_EOL, 0);
+        re->has_eol = true;
+        break;
+    case '*':
+    case '+':
+    case '?':
+        ps->ok = false; // nothing to repeat
+        return false;
+    case '\\': {
+        if (ps->i >= ps->len) {
+            ps->ok = false;
+            return false;
+        }
+        uint32_t set[8] = { 0 };
+        if (escape_class(ps->p[ps->i], set)) {
+            ps->i += 1;
+            emit_class(ps, set);
+        } else {
+            int b = escape_byte(ps);
+            if (b < 0) {
+                ps->ok = false;
+                return false;
+            }
+            emit(ps, OP_CHAR, (uint8_t)b);
+        }
+        break;
+    }
+    default:
+        emit(ps, OP_CHAR, (uint8_t)ch);
+        break;
+    }
+    return ps->ok;
+}
+
+static void parse_class(parser_t *ps) {
+    uint32_t set[8] = { 0 };
+    bool negate = false;
+    if (ps->i < ps->len && ps->p[ps->i] == '^') {
+        negate = true;
+        ps->i += 1;
+    }
+    bool first = true;
+    for (;;) {
+        if (ps->i >= ps->len) {
+            ps->ok = false; // unterminated
+            return;
+        }
+        char ch = ps->p[ps->i];
+        if (ch == ']' && !first) {
+            ps->i += 1;
+            break;
+        }
+        first = false;
+        int lo;
+        ps->i += 1;
+        if (ch == '\\') {
+            if (ps->i >= ps->len) {
+                ps->ok = false;
+                return;
+            }
+            if (escape_class(ps->p[ps->i], set)) {
+                ps->i += 1;
+                continue;
+            }
+            lo = escape_byte(ps);
+            if (lo < 0) {
+                ps->ok = false;
+                return;
+            }
+        } else {
+            lo = (uint8_t)ch;
+        }
+        int hi = lo;
+        if (ps->i + 1 < ps->len && ps->p[ps->i] == '-' &&
+            ps->p[ps->i + 1] != ']') {
+            ps->i += 1;
+            char h = ps->p[ps->i++];
+            if (h == '\\') {
+                hi = (ps->i < ps->len) ? escape_byte(ps) : -1;
+            } else {
+                hi = (uint8_t)h;
+            }
+            if (hi < lo) {
+                ps->ok = false;
+                return;
+            }
+        }
+        for (int b = lo; b <= hi; b++) {
+            class_add(set, (uint8_t)b);
+        }
+    }
+    if (negate) {
+        for (int w = 0; w < 8; w++) {
+            set[w] = ~set[w];
+        }
+    }
+    emit_class(ps, set);
+}
+
+static bool escape_class(char ch, uint32_t set[8]) {
+    uint32_t tmp[8] = { 0 };
+    switch (ch) {
+    case 'd':
+    case 'D':
+        for (int b = '0'; b <= '9'; b++) {
+            class_add(tmp, (uint8_t)b);
+        }
+        break;
+    case 'w':
+    case 'W':
+        for (int b = 0; b < 256; b++) {
+            if ((b >= '0' && b <= '9') || (b >= 'A' && b <= 'Z') ||
+                (b >= 'a' && b <= 'z') || b == '_') {
+                class_add(tmp, (uint8_t)b);
+            }
+        }
+        break;
+    case 's':
+    case 'S':
+        class_add(tmp, ' ');
+        for (int b = '\t'; b <= '\r'; b++) {
+            class_add(tmp, (uint8_t)b);
+        }
+        break;
+    default:
+        return false;
+    }
+    bool negate = (ch == 'D' || ch == 'W' || ch == 'S');
+    for (int w = 0; w < 8; w++) {
+        set[w] |= negate ? ~tmp[w] : tmp[w];
+    }
+    return true;
+}
+
+static int escape_byte(parser_t *ps) {
+    char ch = ps->p[ps->i++];
+    switch (ch) {
+    case 'n':
+        return '\n';
+    case 't':
+        return '\t';
+    case 'r':
+        return '\r';
+    case 'f':
+        return '\f';
+    case 'v':
+        return '\v';
+    case 'x': {
+        int value = 0;
+        for (int k = 0; k < 2; k++) {
+            if (ps->i >= ps->len) {
+                return -1;
+            }
+            char h = ps->p[ps->i++];
+            int d = (h >= '0' && h <= '9')   ? h - '0'
+                    : (h >= 'a' && h <= 'f') ? h - 'a' + 10
+                    : (h >= 'A' && h <= 'F') ? h - 'A' + 10
+                                             : -1;
+            if (d < 0) {
+                return -1;
+            }
+            value = value * 16 + d;
+        }
+        return value;
+    }
+    default:
+        // Only punctuation may be escaped, so that new escapes can be added
+        // later without changing the meaning of existing patterns.
+        if ((ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'Z') ||
+            (ch >= 'a' && ch <= 'z')) {
+            return -1;
+        }
+        return (uint8_t)ch;
+    }
+}
+
+static void emit_class(parser_t *ps, const uint32_t set[8]) {
+    mu_string_regex_t *re = ps->re;
+    size_t k;
+    for (k = 0; k < re->n_classes; k++) {
+        if (memcmp(re->classes[k], set, sizeof(re->classes[k])) == 0) {
+            break;
+        }
+    }
+    if (k == re->n_classes) {
+        if (k >= MU_STRING_REGEX_MAX_CLASSES) {
+            ps->ok = false;
+            return;
+        }
+        memcpy(re->classes[k], set, sizeof(re->classes[k]));
+        re->n_classes += 1;
+    }
+    emit(ps, OP_CLASS, (uint8_t)k);
+}
+
+static void analyze(mu_string_regex_t *re) {
+    // Byte classes: two bytes share a class if no instruction can tell them
+    // apart, so the DFA needs one transition per class rather than per byte.
+    bool boundary[257] = { false };
+    for (size_t pc = 0; pc < re->n_insts; pc++) {
+        const mu_string_regex_inst_t *in = &re->prog[pc];
+        if (in->op == OP_CHAR) {
+            boundary[in->arg] = true;
+            boundary[in->arg + 1] = true;
+        } else if (in->op == OP_ANY) {
+            boundary['\n'] = true;
+            boundary['\n' + 1] = true;
+        } else if (in->op == OP_CLASS) {
+            const uint32_t *set = re->classes[in->arg];
+            for (int b = 1; b < 256; b++) {
+                if (class_has(set, (uint8_t)b) !=
+                    class_has(set, (uint8_t)(b - 1))) {
+                    boundary[b] = true;
+                }
+            }
+        }
+    }
+    size_t cls = 0;
+    for (int b = 0; b < 256; b++) {
+        if (b > 0 && boundary[b]) {
+            cls += 1;
+        }
+        re->byte_class[b] = (uint8_t)cls;
+    }
+    re->n_byte_classes = cls + 1;
+
+    // Literal prefix: the CHARs every match must begin with.
+    size_t pc = 0;
+    while (re->prog[pc].op == OP_SAVE || re->prog[pc].op == OP_BOL) {
+        pc += 1;
+    }
+    while (re->prog[pc].op == OP_CHAR &&
+           re->prefix_len < MU_STRING_REGEX_MAX_PREFIX) {
+        re->prefix[re->prefix_len++] = (char)re->prog[pc].arg;
+        pc += 1;
+    }
+
+    // Anchored: no thread survives starting anywhere but offset 0.
+    uint64_t seeds[MU_STRING_REGEX_SET_WORDS] = { 0 };
+    uint64_t set[MU_STRING_REGEX_SET_WORDS];
+    set_add(seeds, 0);
+    closure(re, seeds, false, true, set);
+    re->anchored = set_is_empty(set);
+}
+
+static bool inst_accepts(const mu_string_regex_t *re,
+                         const mu_string_regex_inst_t *in, uint8_t b) {
+    switch (in->op) {
+    case OP_CHAR:
+        return b == in->arg;
+    case OP_ANY:
+        return b != '\n';
+    case OP_CLASS:
+        return class_has(re->classes[in->arg], b);
+    default:
+        return false;
+    }
+}
+
+static void closure(const mu_string_regex_t *re, const uint64_t *seeds,
+                    bool at_bol, bool at_eol, uint64_t *out) {
+    uint64_t seen[MU_STRING_REGEX_SET_WORDS] = { 0 };
+    uint8_t stack[MU_STRING_REGEX_MAX_INSTS];
+    size_t sp = 0;
+
+    memset(out, 0, MU_STRING_REGEX_SET_WORDS * sizeof(uint64_t));
+    for (size_t pc = 0; pc < re->n_insts; pc++) {
+        if (set_has(seeds, pc) && !set_has(seen, pc)) {
+            set_add(seen, pc);
+            stack[sp++] = (uint8_t)pc;
+        }
+    }
+    while (sp > 0) {
+        size_t pc = stack[--sp];
+        const mu_string_regex_inst_t *in = &re->prog[pc];
+        uint8_t next[2];
+        size_t n_next = 0;
+        switch (in->op) {
+        case OP_SPLIT:
+            next[n_next++] = in->x;
+            next[n_next++] = in->y;
+            break;
+        case OP_JMP:
+            next[n_next++] = in->x;
+            break;
+        case OP_SAVE:
+            next[n_next++] = (uint8_t)(pc + 1);
+            break;
+        case OP_BOL:
+            if (at_bol) {
+                next[n_next++] = (uint8_t)(pc + 1);
+            }
+            break;
+        case OP_EOL:
+            if (at_eol) {
+                next[n_next++] = (uint8_t)(pc + 1);
+            }
+            break;
+        default:
+            set_add(out, pc);
+            break;
+        }
+        for (size_t k = 0; k < n_next; k++) {
+            if (!set_has(seen, next[k])) {
+                set_add(seen, next[k]);
+                stack[sp++] = next[k];
+            }
+        }
+    }
+}
+
+static size_t dfa_state(mu_string_regex_cache_t *cache, const uint64_t *seeds,
+                        bool at_bol) {
+    const mu_string_regex_t *re = cache->re;
+    mu_string_regex_dfa_state_t st;
+    closure(re, seeds, at_bol, false, st.set);
+    st.flags = 0;
+    if (set_has(st.set, re->n_insts - 1)) {
+        st.flags |= DFA_MATCH | DFA_MATCH_AT_EOF;
+    } else if (re->has_eol) {
+        uint64_t eof[MU_STRING_REGEX_SET_WORDS];
+        closure(re, seeds, at_bol, true, eof);
+        if (set_has(eof, re->n_insts - 1)) {
+            st.flags |= DFA_MATCH_AT_EOF;
+        }
+    }
+    if (set_is_empty(st.set) && !(st.flags & DFA_MATCH_AT_EOF)) {
+        st.flags |= DFA_DEAD;
+    }
+
+    for (size_t k = 0; k < cache->n_states; k++) {
+        if (cache->states[k].flags == st.flags &&
+            memcmp(cache->states[k].set, st.set, sizeof(st.set)) == 0) {
+            return k;
+        }
+    }
+    if (cache->n_states == MU_STRING_REGEX_CACHE_STATES) {
+        mu_string_regex_cache_init(cache, re);
+    }
+    cache->states[cache->n_states] = st;
+    return cache->n_states++;
+}
+
+static size_t dfa_start(mu_string_regex_cache_t *cache, bool at_bol) {
+    uint8_t *memo = at_bol ? &cache->start_state : &cache->mid_state;
+    if (*memo == 0) {
+        uint64_t seeds[MU_STRING_REGEX_SET_WORDS] = { 0 };
+        set_add(seeds, 0);
+        size_t k = dfa_state(cache, seeds, at_bol);
+        *memo = (uint8_t)(k + 1); // a flush clears both memos first
+    }
+    return *memo - 1u;
+}
+
+static size_t dfa_next(mu_string_regex_cache_t *cache, size_t cur, uint8_t b) {
+    const mu_string_regex_t *re = cache->re;
+    size_t slot = cur * re->n_byte_classes + re->byte_class[b];
+    if (cache->trans[slot]) {
+        return cache->trans[slot] - 1u;
+    }
+    // Step every live thread over `b`, then start a new thread here too:
+    // for a yes/no answer it does not matter where a match began.
+    uint64_t seeds[MU_STRING_REGEX_SET_WORDS] = { 0 };
+    const uint64_t *set = cache->states[cur].set;
+    for (size_t pc = 0; pc < re->n_insts; pc++) {
+        if (set_has(set, pc) && inst_accepts(re, &re->prog[pc], b)) {
+            set_add(seeds, pc + 1);
+        }
+    }
+    set_add(seeds, 0);
+    size_t before = cache->n_states;
+    size_t next = dfa_state(cache, seeds, false);
+    if (cache->n_states >= before) {
+        cache->trans[slot] = (uint8_t)(next + 1); // not flushed
+    }
+    return next;
+}
+
+static bool dfa_search(const mu_string_regex_t *re,
+                       mu_string_regex_cache_t *cache, mu_string_t s,
+                       size_t start) {
+    const uint8_t *buf = (const uint8_t *)s.buf;
+    size_t cur = dfa_start(cache, start == 0);
+
+    for (size_t p = start;; p++) {
+        uint8_t flags = cache->states[cur].flags;
+        if (flags & DFA_MATCH) {
+            return true;
+        }
+        if (p == s.len) {
+            return (flags & DFA_MATCH_AT_EOF) != 0;
+        }
+        if (flags & DFA_DEAD) {
+            return false;
+        }
+        if (re->prefix_len > 0 && p > start && cache->mid_state != 0 &&
+            cur == cache->mid_state - 1u) {
+            // No thread is alive: skip to the next place a match could
+            // begin.
+            p = skip_to_prefix(re, s, p);
+            if (p == SIZE_MAX) {
+                return false;
+            }
+        }
+        cur = dfa_next(cache, cur, buf[p]);
+        if (cache->mid_state == 0 &&
+            cache->n_states < MU_STRING_REGEX_CACHE_STATES) {
+            dfa_start(cache, false); // re-learn it after a flush
+        }
+    }
+}
+
+static void pike_add(pike_t *vm, int which, size_t pc, uint32_t *caps,
+                     size_t pos, uint64_t *on_list) {
+    if (set_has(on_list, pc)) {
+        return;
+    }
+    set_add(on_list, pc);
+    const mu_string_regex_inst_t *in = &vm->re->prog[pc];
+    switch (in->op) {
+    case OP_JMP:
+        pike_add(vm, which, in->x, caps, pos, on_list);
+        break;
+    case OP_SPLIT:
+        pike_add(vm, which, in->x, caps, pos, on_list);
+        pike_add(vm, which, in->y, caps, pos, on_list);
+        break;
+    case OP_SAVE: {
+        uint32_t old = caps[in->arg];
+        caps[in->arg] = (uint32_t)pos;
+        pike_add(vm, which, pc + 1, caps, pos, on_list);
+        caps[in->arg] = old;
+        break;
+    }
+    case OP_BOL:
+        if (pos == 0) {
+            pike_add(vm, which, pc + 1, caps, pos, on_list);
+        }
+        break;
+    case OP_EOL:
+        if (pos == vm->len) {
+            pike_add(vm, which, pc + 1, caps, pos, on_list);
+        }
+        break;
+    default: {
+        size_t t = vm->n[which]++;
+        vm->cache->thread_pc[which][t] = (uint8_t)pc;
+        memcpy(vm->cache->thread_caps[which][t], caps,
+               sizeof(vm->cache->thread_caps[which][t]));
+        break;
+    }
+    }
+}
+
+static bool pike_search(const mu_string_regex_t *re,
+                        mu_string_regex_cache_t *cache, mu_string_t s,
+                        size_t start, uint32_t caps[MU_STRING_REGEX_SLOTS]) {
+    pike_t vm = { .re = re, .cache = cache, .len = s.len };
+    uint64_t on_list[2][MU_STRING_REGEX_SET_WORDS] = { { 0 } };
+    const uint8_t *buf = (const uint8_t *)s.buf;
+    bool matched = false;
+    int cur = 0;
+
+    for (size_t p = start;; p++) {
+        // Threads are kept in priority order.  A thread started here has the
+        // lowest priority, and none are started once a match is found.
+        if (!matched && (!re->anchored || p == 0)) {
+            if (vm.n[cur] == 0 && re->prefix_len > 0 && p > start) {
+                p = skip_to_prefix(re, s, p);
+                if (p == SIZE_MAX) {
+                    break;
+                }
+            }
+            uint32_t init[MU_STRING_REGEX_SLOTS];
+            for (size_t k = 0; k < MU_STRING_REGEX_SLOTS; k++) {
+                init[k] = CAP_UNSET;
+            }
+            init[0] = (uint32_t)p;
+            pike_add(&vm, cur, 0, init, p, on_list[cur]);
+        }
+        if (vm.n[cur] == 0 && (matched || re->anchored)) {
+            break;
+        }
+
+        int nxt = cur ^ 1;
+        vm.n[nxt] = 0;
+        memset(on_list[nxt], 0, sizeof(on_list[nxt]));
+        for (size_t t = 0; t < vm.n[cur]; t++) {
+            size_t pc = cache->thread_pc[cur][t];
+            uint32_t *tcaps = cache->thread_caps[cur][t];
+            if (re->prog[pc].op == OP_MATCH) {
+                memcpy(caps, tcaps, sizeof(uint32_t) * MU_STRING_REGEX_SLOTS);
+                caps[1] = (uint32_t)p;
+                matched = true;
+                break; // cut off lower-priority threads
+            }
+            if (p < s.len && inst_accepts(re, &re->prog[pc], buf[p])) {
+                pike_add(&vm, nxt, pc + 1, tcaps, p + 1, on_list[nxt]);
+            }
+        }
+        vm.n[cur] = 0;
+        cur = nxt;
+        if (p == s.len) {
+            break;
+        }
+    }
+    return matched;
+}
+
+static size_t search_start(const mu_string_regex_t *re, mu_string_t s) {
+    if (re->prefix_len == 0) {
+        return 0;
+    }
+    if (re->anchored) {
+        mu_string_t prefix = { .buf = re->prefix, .len = re->prefix_len };
+        return mu_string_starts_with(s, prefix) ? 0 : SIZE_MAX;
+    }
+    return skip_to_prefix(re, s, 0);
+}
+
+static size_t skip_to_prefix(const mu_string_regex_t *re, mu_string_t s,
+                             size_t from) {
+    mu_string_t rest = { .buf = &s.buf[from], .len = s.len - from };
+    mu_string_t prefix = { .buf = re->prefix, .len = re->prefix_len };
+    mu_string_t hit = mu_string_find_str(rest, prefix);
+    if (hit.len == 0) {
+        return SIZE_MAX; // not found: find_str returns an empty view
+    }
+    return (size_t)(hit.buf - s.buf);
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,212 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_static_set.c
+ *
+ * @brief Implements the mu_string_static_set Eytzinger-ordered set.
+ *
+ * The search is the branch-free Eytzinger lower bound described by Khuong
+ * and Morin ("Array Layouts for Comparison-Based Searching", 2017): descend
+ * from entry 1, going to `2k` when entry `k` is not less than the key and to
+ * `2k + 1` when it is, until `k` runs off the end of the array.  The bits of
+ * `k` then spell out the path taken, and the answer is the last entry where
+ * the path turned left: strip the trailing right turns (one bits) and the
+ * left turn before them.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_static_set.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(p) __builtin_prefetch((p), 0, 3)
+#else
+#define PREFETCH(p) ((void)(p))
+#endif
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Returns the first eight bytes of `s` as a big-endian integer,
+ * padded with zero bytes.
+ *
+ * A key that ends early is padded with bytes no greater than any that could
+ * follow, so where two prefixes differ they order their keys as
+ * mu_string_cmp() does.  Where they are equal, the full keys decide.
+ */
+static inline uint64_t key_prefix(mu_string_t s);
+
+/**
+ * @brief Returns 1 if `entry` orders before `key`, whose prefix is `prefix`,
+ * and 0 otherwise.
+ */
+static inline size_t entry_less(const mu_string_static_set_entry_t *entry,
+                                mu_string_t key, uint64_t prefix);
+
+/**
+ * @brief Stores the keys from `*next` onwards into the subtree rooted at
+ * entry `k`, in order, advancing `*next` past them.
+ */
+static void fill(mu_string_static_set_entry_t *entries, size_t n,
+                 const mu_string_t *keys, size_t *next, size_t k);
+
+/**
+ * @brief Returns the index of the entry holding the lower bound of `key`, or
+ * 0 if every key is less than it.  `key` must be valid.
+ */
+static size_t search(const mu_string_static_set_t *set, mu_string_t key);
+
+/**
+ * @brief Returns the number of consecutive one bits at the bottom of `k`.
+ */
+static inline unsigned trailing_ones(size_t k);
+
+// *****************************************************************************
+// Public code
+
+mu_string_static_set_t *mu_string_static_set_build(
+    mu_string_static_set_t *set, mu_string_static_set_entry_t *entries,
+    size_t n_entries, const mu_string_t *keys, size_t n_keys) {
+    if (set == NULL || entries == NULL || (keys == NULL && n_keys > 0) ||
+        n_keys == SIZE_MAX || n_entries < MU_STRING_STATIC_SET_ENTRIES(n_keys)) {
+        return NULL;
+    }
+    for (size_t i = 0; i < n_keys; i++) {
+        if (!mu_string_is_valid(keys[i]) ||
+            (i > 0 && mu_string_cmp(keys[i - 1], keys[i]) > 0)) {
+            return NULL;
+        }
+    }
+
+    size_t next = 0;
+    entries[0] = (mu_string_static_set_entry_t){ 0 };
+    fill(entries, n_keys, keys, &next, 1);
+    set->entries = entries;
+    set->n_keys = n_keys;
+    return set;
+}
+
+size_t mu_string_static_set_count(const mu_string_static_set_t *set) {
+    return (set == NULL) ? 0 : set->n_keys;
+}
+
+bool mu_string_static_set_contains(const mu_string_static_set_t *set,
+                                   mu_string_t key) {
+    if (set == NULL || !mu_string_is_valid(key)) {
+        return false;
+    }
+    size_t k = search(set, key);
+    return k != 0 && mu_string_eq(set->entries[k].key, key);
+}
+
+size_t mu_string_static_set_lower_bound(const mu_string_static_set_t *set,
+                                        mu_string_t key) {
+    if (set == NULL || !mu_string_is_valid(key)) {
+        return 0; // MU_STRING_INVALID sorts before everything
+    }
+    size_t k = search(set, key);
+    return (k == 0) ? set->n_keys : set->entries[k].rank;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static inline uint64_t key_prefix(mu_string_t s) {
+    const unsigned char *p = (const unsigned char *)s.buf;
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < 8; i++) {
+        prefix = (prefix << 8) | (i < s.len ? p[i] : 0u);
+    }
+    return prefix;
+}
+
+static inline size_t entry_less(const mu_string_static_set_entry_t *entry,
+                                mu_string_t key, uint64_t prefix) {
+    size_t less = entry->prefix < prefix;
+    if (entry->prefix == prefix) {
+        // Rare unless keys share eight-byte prefixes.
+        less = mu_string_cmp(entry->key, key) < 0;
+    }
+    return less;
+}
+
+static void fill(mu_string_static_set_entry_t *entries, size_t n,
+                 const mu_string_t *keys, size_t *next, size_t k) {
+    // Recursion depth is the height of the tree, about log2(n).
+    if (k > n) {
+        return;
+    }
+    fill(entries, n, keys, next, 2 * k);
+    entries[k].prefix = key_prefix(keys[*next]);
+    entries[k].key = keys[*next];
+    entries[k].rank = *next;
+    *next += 1;
+    fill(entries, n, keys, next, 2 * k + 1);
+}
+
+static size_t search(const mu_string_static_set_t *set, mu_string_t key) {
+    const mu_string_static_set_entry_t *entries = set->entries;
+    size_t n = set->n_keys;
+    uint64_t prefix = key_prefix(key);
+    size_t k = 1;
+
+    while (k <= n) {
+        // The four grandchildren of `k` are adjacent: fetch them two levels
+        // early.  Near the leaves there are none, so fetch the root instead.
+        size_t ahead = (4 * k + 3 <= n) ? 4 * k : 0;
+        PREFETCH(&entries[ahead]);
+        PREFETCH(&entries[ahead + 2]);
+        k = 2 * k + entry_less(&entries[k], key, prefix);
+    }
+    return k >> (trailing_ones(k) + 1);
+}
+
+static inline unsigned trailing_ones(size_t k) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(~(unsigned long long)k);
+#else
+    unsigned n = 0;
+    while (k & 1) {
+        k >>= 1;
+        n += 1;
+    }
+    return n;
+#endif
+}
+
+// *****************************************************************************
+// End of file
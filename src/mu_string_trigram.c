@@ -0,0 +1,308 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_string_trigram.c
+ *
+ * @brief Implements the mu_string_trigram inverted index.
+ *
+ * The build makes two passes over the records.  The first measures the
+ * encoded size of each bucket's posting list, and the second writes the
+ * lists in place, as in a counting sort.  A record is added to a bucket at
+ * most once, so each list is strictly increasing and stored as varint
+ * deltas.
+ *
+ * Queries intersect the lists by streaming: the shortest list drives, and
+ * each other list's cursor only moves forward.  Nothing is decoded into
+ * temporary storage.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_trigram.h"
+#include "mu_string.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+/**
+ * @brief A read position in one posting list.
+ */
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t id;
+    bool started;
+} cursor_t;
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Returns the bucket of the trigram starting at `p`.
+ */
+static inline uint32_t bucket_of(const char *p, unsigned bits);
+
+/**
+ * @brief Returns the number of bytes needed to encode `v` as a varint.
+ */
+static inline size_t varint_len(uint32_t v);
+
+/**
+ * @brief Advances `c` to the next record number.  Returns false at the end
+ * of the list.
+ */
+static bool cursor_next(cursor_t *c);
+
+/**
+ * @brief Returns true if record `id` contains `needle`.
+ */
+static bool record_contains(const mu_string_trigram_t *index, size_t id,
+                            mu_string_t needle);
+
+// *****************************************************************************
+// Public code
+
+mu_string_trigram_t *mu_string_trigram_build(mu_string_trigram_t *index,
+                                             const mu_string_t *records,
+                                             size_t n_records,
+                                             unsigned bucket_bits,
+                                             uint32_t *arena, size_t arena_len) {
+    if (index == NULL || (records == NULL && n_records > 0) ||
+        n_records >= UINT32_MAX || bucket_bits < 8 || bucket_bits > 24 ||
+        arena == NULL) {
+        return NULL;
+    }
+    const size_t n_buckets = (size_t)1 << bucket_bits;
+    if (arena_len < 2 * n_buckets + 1) {
+        return NULL;
+    }
+    uint32_t *offsets = arena;
+    uint32_t *last = &arena[arena_len - n_buckets]; // 1 + last record added
+    uint8_t *postings = (uint8_t *)&arena[n_buckets + 1];
+    const size_t capacity = (arena_len - 2 * n_buckets - 1) * sizeof(uint32_t);
+
+    // Pass 1: size each bucket's list, in offsets[b + 1].
+    memset(offsets, 0, (n_buckets + 1) * sizeof(uint32_t));
+    memset(last, 0, n_buckets * sizeof(uint32_t));
+    size_t total = 0;
+    for (size_t r = 0; r < n_records; r++) {
+        mu_string_t rec = records[r];
+        if (!mu_string_is_valid(rec)) {
+            return NULL;
+        }
+        for (size_t i = 0; i + 3 <= rec.len; i++) {
+            uint32_t b = bucket_of(&rec.buf[i], bucket_bits);
+            if (last[b] != r + 1) {
+                uint32_t delta = last[b] ? (uint32_t)r - (last[b] - 1) : (uint32_t)r;
+                size_t n = varint_len(delta);
+                offsets[b + 1] += (uint32_t)n;
+                total += n;
+                last[b] = (uint32_t)(r + 1);
+            }
+        }
+        if (total > capacity) {
+            return NULL;
+        }
+    }
+    for (size_t b = 0; b < n_buckets; b++) {
+        offsets[b + 1] += offsets[b];
+    }
+
+    // Pass 2: write each list, using offsets[b] as its cursor.  Afterwards
+    // offsets[b] holds the end of list b, so shift them up by one.
+    memset(last, 0, n_buckets * sizeof(uint32_t));
+    for (size_t r = 0; r < n_records; r++) {
+        mu_string_t rec = records[r];
+        for (size_t i = 0; i + 3 <= rec.len; i++) {
+            uint32_t b = bucket_of(&rec.buf[i], bucket_bits);
+            if (last[b] != r + 1) {
+                uint32_t delta = last[b] ? (uint32_t)r - (last[b] - 1) : (uint32_t)r;
+                uint8_t *out = &postings[offsets[b]];
+                size_t n = 0;
+                while (delta >= 0x80) {
+                    out[n++] = (uint8_t)(delta | 0x80);
+                    delta >>= 7;
+                }
+                out[n++] = (uint8_t)delta;
+                offsets[b] += (uint32_t)n;
+                last[b] = (uint32_t)(r + 1);
+            }
+        }
+    }
+    memmove(&offsets[1], &offsets[0], n_buckets * sizeof(uint32_t));
+    offsets[0] = 0;
+
+    index->records = records;
+    index->n_records = n_records;
+    index->offsets = offsets;
+    index->postings = postings;
+    index->bucket_bits = bucket_bits;
+    index->arena_used = n_buckets + 1 + (total + 3) / sizeof(uint32_t);
+    return index;
+}
+
+size_t mu_string_trigram_find(const mu_string_trigram_t *index,
+                              mu_string_t needle, size_t *ids, size_t max_ids) {
+    if (index == NULL || !mu_string_is_valid(needle) ||
+        (ids == NULL && max_ids > 0)) {
+        return 0;
+    }
+    size_t found = 0;
+
+    if (needle.len < 3) {
+        // No trigram to look up: check every record.
+        for (size_t id = 0; id < index->n_records; id++) {
+            if (record_contains(index, id, needle)) {
+                if (found < max_ids) {
+                    ids[found] = id;
+                }
+                found += 1;
+            }
+        }
+        return found;
+    }
+
+    // Pick the shortest posting lists among the needle's trigrams.
+    cursor_t lists[MU_STRING_TRIGRAM_MAX_LISTS];
+    uint32_t buckets[MU_STRING_TRIGRAM_MAX_LISTS];
+    size_t n_lists = 0;
+    for (size_t i = 0; i + 3 <= needle.len; i++) {
+        uint32_t b = bucket_of(&needle.buf[i], index->bucket_bits);
+        bool dup = false;
+        for (size_t k = 0; k < n_lists; k++) {
+            dup = dup || buckets[k] == b;
+        }
+        if (dup) {
+            continue;
+        }
+        cursor_t c = { .p = &index->postings[index->offsets[b]],
+                       .end = &index->postings[index->offsets[b + 1]] };
+        if (c.p == c.end) {
+            return 0; // some trigram occurs in no record
+        }
+        size_t slot = n_lists;
+        if (n_lists == MU_STRING_TRIGRAM_MAX_LISTS) {
+            // Replace the longest list chosen so far, if this one is shorter.
+            slot = 0;
+            for (size_t k = 1; k < n_lists; k++) {
+                if (lists[k].end - lists[k].p > lists[slot].end - lists[slot].p) {
+                    slot = k;
+                }
+            }
+            if (c.end - c.p >= lists[slot].end - lists[slot].p) {
+                continue;
+            }
+        } else {
+            n_lists += 1;
+        }
+        lists[slot] = c;
+        buckets[slot] = b;
+    }
+    // The shortest list drives the intersection.
+    for (size_t k = 1; k < n_lists; k++) {
+        if (lists[k].end - lists[k].p < lists[0].end - lists[0].p) {
+            cursor_t t = lists[0];
+            lists[0] = lists[k];
+            lists[k] = t;
+        }
+    }
+
+    while (cursor_next(&lists[0])) {
+        uint32_t id = lists[0].id;
+        bool in_all = true;
+        for (size_t k = 1; k < n_lists && in_all; k++) {
+            while (!lists[k].started || lists[k].id < id) {
+                if (!cursor_next(&lists[k])) {
+                    return found; // a list is exhausted: no more matches
+                }
+            }
+            in_all = (lists[k].id == id);
+        }
+        // Buckets are shared by many trigrams, so a candidate must still be
+        // checked.
+        if (in_all && record_contains(index, id, needle)) {
+            if (found < max_ids) {
+                ids[found] = id;
+            }
+            found += 1;
+        }
+    }
+    return found;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static inline uint32_t bucket_of(const char *p, unsigned bits) {
+    uint32_t v = (uint32_t)(uint8_t)p[0] | (uint32_t)(uint8_t)p[1] << 8 |
+                 (uint32_t)(uint8_t)p[2] << 16;
+    return (v * 0x9E3779B1u) >> (32 - bits);
+}
+
+static inline size_t varint_len(uint32_t v) {
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n += 1;
+    }
+    return n;
+}
+
+static bool cursor_next(cursor_t *c) {
+    if (c->p == c->end) {
+        return false;
+    }
+    uint32_t delta = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+    do {
+        byte = *c->p++;
+        delta |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    c->id = c->started ? c->id + delta : delta;
+    c->started = true;
+    return true;
+}
+
+static bool record_contains(const mu_string_trigram_t *index, size_t id,
+                            mu_string_t needle) {
+    if (needle.len == 0) {
+        return true;
+    }
+    // mu_string_find_str() returns an empty view when there is no match.
+    return mu_string_find_str(index->records[id], needle).len != 0;
+}
+
+// *****************************************************************************
+// End of file
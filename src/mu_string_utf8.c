@@ -0,0 +1,592 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file mu_string_utf8.c
+ *
+ * @brief Implements the mu_string_utf8 Unicode operations.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string_utf8.h"
+#include "mu_string.h"
+#include "mu_string_utf8_tables.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+/**
+ * @brief Added to a byte that does not begin a valid UTF-8 sequence to give
+ * a pseudo code point that is beyond Unicode, so that it folds to itself and
+ * equals only the same byte.
+ */
+#define RAW_BYTE 0x110000
+
+// NFC_Quick_Check values, as stored in nfc_qc[].
+#define QC_YES 0
+#define QC_MAYBE 1
+#define QC_NO 2
+
+// Hangul syllables are composed and decomposed arithmetically from their
+// leading consonant (L), vowel (V) and optional trailing consonant (T).
+#define HANGUL_S_BASE 0xAC00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11A7 // one before the first T: 0 means no T
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+#define CP_MASK 0x1FFFFF // a code point field of nfc_decomp[] or nfc_compose[]
+
+#if MU_STRING_SWAR
+#define SWAR_ONES 0x0101010101010101ULL
+#define SWAR_LOW7 0x7F7F7F7F7F7F7F7FULL
+#define SWAR_HIGH 0x8080808080808080ULL
+#endif
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Decodes the code point at the start of the `n` bytes at `p`, with
+ * `n > 0`, and returns the number of bytes it takes.
+ *
+ * Overlong forms, surrogates and values beyond U+10FFFF are ill-formed.  For
+ * an ill-formed sequence, stores `RAW_BYTE + p[0]` and returns 1.
+ */
+static inline size_t decode(const uint8_t *p, size_t n, uint32_t *cp);
+
+/**
+ * @brief Returns the number of bytes needed to encode `cp`.
+ */
+static inline size_t encoded_len(uint32_t cp);
+
+/**
+ * @brief Writes the encoding of `cp`, which takes encoded_len(cp) bytes.
+ */
+static inline void encode(uint32_t cp, uint8_t *p);
+
+/**
+ * @brief Returns the simple case folding of `cp`.
+ */
+static inline uint32_t fold(uint32_t cp);
+
+/**
+ * @brief Returns the NFC_Quick_Check value of `cp` and stores its canonical
+ * combining class in `*ccc`.
+ */
+static inline uint8_t nfc_props(uint32_t cp, uint8_t *ccc);
+
+/**
+ * @brief Returns the index of the first byte at or after `i` that is at
+ * least 0xCC, or `n` if there is none.
+ *
+ * The bytes skipped encode code points below U+0300 (0xCC begins U+0300)
+ * or are ill-formed, so are in NFC, have combining class 0, and combine
+ * with nothing before them.
+ */
+static size_t skip_below_0300(const uint8_t *p, size_t i, size_t n);
+
+/**
+ * @brief Writes the full canonical decomposition of `cp`, at most
+ * NFC_MAX_DECOMP code points, and returns its length.
+ */
+static size_t decompose(uint32_t cp, uint32_t *out);
+
+/**
+ * @brief Returns the primary composite of `first` and `second`, or 0 if
+ * they do not compose.
+ */
+static uint32_t compose(uint32_t first, uint32_t second);
+
+/**
+ * @brief Returns the entry of the sorted `table` whose bits from `shift` up
+ * equal `key`, or 0 if there is none.
+ */
+static uint64_t table_find(const uint64_t *table, size_t n, uint64_t key,
+                           int shift);
+
+/**
+ * @brief Puts the `n` decomposed code points of a segment in canonical
+ * order, composes them, and appends the result to `dst` at `*out`.
+ *
+ * @return false if `dst` is too small.
+ */
+static bool nfc_flush(uint32_t *seg, size_t n, mu_string_mut_t dst,
+                      size_t *out);
+
+#if MU_STRING_SWAR
+/**
+ * @brief Loads eight bytes from `p`, which need not be aligned.
+ */
+static inline uint64_t swar_load(const uint8_t *p);
+
+/**
+ * @brief Folds each ASCII byte of `x` to lower case.
+ */
+static inline uint64_t swar_fold(uint64_t x);
+#endif
+
+// *****************************************************************************
+// Public code
+
+mu_string_t mu_string_utf8_casefold(mu_string_mut_t dst, mu_string_t src) {
+    if (dst.buf == NULL || !mu_string_is_valid(src)) {
+        return MU_STRING_INVALID;
+    }
+
+    const uint8_t *s = (const uint8_t *)src.buf;
+    uint8_t *d = (uint8_t *)dst.buf;
+    size_t i = 0;
+    size_t out = 0;
+    while (i < src.len) {
+#if MU_STRING_SWAR
+        // ASCII folds to ASCII of the same length: no table, no decoding.
+        while (i + 8 <= src.len && out + 8 <= dst.len) {
+            uint64_t w = swar_load(&s[i]);
+            if (w & SWAR_HIGH) {
+                break;
+            }
+            w = swar_fold(w);
+            memcpy(&d[out], &w, sizeof(w));
+            i += 8;
+            out += 8;
+        }
+        if (i == src.len) {
+            break;
+        }
+#endif
+        uint32_t cp;
+        i += decode(&s[i], src.len - i, &cp);
+        cp = fold(cp);
+        size_t n = encoded_len(cp);
+        if (dst.len - out < n) {
+            return MU_STRING_INVALID;
+        }
+        encode(cp, &d[out]);
+        out += n;
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = out };
+}
+
+bool mu_string_utf8_eq_casefold(mu_string_t s1, mu_string_t s2) {
+    if (!mu_string_is_valid(s1) || !mu_string_is_valid(s2)) {
+        return false;
+    }
+
+    const uint8_t *a = (const uint8_t *)s1.buf;
+    const uint8_t *b = (const uint8_t *)s2.buf;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < s1.len && j < s2.len) {
+#if MU_STRING_SWAR
+        // Eight ASCII bytes on each side are the next eight code points of
+        // each, so their foldings can be compared a word at a time.
+        while (i + 8 <= s1.len && j + 8 <= s2.len) {
+            uint64_t wa = swar_load(&a[i]);
+            uint64_t wb = swar_load(&b[j]);
+            if ((wa | wb) & SWAR_HIGH) {
+                break;
+            }
+            if (swar_fold(wa) != swar_fold(wb)) {
+                return false;
+            }
+            i += 8;
+            j += 8;
+        }
+        if (i == s1.len || j == s2.len) {
+            break;
+        }
+#endif
+        uint32_t ca;
+        uint32_t cb;
+        i += decode(&a[i], s1.len - i, &ca);
+        j += decode(&b[j], s2.len - j, &cb);
+        if (ca != cb && fold(ca) != fold(cb)) {
+            return false;
+        }
+    }
+    return i == s1.len && j == s2.len;
+}
+
+mu_string_utf8_nfc_t mu_string_utf8_nfc_quick_check(mu_string_t s) {
+    if (!mu_string_is_valid(s)) {
+        return MU_STRING_UTF8_NFC_NO;
+    }
+
+    const uint8_t *p = (const uint8_t *)s.buf;
+    mu_string_utf8_nfc_t result = MU_STRING_UTF8_NFC_YES;
+    uint8_t last_ccc = 0;
+    size_t i = 0;
+    while (i < s.len) {
+        size_t j = skip_below_0300(p, i, s.len);
+        if (j > i) {
+            last_ccc = 0;
+            i = j;
+            if (i == s.len) {
+                break;
+            }
+        }
+        uint32_t cp;
+        uint8_t ccc;
+        i += decode(&p[i], s.len - i, &cp);
+        uint8_t qc = nfc_props(cp, &ccc);
+        if ((ccc != 0 && last_ccc > ccc) || qc == QC_NO) {
+            return MU_STRING_UTF8_NFC_NO;
+        }
+        if (qc == QC_MAYBE) {
+            result = MU_STRING_UTF8_NFC_MAYBE;
+        }
+        last_ccc = ccc;
+    }
+    return result;
+}
+
+mu_string_t mu_string_utf8_to_nfc(mu_string_mut_t dst, mu_string_t src) {
+    if (!mu_string_is_valid(src)) {
+        return MU_STRING_INVALID;
+    }
+    if (mu_string_utf8_nfc_quick_check(src) == MU_STRING_UTF8_NFC_YES) {
+        return src; // Common case: nothing to do, no copy.
+    }
+    if (dst.buf == NULL) {
+        return MU_STRING_INVALID;
+    }
+
+    // Decompose into segments that each begin with a character that cannot
+    // combine with anything before it, and normalize one segment at a time.
+    const uint8_t *s = (const uint8_t *)src.buf;
+    uint32_t seg[MU_STRING_UTF8_NFC_SEGMENT];
+    size_t n_seg = 0;
+    size_t out = 0;
+    size_t i = 0;
+    while (i < src.len) {
+        size_t j = skip_below_0300(s, i, src.len);
+        if (j > i) {
+            // Copy text below U+0300 as is, but for its last character,
+            // which may compose with what follows.
+            size_t last = j - 1;
+            while (last > i && (s[last] & 0xC0) == 0x80) {
+                last -= 1;
+            }
+            if (last > i) {
+                if (!nfc_flush(seg, n_seg, dst, &out) ||
+                    dst.len - out < last - i) {
+                    return MU_STRING_INVALID;
+                }
+                n_seg = 0;
+                memcpy(&dst.buf[out], &s[i], last - i);
+                out += last - i;
+                i = last;
+            }
+        }
+        uint32_t cp;
+        uint32_t parts[NFC_MAX_DECOMP];
+        i += decode(&s[i], src.len - i, &cp);
+        size_t n_parts = decompose(cp, parts);
+        for (size_t k = 0; k < n_parts; k++) {
+            uint8_t ccc;
+            if (nfc_props(parts[k], &ccc) == QC_YES && ccc == 0 && n_seg > 0) {
+                if (!nfc_flush(seg, n_seg, dst, &out)) {
+                    return MU_STRING_INVALID;
+                }
+                n_seg = 0;
+            }
+            if (n_seg == MU_STRING_UTF8_NFC_SEGMENT) {
+                return MU_STRING_INVALID;
+            }
+            seg[n_seg++] = parts[k];
+        }
+    }
+    if (!nfc_flush(seg, n_seg, dst, &out)) {
+        return MU_STRING_INVALID;
+    }
+    return (mu_string_t){ .buf = dst.buf, .len = out };
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static inline size_t decode(const uint8_t *p, size_t n, uint32_t *cp) {
+    uint8_t b0 = p[0];
+    if (b0 < 0x80) {
+        *cp = b0;
+        return 1;
+    }
+    // The second byte's range depends on the first to exclude overlong
+    // forms, surrogates and values beyond U+10FFFF.
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+    size_t len;
+    if (b0 < 0xC2) {
+        len = 0; // continuation byte or overlong two-byte form
+    } else if (b0 < 0xE0) {
+        len = 2;
+    } else if (b0 < 0xF0) {
+        len = 3;
+        lo = (b0 == 0xE0) ? 0xA0 : 0x80;
+        hi = (b0 == 0xED) ? 0x9F : 0xBF;
+    } else if (b0 < 0xF5) {
+        len = 4;
+        lo = (b0 == 0xF0) ? 0x90 : 0x80;
+        hi = (b0 == 0xF4) ? 0x8F : 0xBF;
+    } else {
+        len = 0;
+    }
+    if (len == 0 || n < len || p[1] < lo || p[1] > hi) {
+        *cp = RAW_BYTE + b0;
+        return 1;
+    }
+    uint32_t c = b0 & (0x7F >> len);
+    for (size_t k = 1; k < len; k++) {
+        if (k > 1 && (p[k] & 0xC0) != 0x80) {
+            *cp = RAW_BYTE + b0;
+            return 1;
+        }
+        c = (c << 6) | (p[k] & 0x3F);
+    }
+    *cp = c;
+    return len;
+}
+
+static inline size_t encoded_len(uint32_t cp) {
+    if (cp < 0x80 || cp >= RAW_BYTE) {
+        return 1;
+    }
+    return (cp < 0x800) ? 2 : (cp < 0x10000) ? 3 : 4;
+}
+
+static inline void encode(uint32_t cp, uint8_t *p) {
+    if (cp < 0x80) {
+        p[0] = (uint8_t)cp;
+    } else if (cp < 0x800) {
+        p[0] = (uint8_t)(0xC0 | (cp >> 6));
+        p[1] = (uint8_t)(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        p[0] = (uint8_t)(0xE0 | (cp >> 12));
+        p[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        p[2] = (uint8_t)(0x80 | (cp & 0x3F));
+    } else if (cp < RAW_BYTE) {
+        p[0] = (uint8_t)(0xF0 | (cp >> 18));
+        p[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+        p[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        p[3] = (uint8_t)(0x80 | (cp & 0x3F));
+    } else {
+        p[0] = (uint8_t)(cp - RAW_BYTE);
+    }
+}
+
+static inline uint32_t fold(uint32_t cp) {
+    if (cp >= FOLD_LIMIT) {
+        return cp;
+    }
+    uint8_t k = fold_stage2[fold_stage1[cp >> FOLD_SHIFT]][cp & FOLD_MASK];
+    return (uint32_t)((int32_t)cp + fold_delta[k]);
+}
+
+static inline uint8_t nfc_props(uint32_t cp, uint8_t *ccc) {
+    if (cp < 0x300 || cp >= NFC_LIMIT) {
+        *ccc = 0;
+        return QC_YES;
+    }
+    uint8_t k = nfc_stage2[nfc_stage1[cp >> NFC_SHIFT]][cp & NFC_MASK];
+    *ccc = nfc_ccc[k];
+    return nfc_qc[k];
+}
+
+static size_t skip_below_0300(const uint8_t *p, size_t i, size_t n) {
+#if MU_STRING_SWAR
+    for (; i + 8 <= n; i += 8) {
+        // A byte is at least 0xCC if its high bit is set and its low 7 bits
+        // are at least 0x4C.
+        uint64_t w = swar_load(&p[i]);
+        uint64_t ge = (w & SWAR_LOW7) + (0x80 - 0x4C) * SWAR_ONES;
+        if (ge & w & SWAR_HIGH) {
+            break; // the byte loop finds which
+        }
+    }
+#endif
+    while (i < n && p[i] < 0xCC) {
+        i += 1;
+    }
+    return i;
+}
+
+static size_t decompose(uint32_t cp, uint32_t *out) {
+    if (cp - HANGUL_S_BASE < HANGUL_S_COUNT) {
+        uint32_t s = cp - HANGUL_S_BASE;
+        out[0] = HANGUL_L_BASE + s / HANGUL_N_COUNT;
+        out[1] = HANGUL_V_BASE + (s % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+        out[2] = HANGUL_T_BASE + s % HANGUL_T_COUNT;
+        return (out[2] == HANGUL_T_BASE) ? 2 : 3;
+    }
+    // Only the first code point of a pair ever decomposes further.
+    uint32_t tail[NFC_MAX_DECOMP];
+    size_t n_tail = 0;
+    uint64_t entry;
+    while (cp >= 0xC0 &&
+           (entry = table_find(nfc_decomp, sizeof(nfc_decomp) /
+                                               sizeof(nfc_decomp[0]),
+                               cp, 42)) != 0) {
+        if (entry & CP_MASK) {
+            tail[n_tail++] = entry & CP_MASK;
+        }
+        cp = (entry >> 21) & CP_MASK;
+    }
+    out[0] = cp;
+    for (size_t k = 0; k < n_tail; k++) {
+        out[1 + k] = tail[n_tail - 1 - k];
+    }
+    return 1 + n_tail;
+}
+
+static uint32_t compose(uint32_t first, uint32_t second) {
+    if (first - HANGUL_L_BASE < HANGUL_L_COUNT &&
+        second - HANGUL_V_BASE < HANGUL_V_COUNT) {
+        return HANGUL_S_BASE + (first - HANGUL_L_BASE) * HANGUL_N_COUNT +
+               (second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+    }
+    if (first - HANGUL_S_BASE < HANGUL_S_COUNT &&
+        (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+        second - (HANGUL_T_BASE + 1) < HANGUL_T_COUNT - 1) {
+        return first + (second - HANGUL_T_BASE);
+    }
+    if (first >= RAW_BYTE || second >= RAW_BYTE) {
+        return 0;
+    }
+    uint64_t entry = table_find(nfc_compose,
+                                sizeof(nfc_compose) / sizeof(nfc_compose[0]),
+                                ((uint64_t)first << 21) | second, 21);
+    return (uint32_t)(entry & CP_MASK);
+}
+
+static uint64_t table_find(const uint64_t *table, size_t n, uint64_t key,
+                           int shift) {
+    size_t lo = 0;
+    size_t hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint64_t k = table[mid] >> shift;
+        if (k == key) {
+            return table[mid];
+        }
+        if (k < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+static bool nfc_flush(uint32_t *seg, size_t n, mu_string_mut_t dst,
+                      size_t *out) {
+    uint8_t ccc;
+    uint8_t prev_ccc;
+    if (n == 0) {
+        return true;
+    }
+
+    // Canonical ordering: a stable sort of each run of combining characters
+    // by combining class.  Runs are short, so insertion sort it is.
+    for (size_t k = 1; k < n; k++) {
+        uint32_t cp = seg[k];
+        nfc_props(cp, &ccc);
+        size_t j = k;
+        while (ccc != 0 && j > 0 && (nfc_props(seg[j - 1], &prev_ccc),
+                                     prev_ccc > ccc)) {
+            seg[j] = seg[j - 1];
+            j -= 1;
+        }
+        seg[j] = cp;
+    }
+
+    // Canonical composition: combine each character with the last starter
+    // unless a character in between blocks it.  A segment that begins with
+    // a combining character has no starter until the next one.
+    size_t n_out = 1;
+    size_t starter = 0;
+    nfc_props(seg[0], &ccc);
+    int last_ccc = (ccc == 0) ? 0 : 256;
+    for (size_t k = 1; k < n; k++) {
+        uint32_t cp = seg[k];
+        nfc_props(cp, &ccc);
+        uint32_t composite = (last_ccc < ccc || last_ccc == 0)
+                                 ? compose(seg[starter], cp)
+                                 : 0;
+        if (composite != 0) {
+            seg[starter] = composite;
+            continue;
+        }
+        if (ccc == 0) {
+            starter = n_out;
+        }
+        last_ccc = ccc;
+        seg[n_out++] = cp;
+    }
+
+    for (size_t k = 0; k < n_out; k++) {
+        size_t len = encoded_len(seg[k]);
+        if (dst.len - *out < len) {
+            return false;
+        }
+        encode(seg[k], (uint8_t *)&dst.buf[*out]);
+        *out += len;
+    }
+    return true;
+}
+
+#if MU_STRING_SWAR
+static inline uint64_t swar_load(const uint8_t *p) {
+    uint64_t w;
+    memcpy(&w, p, sizeof(w)); // a single load on any current compiler
+    return w;
+}
+
+static inline uint64_t swar_fold(uint64_t x) {
+    // As in mu_string.c: the adds on the low 7 bits cannot carry into the
+    // next byte, and bytes whose high bit was set are dropped.
+    uint64_t low = x & SWAR_LOW7;
+    uint64_t ge_a = low + (0x80 - 'A') * SWAR_ONES; // high bit: byte >= 'A'
+    uint64_t gt_z = low + (0x7F - 'Z') * SWAR_ONES; // high bit: byte > 'Z'
+    uint64_t upper = ge_a & ~gt_z & ~x & SWAR_HIGH;
+    return x | (upper >> 2); // 0x80 >> 2 == 'a' - 'A'
+}
+#endif
+
+// *****************************************************************************
+// End of file
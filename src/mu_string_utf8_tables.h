@@ -0,0 +1,2574 @@
+/**
+ * @file mu_string_utf8_tables.h
+ *
+ * @brief Unicode property tables for mu_string_utf8.c.
+ *
+ * Generated from Unicode 14.0.0 by
+ * tools/gen_mu_string_utf8_tables.py.  Do not edit.
+ */
+
+#ifndef MU_STRING_UTF8_TABLES_H
+#define MU_STRING_UTF8_TABLES_H
+
+#include <stdint.h>
+
+// Simple case folding.  A code point `cp` below FOLD_LIMIT folds to
+// `cp + fold_delta[k]`, where
+// `k = fold_stage2[fold_stage1[cp >> FOLD_SHIFT]][cp & FOLD_MASK]`.
+#define FOLD_LIMIT 0x1E922
+#define FOLD_SHIFT 6
+#define FOLD_MASK 0x3F
+
+static const uint8_t fold_stage1[1957] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 22, 0, 0, 0, 0, 0, 23, 23, 24, 23, 25, 26, 27, 28,
+    0, 0, 0, 0, 29, 30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    34, 35, 23, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 38, 0, 39, 40, 41, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    46, 0, 47, 48, 0, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 54,
+};
+
+static const uint8_t fold_stage2[55][64] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 0, 66, 66, 66, 66, 66, 66, 66, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        0, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0, 59, 0, 59, 0, 59,
+    },
+    {
+        0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 40, 59, 0, 59, 0, 59, 0, 34,
+    },
+    {
+        0, 86, 59, 0, 59, 0, 83, 59, 0, 82, 82, 59, 0, 0, 77, 80,
+        81, 59, 0, 82, 84, 0, 87, 85, 59, 0, 0, 0, 87, 88, 0, 89,
+        59, 0, 59, 0, 59, 0, 91, 59, 0, 91, 0, 0, 59, 0, 91, 59,
+        0, 90, 90, 59, 0, 59, 0, 92, 59, 0, 0, 0, 59, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 60, 59, 0, 60, 59, 0, 60, 59, 0, 59, 0, 59,
+        0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        0, 60, 59, 0, 59, 0, 43, 49, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        37, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 36, 96, 0,
+    },
+    {
+        0, 59, 0, 35, 75, 76, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 0, 59, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 79,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 69, 0, 68, 68, 68, 0, 74, 0, 73, 73,
+        0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61,
+        52, 53, 0, 0, 0, 55, 54, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        50, 51, 0, 0, 47, 46, 0, 59, 0, 58, 59, 0, 0, 37, 37, 37,
+    },
+    {
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        62, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    },
+    {
+        72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+        72, 72, 72, 72, 72, 72, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    },
+    {
+        95, 95, 95, 95, 95, 95, 0, 95, 0, 0, 0, 0, 0, 95, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0,
+    },
+    {
+        25, 26, 27, 29, 29, 28, 30, 31, 98, 0, 0, 0, 0, 0, 0, 0,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 33, 33, 33,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 48, 0, 0, 22, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 45, 45, 56, 0, 24, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 56, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 42, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 41, 41, 58, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 39, 39, 56, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 20, 21, 0, 0, 0, 0,
+        0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    },
+    {
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+        72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+        72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 0, 18, 32, 19, 0, 0, 59, 0, 59, 0, 59, 0, 16, 17, 14,
+        15, 0, 59, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0,
+        0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 12, 59, 0,
+    },
+    {
+        59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 59, 0, 7, 0, 0,
+        59, 0, 59, 0, 0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+        59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 3, 1, 2, 5, 3, 0,
+        9, 6, 8, 94, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    },
+    {
+        59, 0, 59, 0, 51, 4, 11, 59, 0, 59, 0, 0, 0, 0, 0, 0,
+        59, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    },
+    {
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0,
+    },
+    {
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    },
+    {
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70,
+    },
+    {
+        70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70,
+        70, 70, 70, 0, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    },
+    {
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+static const int32_t fold_delta[99] = {
+    0, -42319, -42315, -42308, -42307, -42305, -42282, -42280,
+    -42261, -42258, -38864, -35384, -35332, -10815, -10783, -10782,
+    -10780, -10749, -10743, -10727, -8383, -8262, -7615, -7517,
+    -7173, -6222, -6221, -6212, -6211, -6210, -6204, -6180,
+    -3814, -3008, -268, -195, -163, -130, -128, -126,
+    -121, -112, -100, -97, -86, -74, -64, -60,
+    -58, -56, -54, -48, -30, -25, -22, -15,
+    -9, -8, -7, 1, 2, 8, 15, 16,
+    26, 28, 32, 34, 37, 38, 39, 40,
+    48, 63, 64, 69, 71, 79, 80, 116,
+    202, 203, 205, 206, 207, 209, 210, 211,
+    213, 214, 217, 218, 219, 775, 928, 7264,
+    10792, 10795, 35267,
+};
+
+// Canonical combining class and NFC_Quick_Check.  For a code point
+// `cp` below NFC_LIMIT, with
+// `k = nfc_stage2[nfc_stage1[cp >> NFC_SHIFT]][cp & NFC_MASK]`,
+// they are nfc_ccc[k] and nfc_qc[k] (0 Yes, 1 Maybe, 2 No).  Code
+// points below U+0300 and from NFC_LIMIT up have class 0 and are Yes.
+// A full decomposition has at most NFC_MAX_DECOMP code points.
+#define NFC_LIMIT 0x2FA1E
+#define NFC_MAX_DECOMP 4
+#define NFC_SHIFT 6
+#define NFC_MASK 0x3F
+
+static const uint8_t nfc_stage1[3049] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0,
+    0, 0, 4, 0, 0, 0, 5, 6, 7, 8, 0, 9, 10, 11, 0, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 19, 25, 26, 27,
+    23, 28, 23, 29, 30, 27, 0, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 0, 41, 0, 0, 42, 43, 44, 0, 0, 0, 0, 0, 45, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 47,
+    0, 0, 48, 0, 49, 0, 0, 0, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 0, 0, 59, 0, 0, 0, 60, 0, 0, 0, 0, 0, 61, 62, 63,
+    64, 0, 0, 65, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0,
+    0, 0, 0, 69, 0, 70, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+    72, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 75, 76, 0, 0, 0, 0,
+    77, 0, 0, 78, 79, 80, 81, 82, 0, 0, 83, 84, 0, 0, 0, 85,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 86, 86, 86, 86, 87, 88, 86, 89, 90, 91, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 94, 0, 95, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 97, 0, 0, 0, 0,
+    0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 99, 0, 0, 100, 101, 0,
+    0, 102, 103, 0, 104, 81, 0, 105, 106, 0, 0, 107, 108, 109, 0, 0,
+    0, 110, 111, 112, 0, 0, 113, 114, 70, 0, 115, 0, 116, 0, 0, 0,
+    117, 0, 0, 0, 118, 119, 0, 120, 121, 122, 123, 0, 0, 0, 0, 0,
+    70, 0, 0, 0, 0, 124, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 127, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 130, 131, 132, 0, 133, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    134, 0, 0, 0, 127, 0, 0, 0, 0, 0, 135, 136, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 137, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    86, 86, 86, 86, 86, 86, 86, 86, 139,
+};
+
+static const uint8_t nfc_stage2[140][64] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        60, 60, 60, 60, 60, 59, 60, 60, 60, 60, 60, 60, 60, 59, 59, 60,
+        59, 60, 59, 60, 60, 62, 53, 53, 53, 53, 62, 51, 53, 53, 53, 53,
+        53, 47, 47, 54, 54, 54, 54, 48, 48, 53, 53, 53, 53, 54, 54, 53,
+        54, 54, 53, 53, 3, 3, 3, 3, 4, 53, 53, 53, 53, 59, 59, 59,
+    },
+    {
+        61, 61, 60, 61, 61, 65, 59, 53, 53, 53, 59, 59, 59, 53, 53, 0,
+        59, 59, 59, 53, 53, 53, 53, 59, 62, 53, 53, 59, 63, 64, 64, 63,
+        64, 64, 63, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 53, 59, 59, 59, 59, 53, 59, 59, 59, 55, 53, 59, 59, 59, 59,
+        59, 59, 53, 53, 53, 53, 53, 53, 59, 59, 53, 59, 59, 55, 58, 59,
+        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 20, 21, 22, 23, 0, 24,
+    },
+    {
+        0, 25, 26, 0, 59, 53, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 59, 59, 59, 59, 59, 31, 32, 33, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 30, 31, 32,
+        33, 34, 35, 60, 60, 54, 53, 59, 59, 59, 59, 59, 53, 59, 59, 53,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 59, 0, 0, 59,
+        59, 59, 59, 53, 59, 0, 0, 59, 59, 0, 53, 59, 59, 53, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 53, 59, 59, 53, 59, 59, 53, 53, 53, 59, 53, 53, 59, 53, 59,
+    },
+    {
+        59, 59, 53, 59, 53, 59, 53, 59, 53, 59, 59, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59,
+        59, 59, 53, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 0, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 0, 59, 59, 59, 0, 59, 59, 59, 59, 59, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 59, 53, 53, 53, 59, 59, 59, 59,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 53,
+        53, 53, 53, 53, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 0, 53, 59, 59, 53, 59, 59, 53, 59, 59, 59, 53, 53, 53,
+        28, 29, 30, 59, 59, 59, 53, 59, 59, 53, 53, 59, 59, 59, 59, 59,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 59, 53, 59, 59, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 2, 0, 2,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 2, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 2, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 38, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 9, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 42, 42, 9, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 43, 43, 43, 43, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 53, 0, 53, 0, 50, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+        0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+        0, 44, 45, 2, 46, 2, 2, 0, 2, 0, 45, 45, 45, 45, 0, 0,
+    },
+    {
+        45, 2, 59, 59, 9, 0, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+        0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 6, 0, 9, 9, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 59, 53, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 59, 53, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 53,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 59, 59, 53, 53, 53, 53, 53, 53, 59, 59, 53, 0, 53,
+    },
+    {
+        53, 59, 59, 53, 53, 59, 59, 59, 59, 59, 53, 59, 59, 59, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 53, 59, 59, 59,
+        59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 0, 3, 53, 53, 53, 53, 53, 59, 59, 53, 53, 53, 53,
+        59, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 53, 0, 0,
+        0, 0, 0, 0, 59, 0, 0, 0, 59, 59, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        59, 59, 53, 59, 59, 59, 59, 59, 59, 59, 53, 59, 59, 64, 49, 53,
+        47, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 62, 58, 58, 53, 52, 59, 63, 53, 59, 53,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 0,
+    },
+    {
+        2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 3, 3, 59, 59, 59, 59, 3, 3, 3, 59, 59, 0, 0, 0,
+        0, 59, 0, 0, 0, 3, 3, 59, 53, 59, 3, 3, 53, 53, 53, 53,
+        59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59,
+        59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 58, 62, 55, 56, 56,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59,
+        0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 0, 59, 59, 53, 0, 0, 59, 59, 0, 0, 0, 0, 0, 59, 59,
+    },
+    {
+        0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+        2, 0, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+        2, 0, 2, 0, 0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 27, 2,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 2, 0,
+    },
+    {
+        2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 59, 59, 59, 59, 53, 53, 53, 53, 53, 53, 53, 59, 59,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 59,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 59, 3, 53, 0, 0, 0, 0, 9,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 59, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 53, 53, 59, 59, 59, 53, 59, 53, 53, 53,
+        53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 59, 53, 59, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+    },
+    {
+        59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 9, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 59, 0, 0, 0,
+        59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 9, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    },
+    {
+        0, 0, 9, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    },
+    {
+        6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 6, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0,
+    },
+    {
+        0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 6, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        59, 59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+        2, 2, 2, 2, 2, 50, 50, 3, 3, 3, 0, 0, 0, 57, 50, 50,
+        50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53,
+    },
+    {
+        53, 53, 53, 0, 0, 59, 59, 59, 59, 59, 53, 53, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        59, 59, 59, 59, 59, 59, 59, 0, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 59, 59, 59, 59, 59,
+        59, 59, 0, 59, 59, 0, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59, 59,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 6, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+static const uint8_t nfc_ccc[66] = {
+    0, 0, 0, 1, 1, 6, 7, 7, 8, 9, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 84, 91, 103, 107, 118, 122, 129, 130, 132, 202,
+    202, 214, 216, 216, 218, 220, 220, 222, 224, 226, 228, 230, 230, 230, 232, 233,
+    234, 240,
+};
+
+static const uint8_t nfc_qc[66] = {
+    0, 1, 2, 0, 1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 2, 0, 0,
+    0, 1,
+};
+
+// Canonical decompositions, one level deep, sorted: bits 42-62 hold
+// the code point, 21-41 the first code point of its decomposition
+// and 0-20 the second, or 0 for a singleton.  Hangul syllables are
+// decomposed algorithmically and are not listed.
+static const uint64_t nfc_decomp[2061] = {
+    0x3000008200300, 0x3040008200301, 0x3080008200302,
+    0x30C0008200303, 0x3100008200308, 0x314000820030A,
+    0x31C0008600327, 0x3200008A00300, 0x3240008A00301,
+    0x3280008A00302, 0x32C0008A00308, 0x3300009200300,
+    0x3340009200301, 0x3380009200302, 0x33C0009200308,
+    0x3440009C00303, 0x3480009E00300, 0x34C0009E00301,
+    0x3500009E00302, 0x3540009E00303, 0x3580009E00308,
+    0x364000AA00300, 0x368000AA00301, 0x36C000AA00302,
+    0x370000AA00308, 0x374000B200301, 0x380000C200300,
+    0x384000C200301, 0x388000C200302, 0x38C000C200303,
+    0x390000C200308, 0x394000C20030A, 0x39C000C600327,
+    0x3A0000CA00300, 0x3A4000CA00301, 0x3A8000CA00302,
+    0x3AC000CA00308, 0x3B0000D200300, 0x3B4000D200301,
+    0x3B8000D200302, 0x3BC000D200308, 0x3C4000DC00303,
+    0x3C8000DE00300, 0x3CC000DE00301, 0x3D0000DE00302,
+    0x3D4000DE00303, 0x3D8000DE00308, 0x3E4000EA00300,
+    0x3E8000EA00301, 0x3EC000EA00302, 0x3F0000EA00308,
+    0x3F4000F200301, 0x3FC000F200308, 0x4000008200304,
+    0x404000C200304, 0x4080008200306, 0x40C000C200306,
+    0x4100008200328, 0x414000C200328, 0x4180008600301,
+    0x41C000C600301, 0x4200008600302, 0x424000C600302,
+    0x4280008600307, 0x42C000C600307, 0x430000860030C,
+    0x434000C60030C, 0x438000880030C, 0x43C000C80030C,
+    0x4480008A00304, 0x44C000CA00304, 0x4500008A00306,
+    0x454000CA00306, 0x4580008A00307, 0x45C000CA00307,
+    0x4600008A00328, 0x464000CA00328, 0x4680008A0030C,
+    0x46C000CA0030C, 0x4700008E00302, 0x474000CE00302,
+    0x4780008E00306, 0x47C000CE00306, 0x4800008E00307,
+    0x484000CE00307, 0x4880008E00327, 0x48C000CE00327,
+    0x4900009000302, 0x494000D000302, 0x4A00009200303,
+    0x4A4000D200303, 0x4A80009200304, 0x4AC000D200304,
+    0x4B00009200306, 0x4B4000D200306, 0x4B80009200328,
+    0x4BC000D200328, 0x4C00009200307, 0x4D00009400302,
+    0x4D4000D400302, 0x4D80009600327, 0x4DC000D600327,
+    0x4E40009800301, 0x4E8000D800301, 0x4EC0009800327,
+    0x4F0000D800327, 0x4F4000980030C, 0x4F8000D80030C,
+    0x50C0009C00301, 0x510000DC00301, 0x5140009C00327,
+    0x518000DC00327, 0x51C0009C0030C, 0x520000DC0030C,
+    0x5300009E00304, 0x534000DE00304, 0x5380009E00306,
+    0x53C000DE00306, 0x5400009E0030B, 0x544000DE0030B,
+    0x550000A400301, 0x554000E400301, 0x558000A400327,
+    0x55C000E400327, 0x560000A40030C, 0x564000E40030C,
+    0x568000A600301, 0x56C000E600301, 0x570000A600302,
+    0x574000E600302, 0x578000A600327, 0x57C000E600327,
+    0x580000A60030C, 0x584000E60030C, 0x588000A800327,
+    0x58C000E800327, 0x590000A80030C, 0x594000E80030C,
+    0x5A0000AA00303, 0x5A4000EA00303, 0x5A8000AA00304,
+    0x5AC000EA00304, 0x5B0000AA00306, 0x5B4000EA00306,
+    0x5B8000AA0030A, 0x5BC000EA0030A, 0x5C0000AA0030B,
+    0x5C4000EA0030B, 0x5C8000AA00328, 0x5CC000EA00328,
+    0x5D0000AE00302, 0x5D4000EE00302, 0x5D8000B200302,
+    0x5DC000F200302, 0x5E0000B200308, 0x5E4000B400301,
+    0x5E8000F400301, 0x5EC000B400307, 0x5F0000F400307,
+    0x5F4000B40030C, 0x5F8000F40030C, 0x6800009E0031B,
+    0x684000DE0031B, 0x6BC000AA0031B, 0x6C0000EA0031B,
+    0x734000820030C, 0x738000C20030C, 0x73C000920030C,
+    0x740000D20030C, 0x7440009E0030C, 0x748000DE0030C,
+    0x74C000AA0030C, 0x750000EA0030C, 0x754001B800304,
+    0x758001F800304, 0x75C001B800301, 0x760001F800301,
+    0x764001B80030C, 0x768001F80030C, 0x76C001B800300,
+    0x770001F800300, 0x7780018800304, 0x77C001C800304,
+    0x7800044C00304, 0x7840044E00304, 0x7880018C00304,
+    0x78C001CC00304, 0x7980008E0030C, 0x79C000CE0030C,
+    0x7A0000960030C, 0x7A4000D60030C, 0x7A80009E00328,
+    0x7AC000DE00328, 0x7B0003D400304, 0x7B4003D600304,
+    0x7B80036E0030C, 0x7BC005240030C, 0x7C0000D40030C,
+    0x7D00008E00301, 0x7D4000CE00301, 0x7E00009C00300,
+    0x7E4000DC00300, 0x7E80018A00301, 0x7EC001CA00301,
+    0x7F00018C00301, 0x7F4001CC00301, 0x7F8001B000301,
+    0x7FC001F000301, 0x800000820030F, 0x804000C20030F,
+    0x8080008200311, 0x80C000C200311, 0x8100008A0030F,
+    0x814000CA0030F, 0x8180008A00311, 0x81C000CA00311,
+    0x820000920030F, 0x824000D20030F, 0x8280009200311,
+    0x82C000D200311, 0x8300009E0030F, 0x834000DE0030F,
+    0x8380009E00311, 0x83C000DE00311, 0x840000A40030F,
+    0x844000E40030F, 0x848000A400311, 0x84C000E400311,
+    0x850000AA0030F, 0x854000EA0030F, 0x858000AA00311,
+    0x85C000EA00311, 0x860000A600326, 0x864000E600326,
+    0x868000A800326, 0x86C000E800326, 0x878000900030C,
+    0x87C000D00030C, 0x8980008200307, 0x89C000C200307,
+    0x8A00008A00327, 0x8A4000CA00327, 0x8A8001AC00304,
+    0x8AC001EC00304, 0x8B0001AA00304, 0x8B4001EA00304,
+    0x8B80009E00307, 0x8BC000DE00307, 0x8C00045C00304,
+    0x8C40045E00304, 0x8C8000B200304, 0x8CC000F200304,
+    0xD000060000000, 0xD040060200000, 0xD0C0062600000,
+    0xD100061000301, 0xDD00057200000, 0xDF80007600000,
+    0xE140015000301, 0xE180072200301, 0xE1C0016E00000,
+    0xE200072A00301, 0xE240072E00301, 0xE280073200301,
+    0xE300073E00301, 0xE380074A00301, 0xE3C0075200301,
+    0xE400079400301, 0xEA80073200308, 0xEAC0074A00308,
+    0xEB00076200301, 0xEB40076A00301, 0xEB80076E00301,
+    0xEBC0077200301, 0xEC00079600301, 0xF280077200308,
+    0xF2C0078A00308, 0xF300077E00301, 0xF340078A00301,
+    0xF380079200301, 0xF4C007A400301, 0xF50007A400308,
+    0x10000082A00300, 0x10040082A00308, 0x100C0082600301,
+    0x101C0080C00308, 0x10300083400301, 0x10340083000300,
+    0x10380084600306, 0x10640083000306, 0x10E40087000306,
+    0x11400086A00300, 0x11440086A00308, 0x114C0086600301,
+    0x115C008AC00308, 0x11700087400301, 0x11740087000300,
+    0x11780088600306, 0x11D8008E80030F, 0x11DC008EA0030F,
+    0x13040082C00306, 0x13080086C00306, 0x13400082000306,
+    0x13440086000306, 0x13480082000308, 0x134C0086000308,
+    0x13580082A00306, 0x135C0086A00306, 0x1368009B000308,
+    0x136C009B200308, 0x13700082C00308, 0x13740086C00308,
+    0x13780082E00308, 0x137C0086E00308, 0x13880083000304,
+    0x138C0087000304, 0x13900083000308, 0x13940087000308,
+    0x13980083C00308, 0x139C0087C00308, 0x13A8009D000308,
+    0x13AC009D200308, 0x13B00085A00308, 0x13B40089A00308,
+    0x13B80084600304, 0x13BC0088600304, 0x13C00084600308,
+    0x13C40088600308, 0x13C8008460030B, 0x13CC008860030B,
+    0x13D00084E00308, 0x13D40088E00308, 0x13E00085600308,
+    0x13E40089600308, 0x188800C4E00653, 0x188C00C4E00654,
+    0x189000C9000654, 0x189400C4E00655, 0x189800C9400654,
+    0x1B0000DAA00654, 0x1B0800D8200654, 0x1B4C00DA400654,
+    0x24A4012500093C, 0x24C4012600093C, 0x24D0012660093C,
+    0x25600122A0093C, 0x25640122C0093C, 0x25680122E0093C,
+    0x256C012380093C, 0x2570012420093C, 0x2574012440093C,
+    0x2578012560093C, 0x257C0125E0093C, 0x272C0138E009BE,
+    0x27300138E009D7, 0x277001342009BC, 0x277401344009BC,
+    0x277C0135E009BC, 0x28CC0146400A3C, 0x28D80147000A3C,
+    0x29640142C00A3C, 0x29680142E00A3C, 0x296C0143800A3C,
+    0x29780145600A3C, 0x2D200168E00B56, 0x2D2C0168E00B3E,
+    0x2D300168E00B57, 0x2D700164200B3C, 0x2D740164400B3C,
+    0x2E500172400BD7, 0x2F280178C00BBE, 0x2F2C0178E00BBE,
+    0x2F300178C00BD7, 0x31200188C00C56, 0x33000197E00CD5,
+    0x331C0198C00CD5, 0x33200198C00CD6, 0x33280198C00CC2,
+    0x332C0199400CD5, 0x352801A8C00D3E, 0x352C01A8E00D3E,
+    0x353001A8C00D57, 0x376801BB200DCA, 0x377001BB200DCF,
+    0x377401BB800DCA, 0x377801BB200DDF, 0x3D0C01E8400FB7,
+    0x3D3401E9800FB7, 0x3D4801EA200FB7, 0x3D5C01EAC00FB7,
+    0x3D7001EB600FB7, 0x3DA401E8000FB5, 0x3DCC01EE200F72,
+    0x3DD401EE200F74, 0x3DD801F6400F80, 0x3DE001F6600F80,
+    0x3E0401EE200F80, 0x3E4C01F2400FB7, 0x3E7401F3800FB7,
+    0x3E8801F4200FB7, 0x3E9C01F4C00FB7, 0x3EB001F5600FB7,
+    0x3EE401F2000FB5, 0x40980204A0102E, 0x6C180360A01B35,
+    0x6C200360E01B35, 0x6C280361201B35, 0x6C300361601B35,
+    0x6C380361A01B35, 0x6C480362201B35, 0x6CEC0367401B35,
+    0x6CF40367801B35, 0x6D000367C01B35, 0x6D040367E01B35,
+    0x6D0C0368401B35, 0x78000008200325, 0x7804000C200325,
+    0x78080008400307, 0x780C000C400307, 0x78100008400323,
+    0x7814000C400323, 0x78180008400331, 0x781C000C400331,
+    0x78200018E00301, 0x7824001CE00301, 0x78280008800307,
+    0x782C000C800307, 0x78300008800323, 0x7834000C800323,
+    0x78380008800331, 0x783C000C800331, 0x78400008800327,
+    0x7844000C800327, 0x7848000880032D, 0x784C000C80032D,
+    0x78500022400300, 0x78540022600300, 0x78580022400301,
+    0x785C0022600301, 0x78600008A0032D, 0x7864000CA0032D,
+    0x78680008A00330, 0x786C000CA00330, 0x78700045000306,
+    0x78740045200306, 0x78780008C00307, 0x787C000CC00307,
+    0x78800008E00304, 0x7884000CE00304, 0x78880009000307,
+    0x788C000D000307, 0x78900009000323, 0x7894000D000323,
+    0x78980009000308, 0x789C000D000308, 0x78A00009000327,
+    0x78A4000D000327, 0x78A8000900032E, 0x78AC000D00032E,
+    0x78B00009200330, 0x78B4000D200330, 0x78B80019E00301,
+    0x78BC001DE00301, 0x78C00009600301, 0x78C4000D600301,
+    0x78C80009600323, 0x78CC000D600323, 0x78D00009600331,
+    0x78D4000D600331, 0x78D80009800323, 0x78DC000D800323,
+    0x78E003C6C00304, 0x78E403C6E00304, 0x78E80009800331,
+    0x78EC000D800331, 0x78F0000980032D, 0x78F4000D80032D,
+    0x78F80009A00301, 0x78FC000DA00301, 0x79000009A00307,
+    0x7904000DA00307, 0x79080009A00323, 0x790C000DA00323,
+    0x79100009C00307, 0x7914000DC00307, 0x79180009C00323,
+    0x791C000DC00323, 0x79200009C00331, 0x7924000DC00331,
+    0x79280009C0032D, 0x792C000DC0032D, 0x7930001AA00301,
+    0x7934001EA00301, 0x7938001AA00308, 0x793C001EA00308,
+    0x79400029800300, 0x79440029A00300, 0x79480029800301,
+    0x794C0029A00301, 0x7950000A000301, 0x7954000E000301,
+    0x7958000A000307, 0x795C000E000307, 0x7960000A400307,
+    0x7964000E400307, 0x7968000A400323, 0x796C000E400323,
+    0x797003CB400304, 0x797403CB600304, 0x7978000A400331,
+    0x797C000E400331, 0x7980000A600307, 0x7984000E600307,
+    0x7988000A600323, 0x798C000E600323, 0x7990002B400307,
+    0x7994002B600307, 0x7998002C000307, 0x799C002C200307,
+    0x79A003CC400307, 0x79A403CC600307, 0x79A8000A800307,
+    0x79AC000E800307, 0x79B0000A800323, 0x79B4000E800323,
+    0x79B8000A800331, 0x79BC000E800331, 0x79C0000A80032D,
+    0x79C4000E80032D, 0x79C8000AA00324, 0x79CC000EA00324,
+    0x79D0000AA00330, 0x79D4000EA00330, 0x79D8000AA0032D,
+    0x79DC000EA0032D, 0x79E0002D000301, 0x79E4002D200301,
+    0x79E8002D400308, 0x79EC002D600308, 0x79F0000AC00303,
+    0x79F4000EC00303, 0x79F8000AC00323, 0x79FC000EC00323,
+    0x7A00000AE00300, 0x7A04000EE00300, 0x7A08000AE00301,
+    0x7A0C000EE00301, 0x7A10000AE00308, 0x7A14000EE00308,
+    0x7A18000AE00307, 0x7A1C000EE00307, 0x7A20000AE00323,
+    0x7A24000EE00323, 0x7A28000B000307, 0x7A2C000F000307,
+    0x7A30000B000308, 0x7A34000F000308, 0x7A38000B200307,
+    0x7A3C000F200307, 0x7A40000B400302, 0x7A44000F400302,
+    0x7A48000B400323, 0x7A4C000F400323, 0x7A50000B400331,
+    0x7A54000F400331, 0x7A58000D000331, 0x7A5C000E800308,
+    0x7A60000EE0030A, 0x7A64000F20030A, 0x7A6C002FE00307,
+    0x7A800008200323, 0x7A84000C200323, 0x7A880008200309,
+    0x7A8C000C200309, 0x7A900018400301, 0x7A94001C400301,
+    0x7A980018400300, 0x7A9C001C400300, 0x7AA00018400309,
+    0x7AA4001C400309, 0x7AA80018400303, 0x7AAC001C400303,
+    0x7AB003D4000302, 0x7AB403D4200302, 0x7AB80020400301,
+    0x7ABC0020600301, 0x7AC00020400300, 0x7AC40020600300,
+    0x7AC80020400309, 0x7ACC0020600309, 0x7AD00020400303,
+    0x7AD40020600303, 0x7AD803D4000306, 0x7ADC03D4200306,
+    0x7AE00008A00323, 0x7AE4000CA00323, 0x7AE80008A00309,
+    0x7AEC000CA00309, 0x7AF00008A00303, 0x7AF4000CA00303,
+    0x7AF80019400301, 0x7AFC001D400301, 0x7B000019400300,
+    0x7B04001D400300, 0x7B080019400309, 0x7B0C001D400309,
+    0x7B100019400303, 0x7B14001D400303, 0x7B1803D7000302,
+    0x7B1C03D7200302, 0x7B200009200309, 0x7B24000D200309,
+    0x7B280009200323, 0x7B2C000D200323, 0x7B300009E00323,
+    0x7B34000DE00323, 0x7B380009E00309, 0x7B3C000DE00309,
+    0x7B40001A800301, 0x7B44001E800301, 0x7B48001A800300,
+    0x7B4C001E800300, 0x7B50001A800309, 0x7B54001E800309,
+    0x7B58001A800303, 0x7B5C001E800303, 0x7B6003D9800302,
+    0x7B6403D9A00302, 0x7B680034000301, 0x7B6C0034200301,
+    0x7B700034000300, 0x7B740034200300, 0x7B780034000309,
+    0x7B7C0034200309, 0x7B800034000303, 0x7B840034200303,
+    0x7B880034000323, 0x7B8C0034200323, 0x7B90000AA00323,
+    0x7B94000EA00323, 0x7B98000AA00309, 0x7B9C000EA00309,
+    0x7BA00035E00301, 0x7BA40036000301, 0x7BA80035E00300,
+    0x7BAC0036000300, 0x7BB00035E00309, 0x7BB40036000309,
+    0x7BB80035E00303, 0x7BBC0036000303, 0x7BC00035E00323,
+    0x7BC40036000323, 0x7BC8000B200300, 0x7BCC000F200300,
+    0x7BD0000B200323, 0x7BD4000F200323, 0x7BD8000B200309,
+    0x7BDC000F200309, 0x7BE0000B200303, 0x7BE4000F200303,
+    0x7C000076200313, 0x7C040076200314, 0x7C0803E0000300,
+    0x7C0C03E0200300, 0x7C1003E0000301, 0x7C1403E0200301,
+    0x7C1803E0000342, 0x7C1C03E0200342, 0x7C200072200313,
+    0x7C240072200314, 0x7C2803E1000300, 0x7C2C03E1200300,
+    0x7C3003E1000301, 0x7C3403E1200301, 0x7C3803E1000342,
+    0x7C3C03E1200342, 0x7C400076A00313, 0x7C440076A00314,
+    0x7C4803E2000300, 0x7C4C03E2200300, 0x7C5003E2000301,
+    0x7C5403E2200301, 0x7C600072A00313, 0x7C640072A00314,
+    0x7C6803E3000300, 0x7C6C03E3200300, 0x7C7003E3000301,
+    0x7C7403E3200301, 0x7C800076E00313, 0x7C840076E00314,
+    0x7C8803E4000300, 0x7C8C03E4200300, 0x7C9003E4000301,
+    0x7C9403E4200301, 0x7C9803E4000342, 0x7C9C03E4200342,
+    0x7CA00072E00313, 0x7CA40072E00314, 0x7CA803E5000300,
+    0x7CAC03E5200300, 0x7CB003E5000301, 0x7CB403E5200301,
+    0x7CB803E5000342, 0x7CBC03E5200342, 0x7CC00077200313,
+    0x7CC40077200314, 0x7CC803E6000300, 0x7CCC03E6200300,
+    0x7CD003E6000301, 0x7CD403E6200301, 0x7CD803E6000342,
+    0x7CDC03E6200342, 0x7CE00073200313, 0x7CE40073200314,
+    0x7CE803E7000300, 0x7CEC03E7200300, 0x7CF003E7000301,
+    0x7CF403E7200301, 0x7CF803E7000342, 0x7CFC03E7200342,
+    0x7D000077E00313, 0x7D040077E00314, 0x7D0803E8000300,
+    0x7D0C03E8200300, 0x7D1003E8000301, 0x7D1403E8200301,
+    0x7D200073E00313, 0x7D240073E00314, 0x7D2803E9000300,
+    0x7D2C03E9200300, 0x7D3003E9000301, 0x7D3403E9200301,
+    0x7D400078A00313, 0x7D440078A00314, 0x7D4803EA000300,
+    0x7D4C03EA200300, 0x7D5003EA000301, 0x7D5403EA200301,
+    0x7D5803EA000342, 0x7D5C03EA200342, 0x7D640074A00314,
+    0x7D6C03EB200300, 0x7D7403EB200301, 0x7D7C03EB200342,
+    0x7D800079200313, 0x7D840079200314, 0x7D8803EC000300,
+    0x7D8C03EC200300, 0x7D9003EC000301, 0x7D9403EC200301,
+    0x7D9803EC000342, 0x7D9C03EC200342, 0x7DA00075200313,
+    0x7DA40075200314, 0x7DA803ED000300, 0x7DAC03ED200300,
+    0x7DB003ED000301, 0x7DB403ED200301, 0x7DB803ED000342,
+    0x7DBC03ED200342, 0x7DC00076200300, 0x7DC40075800000,
+    0x7DC80076A00300, 0x7DCC0075A00000, 0x7DD00076E00300,
+    0x7DD40075C00000, 0x7DD80077200300, 0x7DDC0075E00000,
+    0x7DE00077E00300, 0x7DE40079800000, 0x7DE80078A00300,
+    0x7DEC0079A00000, 0x7DF00079200300, 0x7DF40079C00000,
+    0x7E0003E0000345, 0x7E0403E0200345, 0x7E0803E0400345,
+    0x7E0C03E0600345, 0x7E1003E0800345, 0x7E1403E0A00345,
+    0x7E1803E0C00345, 0x7E1C03E0E00345, 0x7E2003E1000345,
+    0x7E2403E1200345, 0x7E2803E1400345, 0x7E2C03E1600345,
+    0x7E3003E1800345, 0x7E3403E1A00345, 0x7E3803E1C00345,
+    0x7E3C03E1E00345, 0x7E4003E4000345, 0x7E4403E4200345,
+    0x7E4803E4400345, 0x7E4C03E4600345, 0x7E5003E4800345,
+    0x7E5403E4A00345, 0x7E5803E4C00345, 0x7E5C03E4E00345,
+    0x7E6003E5000345, 0x7E6403E5200345, 0x7E6803E5400345,
+    0x7E6C03E5600345, 0x7E7003E5800345, 0x7E7403E5A00345,
+    0x7E7803E5C00345, 0x7E7C03E5E00345, 0x7E8003EC000345,
+    0x7E8403EC200345, 0x7E8803EC400345, 0x7E8C03EC600345,
+    0x7E9003EC800345, 0x7E9403ECA00345, 0x7E9803ECC00345,
+    0x7E9C03ECE00345, 0x7EA003ED000345, 0x7EA403ED200345,
+    0x7EA803ED400345, 0x7EAC03ED600345, 0x7EB003ED800345,
+    0x7EB403EDA00345, 0x7EB803EDC00345, 0x7EBC03EDE00345,
+    0x7EC00076200306, 0x7EC40076200304, 0x7EC803EE000345,
+    0x7ECC0076200345, 0x7ED00075800345, 0x7ED80076200342,
+    0x7EDC03F6C00345, 0x7EE00072200306, 0x7EE40072200304,
+    0x7EE80072200300, 0x7EEC0070C00000, 0x7EF00072200345,
+    0x7EF80077200000, 0x7F040015000342, 0x7F0803EE800345,
+    0x7F0C0076E00345, 0x7F100075C00345, 0x7F180076E00342,
+    0x7F1C03F8C00345, 0x7F200072A00300, 0x7F240071000000,
+    0x7F280072E00300, 0x7F2C0071200000, 0x7F300072E00345,
+    0x7F3403F7E00300, 0x7F3803F7E00301, 0x7F3C03F7E00342,
+    0x7F400077200306, 0x7F440077200304, 0x7F480079400300,
+    0x7F4C0072000000, 0x7F580077200342, 0x7F5C0079400342,
+    0x7F600073200306, 0x7F640073200304, 0x7F680073200300,
+    0x7F6C0071400000, 0x7F7403FFC00300, 0x7F7803FFC00301,
+    0x7F7C03FFC00342, 0x7F800078A00306, 0x7F840078A00304,
+    0x7F880079600300, 0x7F8C0076000000, 0x7F900078200313,
+    0x7F940078200314, 0x7F980078A00342, 0x7F9C0079600342,
+    0x7FA00074A00306, 0x7FA40074A00304, 0x7FA80074A00300,
+    0x7FAC0071C00000, 0x7FB00074200314, 0x7FB40015000300,
+    0x7FB80070A00000, 0x7FBC000C000000, 0x7FC803EF800345,
+    0x7FCC0079200345, 0x7FD00079C00345, 0x7FD80079200342,
+    0x7FDC03FEC00345, 0x7FE00073E00300, 0x7FE40071800000,
+    0x7FE80075200300, 0x7FEC0071E00000, 0x7FF00075200345,
+    0x7FF40016800000, 0x80000400400000, 0x80040400600000,
+    0x84980075200000, 0x84A80009600000, 0x84AC0018A00000,
+    0x86680432000338, 0x866C0432400338, 0x86B80432800338,
+    0x8734043A000338, 0x8738043A800338, 0x873C043A400338,
+    0x88100440600338, 0x88240441000338, 0x88300441600338,
+    0x88900444600338, 0x88980444A00338, 0x89040447800338,
+    0x89100448600338, 0x891C0448A00338, 0x89240449000338,
+    0x89800007A00338, 0x8988044C200338, 0x89B40449A00338,
+    0x89B80007800338, 0x89BC0007C00338, 0x89C0044C800338,
+    0x89C4044CA00338, 0x89D0044E400338, 0x89D4044E600338,
+    0x89E0044EC00338, 0x89E4044EE00338, 0x8A00044F400338,
+    0x8A04044F600338, 0x8A100450400338, 0x8A140450600338,
+    0x8A200450C00338, 0x8A240450E00338, 0x8AB00454400338,
+    0x8AB40455000338, 0x8AB80455200338, 0x8ABC0455600338,
+    0x8B80044F800338, 0x8B84044FA00338, 0x8B880452200338,
+    0x8B8C0452400338, 0x8BA80456400338, 0x8BAC0456600338,
+    0x8BB00456800338, 0x8BB40456A00338, 0x8CA40601000000,
+    0x8CA80601200000, 0xAB70055BA00338, 0xC1300609603099,
+    0xC1380609A03099, 0xC1400609E03099, 0xC148060A203099,
+    0xC150060A603099, 0xC158060AA03099, 0xC160060AE03099,
+    0xC168060B203099, 0xC170060B603099, 0xC178060BA03099,
+    0xC180060BE03099, 0xC188060C203099, 0xC194060C803099,
+    0xC19C060CC03099, 0xC1A4060D003099, 0xC1C0060DE03099,
+    0xC1C4060DE0309A, 0xC1CC060E403099, 0xC1D0060E40309A,
+    0xC1D8060EA03099, 0xC1DC060EA0309A, 0xC1E4060F003099,
+    0xC1E8060F00309A, 0xC1F0060F603099, 0xC1F4060F60309A,
+    0xC2500608C03099, 0xC2780613A03099, 0xC2B00615603099,
+    0xC2B80615A03099, 0xC2C00615E03099, 0xC2C80616203099,
+    0xC2D00616603099, 0xC2D80616A03099, 0xC2E00616E03099,
+    0xC2E80617203099, 0xC2F00617603099, 0xC2F80617A03099,
+    0xC3000617E03099, 0xC3080618203099, 0xC3140618803099,
+    0xC31C0618C03099, 0xC3240619003099, 0xC3400619E03099,
+    0xC3440619E0309A, 0xC34C061A403099, 0xC350061A40309A,
+    0xC358061AA03099, 0xC35C061AA0309A, 0xC364061B003099,
+    0xC368061B00309A, 0xC370061B603099, 0xC374061B60309A,
+    0xC3D00614C03099, 0xC3DC061DE03099, 0xC3E0061E003099,
+    0xC3E4061E203099, 0xC3E8061E403099, 0xC3F8061FA03099,
+    0x3E4001189000000, 0x3E4040CDE800000, 0x3E40811D9400000,
+    0x3E40C1199000000, 0x3E4100DDA200000, 0x3E41409C6400000,
+    0x3E4180A7CA00000, 0x3E41C13F3800000, 0x3E42013F3800000,
+    0x3E4240B2A200000, 0x3E428123A200000, 0x3E42C0AB0E00000,
+    0x3E4300B29000000, 0x3E4340C3EC00000, 0x3E4380ECD200000,
+    0x3E43C0FF0A00000, 0x3E44010C7E00000, 0x3E44410F7400000,
+    0x3E448111F000000, 0x3E44C1211E00000, 0x3E4500D40400000,
+    0x3E4540DA3600000, 0x3E4580E1B200000, 0x3E45C0E7BC00000,
+    0x3E4601087A00000, 0x3E464122D400000, 0x3E468133E200000,
+    0x3E46C09D0400000, 0x3E4700A6EA00000, 0x3E4740D60800000,
+    0x3E4780E43600000, 0x3E47C10C5A00000, 0x3E48013C3C00000,
+    0x3E4840BAA000000, 0x3E4880DFD600000, 0x3E48C10B9A00000,
+    0x3E490112C800000, 0x3E4940C59200000, 0x3E498103B000000,
+    0x3E49C1103E00000, 0x3E4A00BD9400000, 0x3E4A40CE2E00000,
+    0x3E4A80DAD400000, 0x3E4AC0E5F800000, 0x3E4B01219C00000,
+    0x3E4B409F0C00000, 0x3E4B80A36E00000, 0x3E4BC0A5BC00000,
+    0x3E4C00C98800000, 0x3E4C40D5A600000, 0x3E4C80E42000000,
+    0x3E4CC0EDCE00000, 0x3E4D01000200000, 0x3E4D410C0C00000,
+    0x3E4D810CB800000, 0x3E4DC11BDE00000, 0x3E4E012E6400000,
+    0x3E4E4136DE00000, 0x3E4E813BF400000, 0x3E4EC0F11800000,
+    0x3E4F00F2FE00000, 0x3E4F40FB4000000, 0x3E4F81079200000,
+    0x3E4FC1260800000, 0x3E50013CFE00000, 0x3E504115AC00000,
+    0x3E5080B1BE00000, 0x3E50C0BE0800000, 0x3E5100F8C000000,
+    0x3E514100FC00000, 0x3E5180E4C400000, 0x3E51C0F19400000,
+    0x3E5201198400000, 0x3E52412DEE00000, 0x3E5280B1B000000,
+    0x3E52C0B8C400000, 0x3E5300D42600000, 0x3E5340DBB400000,
+    0x3E5380DE1E00000, 0x3E53C0FA5E00000, 0x3E5400FC6E00000,
+    0x3E54412C9600000, 0x3E5480A5A400000, 0x3E54C1011600000,
+    0x3E5500A3B800000, 0x3E5540A39800000, 0x3E5580F43800000,
+    0x3E55C0FB7C00000, 0x3E560107E200000, 0x3E56412CEA00000,
+    0x3E5681170000000, 0x3E56C0C59E00000, 0x3E5700D40400000,
+    0x3E574115FC00000, 0x3E57809C7200000, 0x3E57C0B7CE00000,
+    0x3E5800C02400000, 0x3E5840E70E00000, 0x3E5880EAE000000,
+    0x3E58C0A62E00000, 0x3E5900F1F600000, 0x3E59409F7E00000,
+    0x3E5980BF5200000, 0x3E59C09C1A00000, 0x3E5A00D99800000,
+    0x3E5A40CAF000000, 0x3E5A80FA4400000, 0x3E5AC0A78600000,
+    0x3E5B00B0BC00000, 0x3E5B40EE0200000, 0x3E5B81089200000,
+    0x3E5BC1155400000, 0x3E5C00D77400000, 0x3E5C411F6000000,
+    0x3E5C80D91000000, 0x3E5CC0C5FC00000, 0x3E5D0105CA00000,
+    0x3E5D40C74000000, 0x3E5D80EACA00000, 0x3E5DC09D5C00000,
+    0x3E5E00A2D200000, 0x3E5E40A39200000, 0x3E5E80D10200000,
+    0x3E5EC0F9CE00000, 0x3E5F0104DE00000, 0x3E5F4115A400000,
+    0x3E5F81239E00000, 0x3E5FC0A5EA00000, 0x3E6000A88400000,
+    0x3E6040B2E600000, 0x3E6080BDD800000, 0x3E60C0CB8A00000,
+    0x3E6100DFFC00000, 0x3E6140F25400000, 0x3E61812B5A00000,
+    0x3E61C134D400000, 0x3E62013D2E00000, 0x3E62413D9C00000,
+    0x3E6280A53600000, 0x3E62C0CD8C00000, 0x3E6300D6EE00000,
+    0x3E63411EC400000, 0x3E6380BCE800000, 0x3E63C0C32000000,
+    0x3E6400C40000000, 0x3E6440C93400000, 0x3E6480DE4600000,
+    0x3E64C0E29200000, 0x3E6500E91200000, 0x3E6540F39400000,
+    0x3E6580FBE800000, 0x3E65C100DE00000, 0x3E66011E4C00000,
+    0x3E664109DC00000, 0x3E6681204600000, 0x3E66C1269400000,
+    0x3E6700A42E00000, 0x3E6740A54600000, 0x3E6780A97A00000,
+    0x3E67C0E19000000, 0x3E6801118400000, 0x3E6841155400000,
+    0x3E6880BD9200000, 0x3E68C0BFEA00000, 0x3E6900C6F600000,
+    0x3E6940D75C00000, 0x3E6980F87C00000, 0x3E69C0E6EA00000,
+    0x3E6A009DC800000, 0x3E6A40ADF200000, 0x3E6A80B7CE00000,
+    0x3E6AC0BB7400000, 0x3E6B00C03800000, 0x3E6B40E76400000,
+    0x3E6B80E8D200000, 0x3E6BC0FF3400000, 0x3E6C01008C00000,
+    0x3E6C41246800000, 0x3E6C812DEC00000, 0x3E6CC12E9000000,
+    0x3E6D01303000000, 0x3E6D409F1600000, 0x3E6D80F35C00000,
+    0x3E6DC1236800000, 0x3E6E012D7000000, 0x3E6E40C1C200000,
+    0x3E6E809D0C00000, 0x3E6EC0A1B400000, 0x3E6F00B7DC00000,
+    0x3E6F40B87E00000, 0x3E6F80CB3200000, 0x3E6FC0D40400000,
+    0x3E7000E39C00000, 0x3E7040EC8400000, 0x3E708109F800000,
+    0x3E70C120F800000, 0x3E71013F1A00000, 0x3E7140CD1000000,
+    0x3E71812C5C00000, 0x3E71C0A51200000, 0x3E7200CEF600000,
+    0x3E7240CFE600000, 0x3E7280DA8200000, 0x3E72C0DD3800000,
+    0x3E7300E81200000, 0x3E7340EAB200000, 0x3E7380F0D600000,
+    0x3E73C0FA2000000, 0x3E740130BC00000, 0x3E7440A2DA00000,
+    0x3E7480C45C00000, 0x3E74C12CF000000, 0x3E7500A05600000,
+    0x3E7540BA3200000, 0x3E7580DBD400000, 0x3E75C11E5400000,
+    0x3E7600BF1600000, 0x3E7640C28800000, 0x3E7680D02E00000,
+    0x3E76C0E70E00000, 0x3E77012D0C00000, 0x3E7740A45200000,
+    0x3E7780A81E00000, 0x3E77C0B8CA00000, 0x3E7800CC2600000,
+    0x3E7840CE9C00000, 0x3E7880D15000000, 0x3E78C0D9CA00000,
+    0x3E7900E80C00000, 0x3E7940EBC400000, 0x3E7980FEF200000,
+    0x3E79C1119E00000, 0x3E7A0111C200000, 0x3E7A41239800000,
+    0x3E7A812DC400000, 0x3E7AC0A67E00000, 0x3E7B00DD7400000,
+    0x3E7B40A83A00000, 0x3E7B80E3A000000, 0x3E7BC0E93000000,
+    0x3E7C010BF400000, 0x3E7C412D4600000, 0x3E7C8138AE00000,
+    0x3E7CC13D3E00000, 0x3E7D00CF2E00000, 0x3E7D40DB9600000,
+    0x3E7D8103D000000, 0x3E7DC0F59600000, 0x3E7E00F64000000,
+    0x3E7E40F92400000, 0x3E7E80E58000000, 0x3E7EC0E13200000,
+    0x3E7F0116B000000, 0x3E7F409D8000000, 0x3E7F81066C00000,
+    0x3E7FC0A47400000, 0x3E8000A40E00000, 0x3E8040BD4C00000,
+    0x3E8080C5A600000, 0x3E80C0F9AC00000, 0x3E8100B70A00000,
+    0x3E8140DA3C00000, 0x3E8180CD6800000, 0x3E81C11E7600000,
+    0x3E8201109800000, 0x3E82412C9A00000, 0x3E8281131600000,
+    0x3E82C0BDA600000, 0x3E8300A28000000, 0x3E8340AB8000000,
+    0x3E8400B0B400000, 0x3E8480CCE800000, 0x3E8540A3BC00000,
+    0x3E8580E65400000, 0x3E85C0ED9400000, 0x3E8600F27800000,
+    0x3E8640F2BC00000, 0x3E8680F2CA00000, 0x3E86C0F31E00000,
+    0x3E87012EAC00000, 0x3E8740F97C00000, 0x3E8780FF7A00000,
+    0x3E88010C2400000, 0x3E888115F000000, 0x3E8941207000000,
+    0x3E898121FA00000, 0x3E8A8131DE00000, 0x3E8AC131F800000,
+    0x3E8B01325000000, 0x3E8B413B6800000, 0x3E8B8121BC00000,
+    0x3E8BC12D6E00000, 0x3E8C009F5C00000, 0x3E8C40A1CE00000,
+    0x3E8C80A29A00000, 0x3E8CC0A59200000, 0x3E8D00A5C800000,
+    0x3E8D40A6A200000, 0x3E8D80AB3A00000, 0x3E8DC0AC0C00000,
+    0x3E8E00ACD000000, 0x3E8E40B08000000, 0x3E8E80B15000000,
+    0x3E8EC0B8C800000, 0x3E8F00B8DC00000, 0x3E8F40C12800000,
+    0x3E8F80C2D000000, 0x3E8FC0C31C00000, 0x3E9000C3E400000,
+    0x3E9040CA9E00000, 0x3E9080CBC400000, 0x3E90C0CD2200000,
+    0x3E9100D10A00000, 0x3E9140DAEE00000, 0x3E9180DC3400000,
+    0x3E91C0DE4400000, 0x3E9200E2DC00000, 0x3E9240E45600000,
+    0x3E9280E84400000, 0x3E92C0F12200000, 0x3E9300F27C00000,
+    0x3E9340F29200000, 0x3E9380F29000000, 0x3E93C0F2A000000,
+    0x3E9400F2AC00000, 0x3E9440F2BA00000, 0x3E9480F31A00000,
+    0x3E94C0F31C00000, 0x3E9500F48000000, 0x3E9540F50200000,
+    0x3E9580F78000000, 0x3E95C0FBE800000, 0x3E9600FC1200000,
+    0x3E9640FC8200000, 0x3E9680FEE400000, 0x3E96C1000A00000,
+    0x3E970103DA00000, 0x3E974104F200000, 0x3E978104F200000,
+    0x3E97C108AE00000, 0x3E9801122000000, 0x3E9841132C00000,
+    0x3E9881160200000, 0x3E98C1167200000, 0x3E990119A600000,
+    0x3E99411A1000000, 0x3E99811F6C00000, 0x3E99C1207000000,
+    0x3E9A012DC600000, 0x3E9A412FFE00000, 0x3E9A81307600000,
+    0x3E9AC0C0EA00000, 0x3E9B0485DC00000, 0x3E9B41043000000,
+    0x3E9C009C4C00000, 0x3E9C40A36A00000, 0x3E9C80A2D000000,
+    0x3E9CC09F0000000, 0x3E9D00A28A00000, 0x3E9D40A30000000,
+    0x3E9D80A58E00000, 0x3E9DC0A5F400000, 0x3E9E00AB3A00000,
+    0x3E9E40AAAA00000, 0x3E9E80AB3200000, 0x3E9EC0ABC400000,
+    0x3E9F00B0B400000, 0x3E9F40B16600000, 0x3E9F80B28800000,
+    0x3E9FC0B2A800000, 0x3EA000B4C400000, 0x3EA040B65000000,
+    0x3EA080BDA400000, 0x3EA0C0BDB200000, 0x3EA100BED200000,
+    0x3EA140BF5A00000, 0x3EA180C1B000000, 0x3EA1C0C29C00000,
+    0x3EA200C21000000, 0x3EA240C31C00000, 0x3EA280C2C000000,
+    0x3EA2C0C3E400000, 0x3EA300C46800000, 0x3EA340C78800000,
+    0x3EA380C83800000, 0x3EA3C0C8A400000, 0x3EA400CAAC00000,
+    0x3EA440CCE800000, 0x3EA480CE2E00000, 0x3EA4C0CE3600000,
+    0x3EA500CEAC00000, 0x3EA540D6F200000, 0x3EA580D77400000,
+    0x3EA5C0DA8200000, 0x3EA600DDB600000, 0x3EA640DD9600000,
+    0x3EA680DE4400000, 0x3EA6C0E03C00000, 0x3EA700E2DC00000,
+    0x3EA740EF4E00000, 0x3EA780E46A00000, 0x3EA7C0E55E00000,
+    0x3EA800E65400000, 0x3EA840E8E200000, 0x3EA880EA0C00000,
+    0x3EA8C0EA7600000, 0x3EA900EC3A00000, 0x3EA940EC3E00000,
+    0x3EA980ED9400000, 0x3EA9C0EDB600000, 0x3EAA00EDE800000,
+    0x3EAA40EE9400000, 0x3EAA80EE8000000, 0x3EAAC0F19800000,
+    0x3EAB00F56200000, 0x3EAB40F78000000, 0x3EAB80F8F600000,
+    0x3EABC0FAB600000, 0x3EAC00FBE800000, 0x3EAC40FE7C00000,
+    0x3EAC81000A00000, 0x3EACC106A400000, 0x3EAD0107DE00000,
+    0x3EAD410EF200000, 0x3EAD81128200000, 0x3EADC1130C00000,
+    0x3EAE01132C00000, 0x3EAE41157E00000, 0x3EAE8115F000000,
+    0x3EAEC1159600000, 0x3EAF01160200000, 0x3EAF4115FC00000,
+    0x3EAF8115DA00000, 0x3EAFC1167200000, 0x3EB001171400000,
+    0x3EB0411A1000000, 0x3EB0811E7000000, 0x3EB0C120E400000,
+    0x3EB101233200000, 0x3EB14124EC00000, 0x3EB1812CF800000,
+    0x3EB1C12DC600000, 0x3EB2012EAC00000, 0x3EB2412FB600000,
+    0x3EB2812FFE00000, 0x3EB2C1301600000, 0x3EB301307600000,
+    0x3EB341362400000, 0x3EB3813F3800000, 0x3EB3C4509400000,
+    0x3EB404508800000, 0x3EB44467AA00000, 0x3EB480773A00000,
+    0x3EB4C0803000000, 0x3EB500807200000, 0x3EB544A49200000,
+    0x3EB584B9A000000, 0x3EB5C4FDA600000, 0x3EB6013E8600000,
+    0x3EB6413F1C00000, 0x3EC7400BB2005B4, 0x3EC7C00BE4005B7,
+    0x3ECA800BD2005C1, 0x3ECAC00BD2005C2, 0x3ECB01F692005C1,
+    0x3ECB41F692005C2, 0x3ECB800BA0005B7, 0x3ECBC00BA0005B8,
+    0x3ECC000BA0005BC, 0x3ECC400BA2005BC, 0x3ECC800BA4005BC,
+    0x3ECCC00BA6005BC, 0x3ECD000BA8005BC, 0x3ECD400BAA005BC,
+    0x3ECD800BAC005BC, 0x3ECE000BB0005BC, 0x3ECE400BB2005BC,
+    0x3ECE800BB4005BC, 0x3ECEC00BB6005BC, 0x3ECF000BB8005BC,
+    0x3ECF800BBC005BC, 0x3ED0000BC0005BC, 0x3ED0400BC2005BC,
+    0x3ED0C00BC6005BC, 0x3ED1000BC8005BC, 0x3ED1800BCC005BC,
+    0x3ED1C00BCE005BC, 0x3ED2000BD0005BC, 0x3ED2400BD2005BC,
+    0x3ED2800BD4005BC, 0x3ED2C00BAA005B9, 0x3ED3000BA2005BF,
+    0x3ED3400BB6005BF, 0x3ED3800BC8005BF, 0x4426822132110BA,
+    0x4427022136110BA, 0x442AC2214A110BA, 0x444B82226211127,
+    0x444BC2226411127, 0x44D2C2268E1133E, 0x44D302268E11357,
+    0x452EC22972114BA, 0x452F022972114B0, 0x452F822972114BD,
+    0x456E822B70115AF, 0x456EC22B72115AF, 0x464E02326A11930,
+    0x745783A2AE1D165, 0x7457C3A2B01D165, 0x745803A2BE1D16E,
+    0x745843A2BE1D16F, 0x745883A2BE1D170, 0x7458C3A2BE1D171,
+    0x745903A2BE1D172, 0x746EC3A3721D165, 0x746F03A3741D165,
+    0x746F43A3761D16E, 0x746F83A3781D16E, 0x746FC3A3761D16F,
+    0x747003A3781D16F, 0xBE00009C7A00000, 0xBE00409C7000000,
+    0xBE00809C8200000, 0xBE00C4024400000, 0xBE01009EC000000,
+    0xBE01409F5C00000, 0xBE01809F7600000, 0xBE01C0A00400000,
+    0xBE0200A0F400000, 0xBE0240A13200000, 0xBE0280A1CE00000,
+    0xBE02C0A19E00000, 0xBE0300693C00000, 0xBE03440C7400000,
+    0xBE0380A29A00000, 0xBE03C0A2A800000, 0xBE0400A2C800000,
+    0xBE0440A2EE00000, 0xBE04840A3800000, 0xBE04C0697200000,
+    0xBE0500A2CE00000, 0xBE0540A31A00000, 0xBE05840A9600000,
+    0xBE05C0A32E00000, 0xBE0600A34800000, 0xBE06409D9800000,
+    0xBE0680A35800000, 0xBE06C0A36A00000, 0xBE070523BE00000,
+    0xBE0740A3EA00000, 0xBE0780A40600000, 0xBE07C069BE00000,
+    0xBE0800A47600000, 0xBE0840A48C00000, 0xBE0880A4E400000,
+    0xBE08C0A4EE00000, 0xBE09006A2A00000, 0xBE0940A58E00000,
+    0xBE0980A59200000, 0xBE09C0A5C800000, 0xBE0A00A5F400000,
+    0xBE0A40A60A00000, 0xBE0A80A60C00000, 0xBE0AC0A62E00000,
+    0xBE0B00A69200000, 0xBE0B40A6A200000, 0xBE0B80A6B400000,
+    0xBE0BC0A6E600000, 0xBE0C00A6FA00000, 0xBE0C40A6FE00000,
+    0xBE0C80A6FE00000, 0xBE0CC0A6FE00000, 0xBE0D04145800000,
+    0xBE0D40E0E000000, 0xBE0D80A79400000, 0xBE0DC0A7BE00000,
+    0xBE0E0416C600000, 0xBE0E40A7D600000, 0xBE0E80A7E200000,
+    0xBE0EC0A80C00000, 0xBE0F00A93C00000, 0xBE0F40A87000000,
+    0xBE0F80A89000000, 0xBE0FC0A8D000000, 0xBE1000A94400000,
+    0xBE1040A9EC00000, 0xBE1080AA2000000, 0xBE10C0AAA600000,
+    0xBE1100AAC600000, 0xBE1140AB0800000, 0xBE1180AB0800000,
+    0xBE11C0AB3200000, 0xBE1200AB5600000, 0xBE1240AB6600000,
+    0xBE1280AB8400000, 0xBE12C0AE2C00000, 0xBE1300AC0C00000,
+    0xBE1340AE2E00000, 0xBE1380ACA200000, 0xBE13C0ACE800000,
+    0xBE1400A40E00000, 0xBE1440B1DC00000, 0xBE1480AF9C00000,
+    0xBE14C0AFE800000, 0xBE1500B01A00000, 0xBE1540AF1600000,
+    0xBE1580B06400000, 0xBE15C0B06200000, 0xBE1600B15800000,
+    0xBE164429C800000, 0xBE1680B1E400000, 0xBE16C0B1EE00000,
+    0xBE1700B20C00000, 0xBE1740B23400000, 0xBE1780B24400000,
+    0xBE17C0B2C400000, 0xBE18042D5000000, 0xBE18442DD400000,
+    0xBE1880B3D800000, 0xBE18C0B43600000, 0xBE1900B44E00000,
+    0xBE1940B3B000000, 0xBE1980B4CC00000, 0xBE19C06DDC00000,
+    0xBE1A006DF800000, 0xBE1A40B61000000, 0xBE1A80B67C00000,
+    0xBE1AC0B67C00000, 0xBE1B04339000000, 0xBE1B40B78600000,
+    0xBE1B80B7B000000, 0xBE1BC0B7CE00000, 0xBE1C00B7E600000,
+    0xBE1C44363000000, 0xBE1C80B7FE00000, 0xBE1CC0B80C00000,
+    0xBE1D00BEA600000, 0xBE1D40B84400000, 0xBE1D806F0200000,
+    0xBE1DC0B8C000000, 0xBE1E00B8DC00000, 0xBE1E40B98000000,
+    0xBE1E80B91A00000, 0xBE1EC43BC800000, 0xBE1F00BA8600000,
+    0xBE1F443BCC00000, 0xBE1F80BADC00000, 0xBE1FC0BAD600000,
+    0xBE2000BAF800000, 0xBE2040BBC200000, 0xBE2080BBC400000,
+    0xBE20C0705E00000, 0xBE2100BBFA00000, 0xBE2140BC5000000,
+    0xBE2180BC7A00000, 0xBE21C0BCD200000, 0xBE220070C400000,
+    0xBE2244430600000, 0xBE228070F800000, 0xBE22C0BD6000000,
+    0xBE2300BD6600000, 0xBE2340BD6C00000, 0xBE2380BD9400000,
+    0xBE23C5472400000, 0xBE2400BDFC00000, 0xBE2444466200000,
+    0xBE2484466200000, 0xBE24C1040200000, 0xBE2500BE4400000,
+    0xBE2540BE4400000, 0xBE2580718E00000, 0xBE25C4657000000,
+    0xBE2604C3B400000, 0xBE2640BEC400000, 0xBE2680BED600000,
+    0xBE26C071C600000, 0xBE2700BF3400000, 0xBE2740BF9A00000,
+    0xBE2780BFAE00000, 0xBE27C0BFF200000, 0xBE2800C10200000,
+    0xBE2840727400000, 0xBE2880723800000, 0xBE28C0C12800000,
+    0xBE29044DA800000, 0xBE2940C18E00000, 0xBE2980C29000000,
+    0xBE29C0C29800000, 0xBE2A00C29C00000, 0xBE2A40C29800000,
+    0xBE2A80C2F400000, 0xBE2AC0C31C00000, 0xBE2B00C36400000,
+    0xBE2B40C34800000, 0xBE2B80C35E00000, 0xBE2BC0C3BC00000,
+    0xBE2C00C3E400000, 0xBE2C40C3EC00000, 0xBE2C80C42000000,
+    0xBE2CC0C43600000, 0xBE2D00C4BA00000, 0xBE2D40C56200000,
+    0xBE2D80C5A800000, 0xBE2DC0C6A000000, 0xBE2E04561800000,
+    0xBE2E40C67A00000, 0xBE2E80C5F800000, 0xBE2EC0C6D000000,
+    0xBE2F00C70600000, 0xBE2F40C7C800000, 0xBE2F8457E200000,
+    0xBE2FC0C84400000, 0xBE3000C78A00000, 0xBE3040C75200000,
+    0xBE3080745C00000, 0xBE30C0C8D200000, 0xBE3100C8FC00000,
+    0xBE3140C93A00000, 0xBE3180C8EE00000, 0xBE31C074D800000,
+    0xBE3200CA9E00000, 0xBE3240CAD800000, 0xBE3284601400000,
+    0xBE32C0CBC600000, 0xBE3300CDF000000, 0xBE3340CC9200000,
+    0xBE3380763200000, 0xBE33C0CD2200000, 0xBE3400761000000,
+    0xBE344075C800000, 0xBE3480A32400000, 0xBE34C0A32A00000,
+    0xBE3500CE0000000, 0xBE3540CD3800000, 0xBE3581015A00000,
+    0xBE35C087B200000, 0xBE3600CE2E00000, 0xBE3640CE3600000,
+    0xBE3680CE4200000, 0xBE36C0CEBC00000, 0xBE3700CEA600000,
+    0xBE3744678600000, 0xBE3780769200000, 0xBE37C0CFF400000,
+    0xBE3800CF0A00000, 0xBE3840D0A400000, 0xBE3880D10A00000,
+    0xBE38C468DA00000, 0xBE3900D11C00000, 0xBE3940D03E00000,
+    0xBE3980D22800000, 0xBE39C0773A00000, 0xBE3A00D28400000,
+    0xBE3A40D34600000, 0xBE3A80D3D400000, 0xBE3AC0D55000000,
+    0xBE3B046D4600000, 0xBE3B40D5B600000, 0xBE3B80783000000,
+    0xBE3BC0D64200000, 0xBE3C04714E00000, 0xBE3C40D6A800000,
+    0xBE3C80789C00000, 0xBE3CC0D6E400000, 0xBE3D00D73E00000,
+    0xBE3D40D77400000, 0xBE3D80D77600000, 0xBE3DC4751A00000,
+    0xBE3E043A1600000, 0xBE3E4475F400000, 0xBE3E80D89C00000,
+    0xBE3EC4797800000, 0xBE3F00D97E00000, 0xBE3F40D99A00000,
+    0xBE3F80D8CE00000, 0xBE3FC0DA2C00000, 0xBE4000DA7C00000,
+    0xBE4040DAEE00000, 0xBE4080DA8200000, 0xBE40C0DAD200000,
+    0xBE4100DAF000000, 0xBE4140DB0A00000, 0xBE41847A3C00000,
+    0xBE41C0DA6800000, 0xBE4200DC5E00000, 0xBE4240DCDC00000,
+    0xBE42807A6600000, 0xBE42C0DD9600000, 0xBE4300DD8E00000,
+    0xBE43447DA200000, 0xBE4380DBF200000, 0xBE43C0DEDC00000,
+    0xBE44047EBC00000, 0xBE44447F1C00000, 0xBE4480DF8C00000,
+    0xBE44C0E07200000, 0xBE4500E03C00000, 0xBE4540E03600000,
+    0xBE45807B2C00000, 0xBE45C0E09400000, 0xBE4600E0FA00000,
+    0xBE4640E0EE00000, 0xBE4680E15A00000, 0xBE46C40A4A00000,
+    0xBE4700E28A00000, 0xBE474484C600000, 0xBE4780E33800000,
+    0xBE47C4875600000, 0xBE4800E45000000, 0xBE4840E46A00000,
+    0xBE4880E4A000000, 0xBE48C48C1000000, 0xBE4900E50000000,
+    0xBE4940E52A00000, 0xBE49848E6A00000, 0xBE49C4902800000,
+    0xBE4A00E6F400000, 0xBE4A40E71600000, 0xBE4A807D5800000,
+    0xBE4AC0E74A00000, 0xBE4B007D7000000, 0xBE4B407D7000000,
+    0xBE4B80E88E00000, 0xBE4BC0E8B800000, 0xBE4C00E8E200000,
+    0xBE4C40E90A00000, 0xBE4C80E99400000, 0xBE4CC07E3600000,
+    0xBE4D00EA4800000, 0xBE4D44986C00000, 0xBE4D80EA7C00000,
+    0xBE4DC4992400000, 0xBE4E00EAE000000, 0xBE4E44433E00000,
+    0xBE4E80EC2000000, 0xBE4EC49F4200000, 0xBE4F049F7000000,
+    0xBE4F44A08800000, 0xBE4F807FF800000, 0xBE4FC0801000000,
+    0xBE5000EDE800000, 0xBE5044A1E600000, 0xBE5084A1E400000,
+    0xBE50C4A23200000, 0xBE5104A26600000, 0xBE5140EE3C00000,
+    0xBE5180EE3E00000, 0xBE51C0EE3E00000, 0xBE5200EE9400000,
+    0xBE5240807200000, 0xBE5280EF1600000, 0xBE52C0808C00000,
+    0xBE5300812C00000, 0xBE5344A83A00000, 0xBE5380F09C00000,
+    0xBE53C0F11800000, 0xBE5400F19800000, 0xBE544081C600000,
+    0xBE5484AC4C00000, 0xBE54C0F2AC00000, 0xBE5504AD3400000,
+    0xBE5544AD8A00000, 0xBE5580F31E00000, 0xBE55C0F3D600000,
+    0xBE5600825E00000, 0xBE5640F48000000, 0xBE5680F49400000,
+    0xBE56C0F49E00000, 0xBE5704B2F800000, 0xBE5744B54E00000,
+    0xBE5784B54E00000, 0xBE57C0F5DC00000, 0xBE5800840400000,
+    0xBE5844B75600000, 0xBE5880F78C00000, 0xBE58C0F79200000,
+    0xBE5900844E00000, 0xBE5944B90000000, 0xBE5980F9A400000,
+    0xBE59C0854000000, 0xBE5A00F9D000000, 0xBE5A40F9C600000,
+    0xBE5A80FA0000000, 0xBE5AC4BF0C00000, 0xBE5B00FAC600000,
+    0xBE5B40860200000, 0xBE5B80FB8E00000, 0xBE5BC0FC0400000,
+    0xBE5C00FC8A00000, 0xBE5C40866800000, 0xBE5C84C45000000,
+    0xBE5CC4C48E00000, 0xBE5D0086B200000, 0xBE5D44C5B200000,
+    0xBE5D80FEF400000, 0xBE5DC4C67C00000, 0xBE5E00FF2A00000,
+    0xBE5E40FFF400000, 0xBE5E81000A00000, 0xBE5EC4C9B400000,
+    0xBE5F04CA4600000, 0xBE5F4100C000000, 0xBE5F84CB5000000,
+    0xBE5FC100E000000, 0xBE600466BE00000, 0xBE604087AA00000,
+    0xBE6081016400000, 0xBE60C1020600000, 0xBE6100881600000,
+    0xBE6141027C00000, 0xBE6180B56A00000, 0xBE61C4CF4E00000,
+    0xBE6204CF6A00000, 0xBE6244672600000, 0xBE6284673800000,
+    0xBE62C1040200000, 0xBE6301040800000, 0xBE63411F3C00000,
+    0xBE638088D600000, 0xBE63C1052200000, 0xBE6401051600000,
+    0xBE6441053A00000, 0xBE6480A56600000, 0xBE64C1056200000,
+    0xBE6501056600000, 0xBE6541057A00000, 0xBE658105CC00000,
+    0xBE65C4D67800000, 0xBE660105CA00000, 0xBE6641063A00000,
+    0xBE668106C600000, 0xBE66C1075A00000, 0xBE6701064600000,
+    0xBE6741077A00000, 0xBE678107CE00000, 0xBE67C108AE00000,
+    0xBE680106A600000, 0xBE6841079400000, 0xBE6881079800000,
+    0xBE68C107B800000, 0xBE6904D86C00000, 0xBE6944DAD600000,
+    0xBE6984D9AA00000, 0xBE69C08A5600000, 0xBE6A0109E200000,
+    0xBE6A4109E600000, 0xBE6A810A2C00000, 0xBE6AC4E79400000,
+    0xBE6B010AC800000, 0xBE6B44DE5800000, 0xBE6B808ABA00000,
+    0xBE6BC08AC200000, 0xBE6C04DF6200000, 0xBE6C44E1A400000,
+    0xBE6C808AD600000, 0xBE6CC10CA000000, 0xBE6D010CB800000,
+    0xBE6D410CCE00000, 0xBE6D810CD200000, 0xBE6DC10D5200000,
+    0xBE6E010D1000000, 0xBE6E410E1C00000, 0xBE6E810DC400000,
+    0xBE6EC10EF200000, 0xBE6F010E5000000, 0xBE6F410ED600000,
+    0xBE6F810F0C00000, 0xBE6FC08BAE00000, 0xBE70010FC200000,
+    0xBE7041100200000, 0xBE70808BF200000, 0xBE70C110C000000,
+    0xBE710110C600000, 0xBE7144ECCE00000, 0xBE718111AE00000,
+    0xBE71C111BC00000, 0xBE72008C6A00000, 0xBE724111F400000,
+    0xBE7280697600000, 0xBE72C4F15C00000, 0xBE7304F2CC00000,
+    0xBE73408D7C00000, 0xBE73808D8E00000, 0xBE73C1154000000,
+    0xBE740115DA00000, 0xBE7441171400000, 0xBE748118AA00000,
+    0xBE74C4F95000000, 0xBE7501195600000, 0xBE7541198200000,
+    0xBE75811A3600000, 0xBE75C11AEE00000, 0xBE7604FE5E00000,
+    0xBE7644100800000, 0xBE76811B9600000, 0xBE76C11B7800000,
+    0xBE77011BE000000, 0xBE774411BC00000, 0xBE77811DA800000,
+    0xBE77C11E7000000, 0xBE78050BA400000, 0xBE78450BDA00000,
+    0xBE7881212800000, 0xBE78C121E200000, 0xBE7901222200000,
+    0xBE79450E5C00000, 0xBE7981223600000, 0xBE79C1247000000,
+    0xBE7A0125AE00000, 0xBE7A4125B000000, 0xBE7A8124F800000,
+    0xBE7AC127F200000, 0xBE7B01282A00000, 0xBE7B4517F400000,
+    0xBE7B812B1600000, 0xBE7BC0932A00000, 0xBE7C012B6E00000,
+    0xBE7C451AEE00000, 0xBE7C8093CC00000, 0xBE7CC12D8600000,
+    0xBE7D00BB6400000, 0xBE7D412E4600000, 0xBE7D85228A00000,
+    0xBE7DC5243400000, 0xBE7E0094DC00000, 0xBE7E4094EC00000,
+    0xBE7E812FC000000, 0xBE7EC5281400000, 0xBE7F00956400000,
+    0xBE7F45292C00000, 0xBE7F81301600000, 0xBE7FC1301600000,
+    0xBE8001305200000, 0xBE80452B6C00000, 0xBE808131C400000,
+    0xBE80C0966600000, 0xBE8101325200000, 0xBE8141334E00000,
+    0xBE8181338400000, 0xBE81C133FC00000, 0xBE8200979C00000,
+    0xBE8245366000000, 0xBE8281362400000, 0xBE82C1388000000,
+    0xBE830139FA00000, 0xBE8340999C00000, 0xBE838099DA00000,
+    0xBE83C13ACE00000, 0xBE8405419C00000, 0xBE844099F000000,
+    0xBE8485420A00000, 0xBE84C5441C00000, 0xBE8505452200000,
+    0xBE85413D7600000, 0xBE85809AAC00000, 0xBE85C13DF200000,
+    0xBE86013DFC00000, 0xBE86413E0A00000, 0xBE86813E1E00000,
+    0xBE86C13E2C00000, 0xBE87013E7600000, 0xBE87454C0000000,
+};
+
+// Primary composites, sorted: bits 42-62 hold the first code point
+// of the pair, 21-41 the second and 0-20 the composite.
+static const uint64_t nfc_compose[941] = {
+    0xF0006700226E, 0xF40067002260, 0xF8006700226F,
+    0x10400600000C0, 0x10400602000C1, 0x10400604000C2,
+    0x10400606000C3, 0x1040060800100, 0x1040060C00102,
+    0x1040060E00226, 0x10400610000C4, 0x1040061201EA2,
+    0x10400614000C5, 0x10400618001CD, 0x1040061E00200,
+    0x1040062200202, 0x1040064601EA0, 0x1040064A01E00,
+    0x1040065000104, 0x1080060E01E02, 0x1080064601E04,
+    0x1080066201E06, 0x10C0060200106, 0x10C0060400108,
+    0x10C0060E0010A, 0x10C006180010C, 0x10C0064E000C7,
+    0x1100060E01E0A, 0x110006180010E, 0x1100064601E0C,
+    0x1100064E01E10, 0x1100065A01E12, 0x1100066201E0E,
+    0x11400600000C8, 0x11400602000C9, 0x11400604000CA,
+    0x1140060601EBC, 0x1140060800112, 0x1140060C00114,
+    0x1140060E00116, 0x11400610000CB, 0x1140061201EBA,
+    0x114006180011A, 0x1140061E00204, 0x1140062200206,
+    0x1140064601EB8, 0x1140064E00228, 0x1140065000118,
+    0x1140065A01E18, 0x1140066001E1A, 0x1180060E01E1E,
+    0x11C00602001F4, 0x11C006040011C, 0x11C0060801E20,
+    0x11C0060C0011E, 0x11C0060E00120, 0x11C00618001E6,
+    0x11C0064E00122, 0x1200060400124, 0x1200060E01E22,
+    0x1200061001E26, 0x120006180021E, 0x1200064601E24,
+    0x1200064E01E28, 0x1200065C01E2A, 0x12400600000CC,
+    0x12400602000CD, 0x12400604000CE, 0x1240060600128,
+    0x124006080012A, 0x1240060C0012C, 0x1240060E00130,
+    0x12400610000CF, 0x1240061201EC8, 0x12400618001CF,
+    0x1240061E00208, 0x124006220020A, 0x1240064601ECA,
+    0x124006500012E, 0x1240066001E2C, 0x1280060400134,
+    0x12C0060201E30, 0x12C00618001E8, 0x12C0064601E32,
+    0x12C0064E00136, 0x12C0066201E34, 0x1300060200139,
+    0x130006180013D, 0x1300064601E36, 0x1300064E0013B,
+    0x1300065A01E3C, 0x1300066201E3A, 0x1340060201E3E,
+    0x1340060E01E40, 0x1340064601E42, 0x13800600001F8,
+    0x1380060200143, 0x13800606000D1, 0x1380060E01E44,
+    0x1380061800147, 0x1380064601E46, 0x1380064E00145,
+    0x1380065A01E4A, 0x1380066201E48, 0x13C00600000D2,
+    0x13C00602000D3, 0x13C00604000D4, 0x13C00606000D5,
+    0x13C006080014C, 0x13C0060C0014E, 0x13C0060E0022E,
+    0x13C00610000D6, 0x13C0061201ECE, 0x13C0061600150,
+    0x13C00618001D1, 0x13C0061E0020C, 0x13C006220020E,
+    0x13C00636001A0, 0x13C0064601ECC, 0x13C00650001EA,
+    0x1400060201E54, 0x1400060E01E56, 0x1480060200154,
+    0x1480060E01E58, 0x1480061800158, 0x1480061E00210,
+    0x1480062200212, 0x1480064601E5A, 0x1480064E00156,
+    0x1480066201E5E, 0x14C006020015A, 0x14C006040015C,
+    0x14C0060E01E60, 0x14C0061800160, 0x14C0064601E62,
+    0x14C0064C00218, 0x14C0064E0015E, 0x1500060E01E6A,
+    0x1500061800164, 0x1500064601E6C, 0x1500064C0021A,
+    0x1500064E00162, 0x1500065A01E70, 0x1500066201E6E,
+    0x15400600000D9, 0x15400602000DA, 0x15400604000DB,
+    0x1540060600168, 0x154006080016A, 0x1540060C0016C,
+    0x15400610000DC, 0x1540061201EE6, 0x154006140016E,
+    0x1540061600170, 0x15400618001D3, 0x1540061E00214,
+    0x1540062200216, 0x15400636001AF, 0x1540064601EE4,
+    0x1540064801E72, 0x1540065000172, 0x1540065A01E76,
+    0x1540066001E74, 0x1580060601E7C, 0x1580064601E7E,
+    0x15C0060001E80, 0x15C0060201E82, 0x15C0060400174,
+    0x15C0060E01E86, 0x15C0061001E84, 0x15C0064601E88,
+    0x1600060E01E8A, 0x1600061001E8C, 0x1640060001EF2,
+    0x16400602000DD, 0x1640060400176, 0x1640060601EF8,
+    0x1640060800232, 0x1640060E01E8E, 0x1640061000178,
+    0x1640061201EF6, 0x1640064601EF4, 0x1680060200179,
+    0x1680060401E90, 0x1680060E0017B, 0x168006180017D,
+    0x1680064601E92, 0x1680066201E94, 0x18400600000E0,
+    0x18400602000E1, 0x18400604000E2, 0x18400606000E3,
+    0x1840060800101, 0x1840060C00103, 0x1840060E00227,
+    0x18400610000E4, 0x1840061201EA3, 0x18400614000E5,
+    0x18400618001CE, 0x1840061E00201, 0x1840062200203,
+    0x1840064601EA1, 0x1840064A01E01, 0x1840065000105,
+    0x1880060E01E03, 0x1880064601E05, 0x1880066201E07,
+    0x18C0060200107, 0x18C0060400109, 0x18C0060E0010B,
+    0x18C006180010D, 0x18C0064E000E7, 0x1900060E01E0B,
+    0x190006180010F, 0x1900064601E0D, 0x1900064E01E11,
+    0x1900065A01E13, 0x1900066201E0F, 0x19400600000E8,
+    0x19400602000E9, 0x19400604000EA, 0x1940060601EBD,
+    0x1940060800113, 0x1940060C00115, 0x1940060E00117,
+    0x19400610000EB, 0x1940061201EBB, 0x194006180011B,
+    0x1940061E00205, 0x1940062200207, 0x1940064601EB9,
+    0x1940064E00229, 0x1940065000119, 0x1940065A01E19,
+    0x1940066001E1B, 0x1980060E01E1F, 0x19C00602001F5,
+    0x19C006040011D, 0x19C0060801E21, 0x19C0060C0011F,
+    0x19C0060E00121, 0x19C00618001E7, 0x19C0064E00123,
+    0x1A00060400125, 0x1A00060E01E23, 0x1A00061001E27,
+    0x1A0006180021F, 0x1A00064601E25, 0x1A00064E01E29,
+    0x1A00065C01E2B, 0x1A00066201E96, 0x1A400600000EC,
+    0x1A400602000ED, 0x1A400604000EE, 0x1A40060600129,
+    0x1A4006080012B, 0x1A40060C0012D, 0x1A400610000EF,
+    0x1A40061201EC9, 0x1A400618001D0, 0x1A40061E00209,
+    0x1A4006220020B, 0x1A40064601ECB, 0x1A4006500012F,
+    0x1A40066001E2D, 0x1A80060400135, 0x1A800618001F0,
+    0x1AC0060201E31, 0x1AC00618001E9, 0x1AC0064601E33,
+    0x1AC0064E00137, 0x1AC0066201E35, 0x1B0006020013A,
+    0x1B0006180013E, 0x1B00064601E37, 0x1B00064E0013C,
+    0x1B00065A01E3D, 0x1B00066201E3B, 0x1B40060201E3F,
+    0x1B40060E01E41, 0x1B40064601E43, 0x1B800600001F9,
+    0x1B80060200144, 0x1B800606000F1, 0x1B80060E01E45,
+    0x1B80061800148, 0x1B80064601E47, 0x1B80064E00146,
+    0x1B80065A01E4B, 0x1B80066201E49, 0x1BC00600000F2,
+    0x1BC00602000F3, 0x1BC00604000F4, 0x1BC00606000F5,
+    0x1BC006080014D, 0x1BC0060C0014F, 0x1BC0060E0022F,
+    0x1BC00610000F6, 0x1BC0061201ECF, 0x1BC0061600151,
+    0x1BC00618001D2, 0x1BC0061E0020D, 0x1BC006220020F,
+    0x1BC00636001A1, 0x1BC0064601ECD, 0x1BC00650001EB,
+    0x1C00060201E55, 0x1C00060E01E57, 0x1C80060200155,
+    0x1C80060E01E59, 0x1C80061800159, 0x1C80061E00211,
+    0x1C80062200213, 0x1C80064601E5B, 0x1C80064E00157,
+    0x1C80066201E5F, 0x1CC006020015B, 0x1CC006040015D,
+    0x1CC0060E01E61, 0x1CC0061800161, 0x1CC0064601E63,
+    0x1CC0064C00219, 0x1CC0064E0015F, 0x1D00060E01E6B,
+    0x1D00061001E97, 0x1D00061800165, 0x1D00064601E6D,
+    0x1D00064C0021B, 0x1D00064E00163, 0x1D00065A01E71,
+    0x1D00066201E6F, 0x1D400600000F9, 0x1D400602000FA,
+    0x1D400604000FB, 0x1D40060600169, 0x1D4006080016B,
+    0x1D40060C0016D, 0x1D400610000FC, 0x1D40061201EE7,
+    0x1D4006140016F, 0x1D40061600171, 0x1D400618001D4,
+    0x1D40061E00215, 0x1D40062200217, 0x1D400636001B0,
+    0x1D40064601EE5, 0x1D40064801E73, 0x1D40065000173,
+    0x1D40065A01E77, 0x1D40066001E75, 0x1D80060601E7D,
+    0x1D80064601E7F, 0x1DC0060001E81, 0x1DC0060201E83,
+    0x1DC0060400175, 0x1DC0060E01E87, 0x1DC0061001E85,
+    0x1DC0061401E98, 0x1DC0064601E89, 0x1E00060E01E8B,
+    0x1E00061001E8D, 0x1E40060001EF3, 0x1E400602000FD,
+    0x1E40060400177, 0x1E40060601EF9, 0x1E40060800233,
+    0x1E40060E01E8F, 0x1E400610000FF, 0x1E40061201EF7,
+    0x1E40061401E99, 0x1E40064601EF5, 0x1E8006020017A,
+    0x1E80060401E91, 0x1E80060E0017C, 0x1E8006180017E,
+    0x1E80064601E93, 0x1E80066201E95, 0x2A00060001FED,
+    0x2A00060200385, 0x2A00068401FC1, 0x3080060001EA6,
+    0x3080060201EA4, 0x3080060601EAA, 0x3080061201EA8,
+    0x31000608001DE, 0x31400602001FA, 0x31800602001FC,
+    0x31800608001E2, 0x31C0060201E08, 0x3280060001EC0,
+    0x3280060201EBE, 0x3280060601EC4, 0x3280061201EC2,
+    0x33C0060201E2E, 0x3500060001ED2, 0x3500060201ED0,
+    0x3500060601ED6, 0x3500061201ED4, 0x3540060201E4C,
+    0x354006080022C, 0x3540061001E4E, 0x358006080022A,
+    0x36000602001FE, 0x37000600001DB, 0x37000602001D7,
+    0x37000608001D5, 0x37000618001D9, 0x3880060001EA7,
+    0x3880060201EA5, 0x3880060601EAB, 0x3880061201EA9,
+    0x39000608001DF, 0x39400602001FB, 0x39800602001FD,
+    0x39800608001E3, 0x39C0060201E09, 0x3A80060001EC1,
+    0x3A80060201EBF, 0x3A80060601EC5, 0x3A80061201EC3,
+    0x3BC0060201E2F, 0x3D00060001ED3, 0x3D00060201ED1,
+    0x3D00060601ED7, 0x3D00061201ED5, 0x3D40060201E4D,
+    0x3D4006080022D, 0x3D40061001E4F, 0x3D8006080022B,
+    0x3E000602001FF, 0x3F000600001DC, 0x3F000602001D8,
+    0x3F000608001D6, 0x3F000618001DA, 0x4080060001EB0,
+    0x4080060201EAE, 0x4080060601EB4, 0x4080061201EB2,
+    0x40C0060001EB1, 0x40C0060201EAF, 0x40C0060601EB5,
+    0x40C0061201EB3, 0x4480060001E14, 0x4480060201E16,
+    0x44C0060001E15, 0x44C0060201E17, 0x5300060001E50,
+    0x5300060201E52, 0x5340060001E51, 0x5340060201E53,
+    0x5680060E01E64, 0x56C0060E01E65, 0x5800060E01E66,
+    0x5840060E01E67, 0x5A00060201E78, 0x5A40060201E79,
+    0x5A80061001E7A, 0x5AC0061001E7B, 0x5FC0060E01E9B,
+    0x6800060001EDC, 0x6800060201EDA, 0x6800060601EE0,
+    0x6800061201EDE, 0x6800064601EE2, 0x6840060001EDD,
+    0x6840060201EDB, 0x6840060601EE1, 0x6840061201EDF,
+    0x6840064601EE3, 0x6BC0060001EEA, 0x6BC0060201EE8,
+    0x6BC0060601EEE, 0x6BC0061201EEC, 0x6BC0064601EF0,
+    0x6C00060001EEB, 0x6C00060201EE9, 0x6C00060601EEF,
+    0x6C00061201EED, 0x6C00064601EF1, 0x6DC00618001EE,
+    0x7A800608001EC, 0x7AC00608001ED, 0x89800608001E0,
+    0x89C00608001E1, 0x8A00060C01E1C, 0x8A40060C01E1D,
+    0x8B80060800230, 0x8BC0060800231, 0xA4800618001EF,
+    0xE440060001FBA, 0xE440060200386, 0xE440060801FB9,
+    0xE440060C01FB8, 0xE440062601F08, 0xE440062801F09,
+    0xE440068A01FBC, 0xE540060001FC8, 0xE540060200388,
+    0xE540062601F18, 0xE540062801F19, 0xE5C0060001FCA,
+    0xE5C0060200389, 0xE5C0062601F28, 0xE5C0062801F29,
+    0xE5C0068A01FCC, 0xE640060001FDA, 0xE64006020038A,
+    0xE640060801FD9, 0xE640060C01FD8, 0xE6400610003AA,
+    0xE640062601F38, 0xE640062801F39, 0xE7C0060001FF8,
+    0xE7C006020038C, 0xE7C0062601F48, 0xE7C0062801F49,
+    0xE840062801FEC, 0xE940060001FEA, 0xE94006020038E,
+    0xE940060801FE9, 0xE940060C01FE8, 0xE9400610003AB,
+    0xE940062801F59, 0xEA40060001FFA, 0xEA4006020038F,
+    0xEA40062601F68, 0xEA40062801F69, 0xEA40068A01FFC,
+    0xEB00068A01FB4, 0xEB80068A01FC4, 0xEC40060001F70,
+    0xEC400602003AC, 0xEC40060801FB1, 0xEC40060C01FB0,
+    0xEC40062601F00, 0xEC40062801F01, 0xEC40068401FB6,
+    0xEC40068A01FB3, 0xED40060001F72, 0xED400602003AD,
+    0xED40062601F10, 0xED40062801F11, 0xEDC0060001F74,
+    0xEDC00602003AE, 0xEDC0062601F20, 0xEDC0062801F21,
+    0xEDC0068401FC6, 0xEDC0068A01FC3, 0xEE40060001F76,
+    0xEE400602003AF, 0xEE40060801FD1, 0xEE40060C01FD0,
+    0xEE400610003CA, 0xEE40062601F30, 0xEE40062801F31,
+    0xEE40068401FD6, 0xEFC0060001F78, 0xEFC00602003CC,
+    0xEFC0062601F40, 0xEFC0062801F41, 0xF040062601FE4,
+    0xF040062801FE5, 0xF140060001F7A, 0xF1400602003CD,
+    0xF140060801FE1, 0xF140060C01FE0, 0xF1400610003CB,
+    0xF140062601F50, 0xF140062801F51, 0xF140068401FE6,
+    0xF240060001F7C, 0xF2400602003CE, 0xF240062601F60,
+    0xF240062801F61, 0xF240068401FF6, 0xF240068A01FF3,
+    0xF280060001FD2, 0xF280060200390, 0xF280068401FD7,
+    0xF2C0060001FE2, 0xF2C00602003B0, 0xF2C0068401FE7,
+    0xF380068A01FF4, 0xF4800602003D3, 0xF4800610003D4,
+    0x10180061000407, 0x10400060C004D0, 0x104000610004D2,
+    0x104C0060200403, 0x10540060000400, 0x10540060C004D6,
+    0x10540061000401, 0x10580060C004C1, 0x105800610004DC,
+    0x105C00610004DE, 0x1060006000040D, 0x106000608004E2,
+    0x10600060C00419, 0x106000610004E4, 0x1068006020040C,
+    0x107800610004E6, 0x108C00608004EE, 0x108C0060C0040E,
+    0x108C00610004F0, 0x108C00616004F2, 0x109C00610004F4,
+    0x10AC00610004F8, 0x10B400610004EC, 0x10C00060C004D1,
+    0x10C000610004D3, 0x10CC0060200453, 0x10D40060000450,
+    0x10D40060C004D7, 0x10D40061000451, 0x10D80060C004C2,
+    0x10D800610004DD, 0x10DC00610004DF, 0x10E0006000045D,
+    0x10E000608004E3, 0x10E00060C00439, 0x10E000610004E5,
+    0x10E8006020045C, 0x10F800610004E7, 0x110C00608004EF,
+    0x110C0060C0045E, 0x110C00610004F1, 0x110C00616004F3,
+    0x111C00610004F5, 0x112C00610004F9, 0x113400610004ED,
+    0x11580061000457, 0x11D00061E00476, 0x11D40061E00477,
+    0x136000610004DA, 0x136400610004DB, 0x13A000610004EA,
+    0x13A400610004EB, 0x189C00CA600622, 0x189C00CA800623,
+    0x189C00CAA00625, 0x192000CA800624, 0x192800CA800626,
+    0x1B0400CA8006C2, 0x1B4800CA8006D3, 0x1B5400CA8006C0,
+    0x24A00127800929, 0x24C00127800931, 0x24CC0127800934,
+    0x271C0137C009CB, 0x271C013AE009CC, 0x2D1C0167C00B4B,
+    0x2D1C016AC00B48, 0x2D1C016AE00B4C, 0x2E48017AE00B94,
+    0x2F180177C00BCA, 0x2F18017AE00BCC, 0x2F1C0177C00BCB,
+    0x3118018AC00C48, 0x32FC019AA00CC0, 0x33180198400CCA,
+    0x3318019AA00CC7, 0x3318019AC00CC8, 0x3328019AA00CCB,
+    0x351801A7C00D4A, 0x351801AAE00D4C, 0x351C01A7C00D4B,
+    0x376401B9400DDA, 0x376401B9E00DDC, 0x376401BBE00DDE,
+    0x377001B9400DDD, 0x40940205C01026, 0x6C140366A01B06,
+    0x6C1C0366A01B08, 0x6C240366A01B0A, 0x6C2C0366A01B0C,
+    0x6C340366A01B0E, 0x6C440366A01B12, 0x6CE80366A01B3B,
+    0x6CF00366A01B3D, 0x6CF80366A01B40, 0x6CFC0366A01B41,
+    0x6D080366A01B43, 0x78D80060801E38, 0x78DC0060801E39,
+    0x79680060801E5C, 0x796C0060801E5D, 0x79880060E01E68,
+    0x798C0060E01E69, 0x7A800060401EAC, 0x7A800060C01EB6,
+    0x7A840060401EAD, 0x7A840060C01EB7, 0x7AE00060401EC6,
+    0x7AE40060401EC7, 0x7B300060401ED8, 0x7B340060401ED9,
+    0x7C000060001F02, 0x7C000060201F04, 0x7C000068401F06,
+    0x7C000068A01F80, 0x7C040060001F03, 0x7C040060201F05,
+    0x7C040068401F07, 0x7C040068A01F81, 0x7C080068A01F82,
+    0x7C0C0068A01F83, 0x7C100068A01F84, 0x7C140068A01F85,
+    0x7C180068A01F86, 0x7C1C0068A01F87, 0x7C200060001F0A,
+    0x7C200060201F0C, 0x7C200068401F0E, 0x7C200068A01F88,
+    0x7C240060001F0B, 0x7C240060201F0D, 0x7C240068401F0F,
+    0x7C240068A01F89, 0x7C280068A01F8A, 0x7C2C0068A01F8B,
+    0x7C300068A01F8C, 0x7C340068A01F8D, 0x7C380068A01F8E,
+    0x7C3C0068A01F8F, 0x7C400060001F12, 0x7C400060201F14,
+    0x7C440060001F13, 0x7C440060201F15, 0x7C600060001F1A,
+    0x7C600060201F1C, 0x7C640060001F1B, 0x7C640060201F1D,
+    0x7C800060001F22, 0x7C800060201F24, 0x7C800068401F26,
+    0x7C800068A01F90, 0x7C840060001F23, 0x7C840060201F25,
+    0x7C840068401F27, 0x7C840068A01F91, 0x7C880068A01F92,
+    0x7C8C0068A01F93, 0x7C900068A01F94, 0x7C940068A01F95,
+    0x7C980068A01F96, 0x7C9C0068A01F97, 0x7CA00060001F2A,
+    0x7CA00060201F2C, 0x7CA00068401F2E, 0x7CA00068A01F98,
+    0x7CA40060001F2B, 0x7CA40060201F2D, 0x7CA40068401F2F,
+    0x7CA40068A01F99, 0x7CA80068A01F9A, 0x7CAC0068A01F9B,
+    0x7CB00068A01F9C, 0x7CB40068A01F9D, 0x7CB80068A01F9E,
+    0x7CBC0068A01F9F, 0x7CC00060001F32, 0x7CC00060201F34,
+    0x7CC00068401F36, 0x7CC40060001F33, 0x7CC40060201F35,
+    0x7CC40068401F37, 0x7CE00060001F3A, 0x7CE00060201F3C,
+    0x7CE00068401F3E, 0x7CE40060001F3B, 0x7CE40060201F3D,
+    0x7CE40068401F3F, 0x7D000060001F42, 0x7D000060201F44,
+    0x7D040060001F43, 0x7D040060201F45, 0x7D200060001F4A,
+    0x7D200060201F4C, 0x7D240060001F4B, 0x7D240060201F4D,
+    0x7D400060001F52, 0x7D400060201F54, 0x7D400068401F56,
+    0x7D440060001F53, 0x7D440060201F55, 0x7D440068401F57,
+    0x7D640060001F5B, 0x7D640060201F5D, 0x7D640068401F5F,
+    0x7D800060001F62, 0x7D800060201F64, 0x7D800068401F66,
+    0x7D800068A01FA0, 0x7D840060001F63, 0x7D840060201F65,
+    0x7D840068401F67, 0x7D840068A01FA1, 0x7D880068A01FA2,
+    0x7D8C0068A01FA3, 0x7D900068A01FA4, 0x7D940068A01FA5,
+    0x7D980068A01FA6, 0x7D9C0068A01FA7, 0x7DA00060001F6A,
+    0x7DA00060201F6C, 0x7DA00068401F6E, 0x7DA00068A01FA8,
+    0x7DA40060001F6B, 0x7DA40060201F6D, 0x7DA40068401F6F,
+    0x7DA40068A01FA9, 0x7DA80068A01FAA, 0x7DAC0068A01FAB,
+    0x7DB00068A01FAC, 0x7DB40068A01FAD, 0x7DB80068A01FAE,
+    0x7DBC0068A01FAF, 0x7DC00068A01FB2, 0x7DD00068A01FC2,
+    0x7DF00068A01FF2, 0x7ED80068A01FB7, 0x7EFC0060001FCD,
+    0x7EFC0060201FCE, 0x7EFC0068401FCF, 0x7F180068A01FC7,
+    0x7FD80068A01FF7, 0x7FF80060001FDD, 0x7FF80060201FDE,
+    0x7FF80068401FDF, 0x8640006700219A, 0x8648006700219B,
+    0x865000670021AE, 0x874000670021CD, 0x874800670021CF,
+    0x875000670021CE, 0x880C0067002204, 0x88200067002209,
+    0x882C006700220C, 0x888C0067002224, 0x88940067002226,
+    0x88F00067002241, 0x890C0067002244, 0x89140067002247,
+    0x89200067002249, 0x8934006700226D, 0x89840067002262,
+    0x89900067002270, 0x89940067002271, 0x89C80067002274,
+    0x89CC0067002275, 0x89D80067002278, 0x89DC0067002279,
+    0x89E80067002280, 0x89EC0067002281, 0x89F000670022E0,
+    0x89F400670022E1, 0x8A080067002284, 0x8A0C0067002285,
+    0x8A180067002288, 0x8A1C0067002289, 0x8A4400670022E2,
+    0x8A4800670022E3, 0x8A8800670022AC, 0x8AA000670022AD,
+    0x8AA400670022AE, 0x8AAC00670022AF, 0x8AC800670022EA,
+    0x8ACC00670022EB, 0x8AD000670022EC, 0x8AD400670022ED,
+    0xC1180613203094, 0xC12C061320304C, 0xC134061320304E,
+    0xC13C0613203050, 0xC1440613203052, 0xC14C0613203054,
+    0xC1540613203056, 0xC15C0613203058, 0xC164061320305A,
+    0xC16C061320305C, 0xC174061320305E, 0xC17C0613203060,
+    0xC1840613203062, 0xC1900613203065, 0xC1980613203067,
+    0xC1A00613203069, 0xC1BC0613203070, 0xC1BC0613403071,
+    0xC1C80613203073, 0xC1C80613403074, 0xC1D40613203076,
+    0xC1D40613403077, 0xC1E00613203079, 0xC1E0061340307A,
+    0xC1EC061320307C, 0xC1EC061340307D, 0xC274061320309E,
+    0xC29806132030F4, 0xC2AC06132030AC, 0xC2B406132030AE,
+    0xC2BC06132030B0, 0xC2C406132030B2, 0xC2CC06132030B4,
+    0xC2D406132030B6, 0xC2DC06132030B8, 0xC2E406132030BA,
+    0xC2EC06132030BC, 0xC2F406132030BE, 0xC2FC06132030C0,
+    0xC30406132030C2, 0xC31006132030C5, 0xC31806132030C7,
+    0xC32006132030C9, 0xC33C06132030D0, 0xC33C06134030D1,
+    0xC34806132030D3, 0xC34806134030D4, 0xC35406132030D6,
+    0xC35406134030D7, 0xC36006132030D9, 0xC36006134030DA,
+    0xC36C06132030DC, 0xC36C06134030DD, 0xC3BC06132030F7,
+    0xC3C006132030F8, 0xC3C406132030F9, 0xC3C806132030FA,
+    0xC3F406132030FE, 0x44264221741109A, 0x4426C221741109C,
+    0x4429422174110AB, 0x444C42224E1112E, 0x444C82224E1112F,
+    0x44D1C2267C1134B, 0x44D1C226AE1134C, 0x452E422960114BC,
+    0x452E422974114BB, 0x452E42297A114BE, 0x456E022B5E115BA,
+    0x456E422B5E115BB, 0x464D42326011938,
+};
+
+#endif // MU_STRING_UTF8_TABLES_H
@@ -0,0 +1,273 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file bench_mu_string.c
+ *
+ * @brief Throughput benchmark for the mu_string scanning functions.
+ *
+ * `make bench` builds this twice, with MU_STRING_SWAR set to 0 and to 1, and
+ * runs both so the byte loops and the word-at-a-time loops can be compared.
+ * Auto-vectorization is disabled to match a build without SIMD.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_string.h"
+#include "mu_string_parse.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define BUF_LEN (64 * 1024)
+#define MIN_SECONDS 0.2
+
+#define SHORT_VIEWS 64 // views per call in the short-string cases
+#define URL_COUNT 4096 // keys in the sorted URL table
+#define URL_LEN 38     // "https://example.com/api/v1/items/" + 5 digits
+#define ADDR_COUNT 64  // dotted quads per call in the IPv4 case
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+// *****************************************************************************
+// Private (static) storage
+
+static char s_buf[BUF_LEN];
+static char s_copy[BUF_LEN];
+static char s_out[BUF_LEN];
+static uint8_t s_upper[256];
+static volatile size_t s_sink;
+static char s_url_buf[URL_COUNT][URL_LEN + 1];
+static mu_string_t s_urls[URL_COUNT];
+static char s_addr_buf[ADDR_COUNT][24];
+static mu_string_t s_addrs[ADDR_COUNT];
+static size_t s_addr_bytes;
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static size_t run_find_char(void);
+static size_t run_rfind_char(void);
+static size_t run_count_char(void);
+static size_t run_find_any(void);
+static size_t run_eq_nocase(void);
+static size_t run_eq_nocase_short(void);
+static size_t run_eq_short(void);
+static size_t run_cmp_short(void);
+static size_t run_lower_bound(void);
+static size_t run_remove_ctrl(void);
+static size_t run_translate(void);
+static size_t run_bsearch_cmp(void);
+static size_t run_parse_ipv4(void);
+
+/**
+ * @brief Runs `fn` repeatedly for at least MIN_SECONDS and prints the bytes
+ * it scans per second.
+ */
+static size_t run_eq_short(void) {
+    // The letter pattern repeats every 26 bytes, so these views are equal.
+    size_t n = 0;
+    for (size_t i = 0; i < SHORT_VIEWS; i++) {
+        mu_string_t a = { .buf = &s_buf[1 + i * 16], .len = 16 };
+        mu_string_t b = { .buf = &s_buf[1 + i * 16 + 26 * 40], .len = 16 };
+        n += mu_string_eq(a, b);
+    }
+    return n;
+}
+
+static size_t run_cmp_short(void) {
+    size_t n = 0;
+    for (size_t i = 0; i < SHORT_VIEWS; i++) {
+        mu_string_t a = { .buf = &s_buf[1 + i * 16], .len = 16 };
+        mu_string_t b = { .buf = &s_buf[1 + i * 16 + 26 * 40], .len = 16 };
+        n += (size_t)mu_string_cmp(a, b);
+    }
+    return n;
+}
+
+static size_t run_remove_ctrl(void) {
+    static const char ctrl[] = "\x01\x02\x03\x04\x05\x06\x07\x08\t\n\x0b"
+                               "\x0c\r\x0e\x0f\x10\x11\x12\x13\x14\x15\x16"
+                               "\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f";
+    mu_string_t s = { .buf = s_buf, .len = BUF_LEN };
+    mu_string_mut_t dst = { .buf = s_out, .len = BUF_LEN };
+    return mu_string_remove_set(dst, s, MU_STR_LITERAL(ctrl)).len;
+}
+
+static size_t run_translate(void) {
+    mu_string_t s = { .buf = s_buf, .len = BUF_LEN };
+    mu_string_mut_t dst = { .buf = s_out, .len = BUF_LEN };
+    return mu_string_translate(dst, s, s_upper).len;
+}
+
+static size_t run_lower_bound(void) {
+    size_t n = 0;
+    for (size_t i = 0; i < SHORT_VIEWS; i++) {
+        n += mu_string_lower_bound(s_urls, URL_COUNT, s_urls[i * 61]);
+    }
+    return n;
+}
+
+static size_t run_bsearch_cmp(void) {
+    // The same search without prefix skipping, for comparison.
+    size_t n = 0;
+    for (size_t i = 0; i < SHORT_VIEWS; i++) {
+        size_t lo = 0;
+        size_t hi = URL_COUNT;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (mu_string_cmp(s_urls[mid], s_urls[i * 61]) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        n += lo;
+    }
+    return n;
+}
+
+static size_t run_parse_ipv4(void) {
+    // mu_string_parse_ipv4() has no word-at-a-time path, so this case
+    // measures the same code in both builds.
+    uint8_t addr[4];
+    size_t n = 0;
+    for (size_t i = 0; i < ADDR_COUNT; i++) {
+        n += mu_string_parse_ipv4(s_addrs[i], addr, NULL) ? addr[3] : 0;
+    }
+    return n;
+}
+
+static void report(const char *name, size_t (*fn)(void), size_t bytes_per_call);
+
+// *****************************************************************************
+// Public code
+
+int main(void) {
+    // Letters, with a '^' at the very start and a '\n' at the very end.
+    for (size_t i = 0; i < BUF_LEN; i++) {
+        s_buf[i] = (char)('a' + (i * 7) % 26);
+    }
+    s_buf[0] = '^';
+    s_buf[BUF_LEN - 1] = '\n';
+    memcpy(s_copy, s_buf, BUF_LEN);
+    for (size_t i = 1; i < BUF_LEN - 1; i += 3) {
+        s_copy[i] = (char)(s_copy[i] - ('a' - 'A')); // same, ignoring case
+    }
+
+    // A sorted table of URLs that differ only in their last few bytes.
+    for (size_t i = 0; i < URL_COUNT; i++) {
+        snprintf(s_url_buf[i], sizeof(s_url_buf[i]),
+                 "https://example.com/api/v1/items/%05zu", i * 7);
+        s_urls[i] = (mu_string_t){ .buf = s_url_buf[i], .len = URL_LEN };
+    }
+
+    // Dotted quads of mixed lengths, each followed by a port.
+    for (size_t i = 0; i < ADDR_COUNT; i++) {
+        int n = snprintf(s_addr_buf[i], sizeof(s_addr_buf[i]),
+                         "%zu.%zu.%zu.%zu:8080", (i * 97) % 256,
+                         (i * 31) % 256, (i * 13) % 100, i % 10);
+        s_addrs[i] = (mu_string_t){ .buf = s_addr_buf[i], .len = (size_t)n };
+        s_addr_bytes += (size_t)n;
+    }
+
+    for (int c = 0; c < 256; c++) {
+        s_upper[c] = (uint8_t)((c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c);
+    }
+
+    printf("MU_STRING_SWAR=%d\n", MU_STRING_SWAR);
+    report("find_char", run_find_char, BUF_LEN);
+    report("rfind_char", run_rfind_char, BUF_LEN);
+    report("count_char", run_count_char, BUF_LEN);
+    report("find_any (3 chars)", run_find_any, BUF_LEN);
+    report("eq_nocase (64 KiB)", run_eq_nocase, BUF_LEN);
+    report("eq_nocase (24 B)", run_eq_nocase_short, SHORT_VIEWS * 24);
+    report("eq (16 B)", run_eq_short, SHORT_VIEWS * 16);
+    report("cmp (16 B)", run_cmp_short, SHORT_VIEWS * 16);
+    report("remove_set (ctrl)", run_remove_ctrl, BUF_LEN);
+    report("translate (upper)", run_translate, BUF_LEN);
+    report("lower_bound (URLs)", run_lower_bound, SHORT_VIEWS * URL_LEN);
+    report("bsearch+cmp (URLs)", run_bsearch_cmp, SHORT_VIEWS * URL_LEN);
+    report("parse_ipv4", run_parse_ipv4, s_addr_bytes);
+    return 0;
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t run_find_char(void) {
+    mu_string_t s = { .buf = s_buf, .len = BUF_LEN };
+    return mu_string_find_char(s, '\n').len;
+}
+
+static size_t run_rfind_char(void) {
+    mu_string_t s = { .buf = s_buf, .len = BUF_LEN };
+    return mu_string_rfind_char(s, '^').len;
+}
+
+static size_t run_count_char(void) {
+    mu_string_t s = { .buf = s_buf, .len = BUF_LEN };
+    return mu_string_count_char(s, 'e');
+}
+
+static size_t run_find_any(void) {
+    mu_string_t s = { .buf = s_buf, .len = BUF_LEN };
+    return mu_string_find_any(s, MU_STR_LITERAL("|#\n")).len;
+}
+
+static size_t run_eq_nocase(void) {
+    mu_string_t a = { .buf = s_buf, .len = BUF_LEN };
+    mu_string_t b = { .buf = s_copy, .len = BUF_LEN };
+    return mu_string_eq_nocase(a, b);
+}
+
+static size_t run_eq_nocase_short(void) {
+    size_t n = 0;
+    for (size_t i = 0; i < SHORT_VIEWS; i++) {
+        mu_string_t a = { .buf = &s_buf[i * 24], .len = 24 };
+        mu_string_t b = { .buf = &s_copy[i * 24], .len = 24 };
+        n += mu_string_eq_nocase(a, b);
+    }
+    return n;
+}
+
+static void report(const char *name, size_t (*fn)(void), size_t bytes_per_call) {
+    size_t calls = 0;
+    clock_t start = clock();
+    double seconds;
+    do {
+        for (int k = 0; k < 100; k++) {
+            s_sink += fn();
+        }
+        calls += 100;
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    } while (seconds < MIN_SECONDS);
+    printf("  %-20s %8.0f MB/s\n", name,
+           (double)calls * (double)bytes_per_call / seconds / 1e6);
+}
@@ -0,0 +1,208 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_csv.c
+ *
+ * @brief Unit tests for the mu_csv module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_csv.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define MAX_FIELDS 8
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_csv_reader_t s_reader;
+static mu_string_t s_fields[MAX_FIELDS];
+static size_t s_n_fields;
+static char s_scratch[64];
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_reader, 0, sizeof(s_reader));
+    memset(s_fields, 0, sizeof(s_fields));
+    s_n_fields = 0;
+}
+
+void tearDown(void) {}
+
+void test_mu_csv_reader_init(void) {
+    TEST_ASSERT_EQUAL_PTR(&s_reader, mu_csv_reader_init(&s_reader, MU_STR_LITERAL("a"), ',', '"'));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("a"), mu_csv_remaining(&s_reader)));
+    TEST_ASSERT_NULL(mu_csv_reader_init(NULL, MU_STR_LITERAL("a"), ',', '"'));
+    TEST_ASSERT_NULL(mu_csv_reader_init(&s_reader, MU_STRING_INVALID, ',', '"'));
+}
+
+void test_mu_csv_read_simple(void) {
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL("a,bb,ccc\n1,2,3\r\nx"), ',', '"');
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(3, s_n_fields);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("a"), s_fields[0]));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("bb"), s_fields[1]));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("ccc"), s_fields[2]));
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(3, s_n_fields);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("3"), s_fields[2]));
+
+    // Final record without a terminator
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(1, s_n_fields);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("x"), s_fields[0]));
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_END, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(0, s_n_fields);
+}
+
+void test_mu_csv_read_empty_fields(void) {
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL(",,\n\n"), ',', '"');
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(3, s_n_fields);
+    TEST_ASSERT_EQUAL_size_t(0, s_fields[0].len);
+    TEST_ASSERT_EQUAL_size_t(0, s_fields[2].len);
+
+    // Empty line is a record with one empty field
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(1, s_n_fields);
+    TEST_ASSERT_EQUAL_size_t(0, s_fields[0].len);
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_END, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+}
+
+void test_mu_csv_read_quoted(void) {
+    const char *input = "\"a,b\",\"say \"\"hi\"\"\",\"line\nbreak\",\"\"\r\n";
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL(input), ',', '"');
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(4, s_n_fields);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("a,b"), s_fields[0]));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("say \"\"hi\"\""), s_fields[1]));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("line\nbreak"), s_fields[2]));
+    TEST_ASSERT_EQUAL_size_t(0, s_fields[3].len);
+
+    // Field views point into the original input
+    TEST_ASSERT_EQUAL_PTR(input + 1, s_fields[0].buf);
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_END, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+}
+
+void test_mu_csv_unescape(void) {
+    mu_string_mut_t dst = mu_string_mut_from_buf(s_scratch, sizeof(s_scratch));
+    mu_csv_reader_init(&s_reader, MU_STRING_EMPTY, ',', '"');
+
+    // No quotes: returned unchanged, no copy
+    mu_string_t plain = MU_STR_LITERAL("plain");
+    TEST_ASSERT_FALSE(mu_csv_needs_unescape(&s_reader, plain));
+    mu_string_t result = mu_csv_unescape(&s_reader, dst, plain);
+    TEST_ASSERT_EQUAL_PTR(plain.buf, result.buf);
+    TEST_ASSERT_EQUAL_size_t(plain.len, result.len);
+
+    mu_string_t escaped = MU_STR_LITERAL("say \"\"hi\"\"!");
+    TEST_ASSERT_TRUE(mu_csv_needs_unescape(&s_reader, escaped));
+    result = mu_csv_unescape(&s_reader, dst, escaped);
+    TEST_ASSERT_EQUAL_PTR(s_scratch, result.buf);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("say \"hi\"!"), result));
+
+    result = mu_csv_unescape(&s_reader, dst, MU_STR_LITERAL("\"\"\"\""));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("\"\""), result));
+
+    // Destination too small
+    mu_string_mut_t tiny = mu_string_mut_from_buf(s_scratch, 3);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, mu_csv_unescape(&s_reader, tiny, escaped)));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, mu_csv_unescape(&s_reader, MU_STRING_MUT_EMPTY, escaped)));
+}
+
+void test_mu_csv_read_errors(void) {
+    mu_string_t input = MU_STR_LITERAL("ok\n\"open,field\n");
+    mu_csv_reader_init(&s_reader, input, ',', '"');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_UNTERMINATED, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    // Reader stays at the offending record
+    TEST_ASSERT_EQUAL_PTR(input.buf + 3, mu_csv_remaining(&s_reader).buf);
+
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL("\"a\"b,c\n"), ',', '"');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_SYNTAX, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+
+    // A quote inside an unquoted field is rejected rather than being
+    // collapsed later by mu_csv_unescape().
+    input = MU_STR_LITERAL("x,a\"\"b\n");
+    mu_csv_reader_init(&s_reader, input, ',', '"');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_SYNTAX, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_PTR(input.buf, mu_csv_remaining(&s_reader).buf);
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL("a\"\n"), ',', '"');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_SYNTAX, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL("1,2,3\n4\n"), ',', '"');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_TOO_MANY_FIELDS, mu_csv_read_record(&s_reader, s_fields, 2, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(3, s_n_fields);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("2"), s_fields[1]));
+    // The oversize record was consumed
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, 2, &s_n_fields));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("4"), s_fields[0]));
+
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_INVALID, mu_csv_read_record(NULL, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_INVALID, mu_csv_read_record(&s_reader, NULL, MAX_FIELDS, &s_n_fields));
+}
+
+void test_mu_csv_custom_delimiter(void) {
+    mu_csv_reader_init(&s_reader, MU_STR_LITERAL("a;'b;c';d"), ';', '\'');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE, mu_csv_read_record(&s_reader, s_fields, MAX_FIELDS, &s_n_fields));
+    TEST_ASSERT_EQUAL_size_t(3, s_n_fields);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("b;c"), s_fields[1]));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("d"), s_fields[2]));
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_csv.c");
+
+    RUN_TEST(test_mu_csv_reader_init);
+    RUN_TEST(test_mu_csv_read_simple);
+    RUN_TEST(test_mu_csv_read_empty_fields);
+    RUN_TEST(test_mu_csv_read_quoted);
+    RUN_TEST(test_mu_csv_unescape);
+    RUN_TEST(test_mu_csv_read_errors);
+    RUN_TEST(test_mu_csv_custom_delimiter);
+
+    return UnityEnd();
+}
@@ -0,0 +1,161 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_http.c
+ *
+ * @brief Unit tests for the mu_http module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_http.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define MAX_HEADERS 8
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_http_request_t s_req;
+static mu_http_header_t s_headers[MAX_HEADERS];
+
+static const char *s_get_request =
+    "GET /index.html?q=1 HTTP/1.1\r\n"
+    "Host: example.com\r\n"
+    "User-Agent:   curl/8.0  \r\n"
+    "Accept:*/*\r\n"
+    "X-Empty:\r\n"
+    "\r\n"
+    "body";
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    mu_http_request_init(&s_req, s_headers, MAX_HEADERS);
+}
+
+void tearDown(void) {}
+
+void test_mu_http_parse_request(void) {
+    mu_string_t input = MU_STR_LITERAL(s_get_request);
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_NONE, mu_http_parse_request(&s_req, input, 0));
+
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("GET"), s_req.method));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("/index.html?q=1"), s_req.target));
+    TEST_ASSERT_EQUAL_INT(1, s_req.minor_version);
+    TEST_ASSERT_EQUAL_size_t(4, s_req.n_headers);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("Host"), s_headers[0].name));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("example.com"), s_headers[0].value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("curl/8.0"), s_headers[1].value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("*/*"), s_headers[2].value));
+    TEST_ASSERT_EQUAL_size_t(0, s_headers[3].value.len);
+
+    // Body begins right after the header block
+    TEST_ASSERT_EQUAL_STRING("body", s_get_request + s_req.header_len);
+}
+
+void test_mu_http_parse_bare_lf(void) {
+    mu_string_t input = MU_STR_LITERAL("\r\nPOST /x HTTP/1.0\nA: b\n\n");
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_NONE, mu_http_parse_request(&s_req, input, 0));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("POST"), s_req.method));
+    TEST_ASSERT_EQUAL_INT(0, s_req.minor_version);
+    TEST_ASSERT_EQUAL_size_t(1, s_req.n_headers);
+    TEST_ASSERT_EQUAL_size_t(input.len, s_req.header_len);
+}
+
+void test_mu_http_parse_incremental(void) {
+    size_t total = strlen(s_get_request);
+    size_t prev_len = 0;
+    mu_http_err_t err = MU_HTTP_ERR_INCOMPLETE;
+
+    // Feed the request three bytes at a time
+    for (size_t len = 3; len <= total; len += 3) {
+        err = mu_http_parse_request(&s_req, mu_string_from_buf(s_get_request, len), prev_len);
+        if (err != MU_HTTP_ERR_INCOMPLETE) {
+            break;
+        }
+        prev_len = len;
+    }
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_NONE, err);
+    TEST_ASSERT_EQUAL_size_t(4, s_req.n_headers);
+    TEST_ASSERT_EQUAL_size_t(total - strlen("body"), s_req.header_len);
+
+    // Terminator split exactly across two reads
+    const char *req = "GET / HTTP/1.1\r\n\r\n";
+    size_t n = strlen(req);
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_INCOMPLETE, mu_http_parse_request(&s_req, mu_string_from_buf(req, n - 1), 0));
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_NONE, mu_http_parse_request(&s_req, mu_string_from_buf(req, n), n - 1));
+    TEST_ASSERT_EQUAL_size_t(0, s_req.n_headers);
+}
+
+void test_mu_http_parse_errors(void) {
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_SYNTAX, mu_http_parse_request(&s_req, MU_STR_LITERAL("GET /\r\n\r\n"), 0));
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_SYNTAX, mu_http_parse_request(&s_req, MU_STR_LITERAL("GET / HTTP/2.0\r\n\r\n"), 0));
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_SYNTAX, mu_http_parse_request(&s_req, MU_STR_LITERAL("GET / HTTP/1.1\r\nBad Name: x\r\n\r\n"), 0));
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_SYNTAX, mu_http_parse_request(&s_req, MU_STR_LITERAL("GET / HTTP/1.1\r\nA: x\r\n folded\r\n\r\n"), 0));
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_SYNTAX, mu_http_parse_request(&s_req, MU_STR_LITERAL("GET / HTTP/1.1\r\nA: x\001y\r\n\r\n"), 0));
+
+    mu_http_request_init(&s_req, s_headers, 1);
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_TOO_MANY_HEADERS, mu_http_parse_request(&s_req, MU_STR_LITERAL(s_get_request), 0));
+
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_INVALID, mu_http_parse_request(NULL, MU_STR_LITERAL(s_get_request), 0));
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_INVALID, mu_http_parse_request(&s_req, MU_STRING_INVALID, 0));
+}
+
+void test_mu_http_find_header(void) {
+    TEST_ASSERT_EQUAL(MU_HTTP_ERR_NONE, mu_http_parse_request(&s_req, MU_STR_LITERAL(s_get_request), 0));
+
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("example.com"), mu_http_find_header(&s_req, MU_STR_LITERAL("host"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("curl/8.0"), mu_http_find_header(&s_req, MU_STR_LITERAL("USER-AGENT"))));
+    TEST_ASSERT_NULL(mu_http_find_header(&s_req, MU_STR_LITERAL("Cookie")).buf);
+
+    TEST_ASSERT_TRUE(mu_http_name_eq(MU_STR_LITERAL("Content-Length"), MU_STR_LITERAL("content-length")));
+    TEST_ASSERT_FALSE(mu_http_name_eq(MU_STR_LITERAL("Content-Length"), MU_STR_LITERAL("Content-Type")));
+    TEST_ASSERT_FALSE(mu_http_name_eq(MU_STR_LITERAL("a"), MU_STRING_INVALID));
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_http.c");
+
+    RUN_TEST(test_mu_http_parse_request);
+    RUN_TEST(test_mu_http_parse_bare_lf);
+    RUN_TEST(test_mu_http_parse_incremental);
+    RUN_TEST(test_mu_http_parse_errors);
+    RUN_TEST(test_mu_http_find_header);
+
+    return UnityEnd();
+}
@@ -0,0 +1,202 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_json.c
+ *
+ * @brief Unit tests for the mu_json module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_json.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define MAX_TOKENS 32
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_json_token_t s_tape[MAX_TOKENS];
+static size_t s_n_tokens;
+static char s_scratch[32];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static mu_json_err_t tokenize(const char *json);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(s_tape, 0, sizeof(s_tape));
+    s_n_tokens = 0;
+}
+
+void tearDown(void) {}
+
+void test_mu_json_tokenize_scalars(void) {
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize(" 42 "));
+    TEST_ASSERT_EQUAL_size_t(1, s_n_tokens);
+    TEST_ASSERT_EQUAL(MU_JSON_NUMBER, s_tape[0].kind);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("42"), s_tape[0].span));
+
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("-0.5e+10"));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("-0.5e+10"), s_tape[0].span));
+
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("\"a\\\"b\""));
+    TEST_ASSERT_EQUAL(MU_JSON_STRING, s_tape[0].kind);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("a\\\"b"), s_tape[0].span));
+
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("true"));
+    TEST_ASSERT_EQUAL(MU_JSON_TRUE, s_tape[0].kind);
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("false"));
+    TEST_ASSERT_EQUAL(MU_JSON_FALSE, s_tape[0].kind);
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("null"));
+    TEST_ASSERT_EQUAL(MU_JSON_NULL, s_tape[0].kind);
+}
+
+void test_mu_json_tokenize_nested(void) {
+    const char *json = "{\"a\": [1, {\"b\": null}], \"c\": \"d\"}";
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize(json));
+    // { a [ 1 { b null } ] c d }
+    TEST_ASSERT_EQUAL_size_t(12, s_n_tokens);
+    TEST_ASSERT_EQUAL(MU_JSON_OBJECT_START, s_tape[0].kind);
+    TEST_ASSERT_EQUAL_size_t(11, s_tape[0].link);
+    TEST_ASSERT_EQUAL_size_t(0, s_tape[11].link);
+    TEST_ASSERT_EQUAL(MU_JSON_KEY, s_tape[1].kind);
+    TEST_ASSERT_EQUAL(MU_JSON_ARRAY_START, s_tape[2].kind);
+    TEST_ASSERT_EQUAL_size_t(8, s_tape[2].link);
+    TEST_ASSERT_EQUAL(MU_JSON_ARRAY_END, s_tape[8].kind);
+    TEST_ASSERT_EQUAL(MU_JSON_OBJECT_START, s_tape[4].kind);
+    TEST_ASSERT_EQUAL_size_t(7, s_tape[4].link);
+
+    // Container spans cover the whole container
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(json), s_tape[0].span));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("[1, {\"b\": null}]"), s_tape[2].span));
+
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("[]"));
+    TEST_ASSERT_EQUAL_size_t(2, s_n_tokens);
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE, tokenize("{ }"));
+    TEST_ASSERT_EQUAL_size_t(2, s_n_tokens);
+}
+
+void test_mu_json_tokenize_errors(void) {
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("[1,]"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("{\"a\" 1}"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("{1: 2}"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("[1}"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("01"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("1 2"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("\"\\x\""));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("\"a\nb\""));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_SYNTAX, tokenize("nul!"));
+
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INCOMPLETE, tokenize(""));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INCOMPLETE, tokenize("{\"a\": [1"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INCOMPLETE, tokenize("\"abc"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INCOMPLETE, tokenize("tru"));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INCOMPLETE, tokenize("1e"));
+
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_TOO_MANY_TOKENS,
+                      mu_json_tokenize(MU_STR_LITERAL("[1,2,3]"), s_tape, 3, &s_n_tokens));
+    TEST_ASSERT_EQUAL_size_t(3, s_n_tokens);
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INVALID,
+                      mu_json_tokenize(MU_STRING_INVALID, s_tape, MAX_TOKENS, &s_n_tokens));
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_INVALID,
+                      mu_json_tokenize(MU_STR_LITERAL("1"), NULL, MAX_TOKENS, &s_n_tokens));
+}
+
+void test_mu_json_find_key(void) {
+    TEST_ASSERT_EQUAL(MU_JSON_ERR_NONE,
+                      tokenize("{\"skip\": {\"id\": 1, \"x\": [2]}, \"id\": 7, \"name\": \"bob\"}"));
+
+    size_t idx = mu_json_find_key(s_tape, s_n_tokens, 0, MU_STR_LITERAL("id"));
+    TEST_ASSERT_NOT_EQUAL(MU_JSON_NOT_FOUND, idx);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("7"), s_tape[idx].span));
+
+    idx = mu_json_find_key(s_tape, s_n_tokens, 0, MU_STR_LITERAL("name"));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("bob"), s_tape[idx].span));
+
+    size_t skip = mu_json_find_key(s_tape, s_n_tokens, 0, MU_STR_LITERAL("skip"));
+    idx = mu_json_find_key(s_tape, s_n_tokens, skip, MU_STR_LITERAL("id"));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("1"), s_tape[idx].span));
+
+    TEST_ASSERT_EQUAL(MU_JSON_NOT_FOUND, mu_json_find_key(s_tape, s_n_tokens, 0, MU_STR_LITERAL("zzz")));
+    TEST_ASSERT_EQUAL(MU_JSON_NOT_FOUND, mu_json_find_key(s_tape, s_n_tokens, 1, MU_STR_LITERAL("id")));
+
+    // mu_json_next steps over the nested object
+    TEST_ASSERT_EQUAL_size_t(s_tape[skip].link + 1, mu_json_next(s_tape, s_n_tokens, skip));
+    TEST_ASSERT_EQUAL(MU_JSON_NOT_FOUND, mu_json_next(s_tape, s_n_tokens, s_tape[0].link));
+}
+
+void test_mu_json_unescape(void) {
+    mu_string_mut_t dst = mu_string_mut_from_buf(s_scratch, sizeof(s_scratch));
+
+    mu_string_t plain = MU_STR_LITERAL("plain");
+    mu_string_t result = mu_json_unescape(dst, plain);
+    TEST_ASSERT_EQUAL_PTR(plain.buf, result.buf);
+
+    result = mu_json_unescape(dst, MU_STR_LITERAL("a\\n\\\"b\\\\"));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("a\n\"b\\"), result));
+
+    result = mu_json_unescape(dst, MU_STR_LITERAL("\\u00e9\\u20AC\\ud83d\\ude00"));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80"), result));
+
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, mu_json_unescape(dst, MU_STR_LITERAL("\\ud83d"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, mu_json_unescape(dst, MU_STR_LITERAL("\\q"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID,
+                                  mu_json_unescape(mu_string_mut_from_buf(s_scratch, 2), MU_STR_LITERAL("\\u20AC"))));
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static mu_json_err_t tokenize(const char *json) {
+    return mu_json_tokenize(MU_STR_LITERAL(json), s_tape, MAX_TOKENS, &s_n_tokens);
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_json.c");
+
+    RUN_TEST(test_mu_json_tokenize_scalars);
+    RUN_TEST(test_mu_json_tokenize_nested);
+    RUN_TEST(test_mu_json_tokenize_errors);
+    RUN_TEST(test_mu_json_find_key);
+    RUN_TEST(test_mu_json_unescape);
+
+    return UnityEnd();
+}
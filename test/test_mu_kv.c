@@ -0,0 +1,173 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_kv.c
+ *
+ * @brief Unit tests for the mu_kv module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_kv.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_kv_reader_t s_reader;
+static mu_string_t s_key;
+static mu_string_t s_value;
+static char s_scratch[32];
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_reader, 0, sizeof(s_reader));
+    s_key = MU_STRING_EMPTY;
+    s_value = MU_STRING_EMPTY;
+}
+
+void tearDown(void) {}
+
+void test_mu_kv_logfmt(void) {
+    mu_kv_reader_init(&s_reader,
+                      MU_STR_LITERAL("  level=info msg=\"hello world\" debug dur=3ms empty= x=\"\"  "),
+                      ' ', '=', '"');
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("level"), s_key));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("info"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("msg"), s_key));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("hello world"), s_value));
+
+    // Bare key
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("debug"), s_key));
+    TEST_ASSERT_EQUAL_size_t(0, s_value.len);
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("3ms"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("empty"), s_key));
+    TEST_ASSERT_EQUAL_size_t(0, s_value.len);
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("x"), s_key));
+    TEST_ASSERT_EQUAL_size_t(0, s_value.len);
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_END, mu_kv_next(&s_reader, &s_key, &s_value));
+}
+
+void test_mu_kv_cookies(void) {
+    mu_kv_reader_init(&s_reader, MU_STR_LITERAL("sid=abc123; theme = dark mode ;lang=\"en;US\""),
+                      ';', '=', '"');
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("sid"), s_key));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("abc123"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("theme"), s_key));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("dark mode"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("lang"), s_key));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("en;US"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_END, mu_kv_next(&s_reader, &s_key, &s_value));
+}
+
+void test_mu_kv_escaped_quotes(void) {
+    mu_kv_reader_init(&s_reader, MU_STR_LITERAL("a=\"say \\\"hi\\\"\" b=\"c:\\\\\" z=1"), ' ', '=', '"');
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("say \\\"hi\\\""), s_value));
+    mu_string_t decoded = mu_kv_unescape(mu_string_mut_from_buf(s_scratch, sizeof(s_scratch)), s_value);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("say \"hi\""), decoded));
+
+    // Escaped backslash just before the closing quote
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("c:\\\\"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("1"), s_value));
+
+    // No escapes: returned as-is
+    mu_string_t plain = MU_STR_LITERAL("plain");
+    TEST_ASSERT_EQUAL_PTR(plain.buf, mu_kv_unescape(MU_STRING_MUT_EMPTY, plain).buf);
+}
+
+void test_mu_kv_errors(void) {
+    mu_string_t input = MU_STR_LITERAL("a=1 b=\"open");
+    mu_kv_reader_init(&s_reader, input, ' ', '=', '"');
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_EQUAL(MU_KV_ERR_UNTERMINATED, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_EQUAL_PTR(input.buf + 4, s_reader.remaining.buf);
+
+    mu_kv_reader_init(&s_reader, MU_STR_LITERAL("a=\"x\"y"), ' ', '=', '"');
+    TEST_ASSERT_EQUAL(MU_KV_ERR_SYNTAX, mu_kv_next(&s_reader, &s_key, &s_value));
+
+    // Quoting disabled: quotes are ordinary characters
+    mu_kv_reader_init(&s_reader, MU_STR_LITERAL("a=\"x"), ' ', '=', '\0');
+    TEST_ASSERT_EQUAL(MU_KV_ERR_NONE, mu_kv_next(&s_reader, &s_key, &s_value));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("\"x"), s_value));
+
+    TEST_ASSERT_EQUAL(MU_KV_ERR_INVALID, mu_kv_next(NULL, &s_key, &s_value));
+    TEST_ASSERT_NULL(mu_kv_reader_init(&s_reader, MU_STRING_INVALID, ' ', '=', '"'));
+}
+
+void test_mu_kv_find(void) {
+    mu_string_t line = MU_STR_LITERAL("ts=1 level=warn msg=\"disk low\"");
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("warn"), mu_kv_find(line, ' ', '=', '"', MU_STR_LITERAL("level"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("disk low"), mu_kv_find(line, ' ', '=', '"', MU_STR_LITERAL("msg"))));
+    TEST_ASSERT_NULL(mu_kv_find(line, ' ', '=', '"', MU_STR_LITERAL("nope")).buf);
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_kv.c");
+
+    RUN_TEST(test_mu_kv_logfmt);
+    RUN_TEST(test_mu_kv_cookies);
+    RUN_TEST(test_mu_kv_escaped_quotes);
+    RUN_TEST(test_mu_kv_errors);
+    RUN_TEST(test_mu_kv_find);
+
+    return UnityEnd();
+}
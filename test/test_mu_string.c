@@ -232,6 +232,187 @@ void test_mu_string_cmp(void) {
      TEST_ASSERT_GREATER_THAN(0, mu_string_cmp(empty, invalid)); // Assuming invalid < empty for consistent ordering
 }
 
+void test_mu_string_short_compare(void) {
+    // Views end at the end of their arrays so that a kernel reading past the
+    // last byte is caught by the address sanitizer.
+    static char a[40], b[40];
+    static const unsigned char other[] = { 0x00, 'a', 'c', 0x7f, 0x80, 0xff };
+
+    for (size_t n = 0; n <= sizeof(a); n++) {
+        for (size_t pos = 0; pos <= n; pos++) {
+            for (size_t k = 0; k < sizeof(other); k++) {
+                for (size_t i = 0; i < sizeof(a); i++) {
+                    a[i] = b[i] = (char)('b' + i % 7);
+                }
+                if (pos < n) {
+                    b[sizeof(b) - n + pos] = (char)other[k];
+                }
+                mu_string_t sa = { .buf = &a[sizeof(a) - n], .len = n };
+                mu_string_t sb = { .buf = &b[sizeof(b) - n], .len = n };
+                int ref = n ? memcmp(sa.buf, sb.buf, n) : 0;
+                ref = (ref > 0) - (ref < 0);
+                int got = mu_string_cmp(sa, sb);
+                got = (got > 0) - (got < 0);
+
+                TEST_ASSERT_EQUAL_INT(ref, got);
+                TEST_ASSERT_EQUAL(ref == 0, mu_string_eq(sa, sb));
+                TEST_ASSERT_EQUAL(ref == 0, mu_string_starts_with(sa, sb));
+                TEST_ASSERT_EQUAL(ref == 0, mu_string_ends_with(sa, sb));
+                if (n > 0) {
+                    // Unequal lengths: a prefix view of sa against sb.
+                    mu_string_t head = { .buf = sa.buf, .len = n - 1 };
+                    bool is_prefix = pos >= n - 1 || ref == 0;
+                    got = mu_string_cmp(head, sb);
+                    got = (got > 0) - (got < 0);
+                    TEST_ASSERT_FALSE(mu_string_eq(head, sb));
+                    TEST_ASSERT_EQUAL(is_prefix, mu_string_starts_with(sb, head));
+                    TEST_ASSERT_EQUAL_INT(is_prefix ? -1 : ref, got);
+                }
+            }
+        }
+    }
+}
+
+void test_mu_string_common_prefix_len(void) {
+    TEST_ASSERT_EQUAL_size_t(6, mu_string_common_prefix_len(
+        MU_STR_LITERAL("/api/v1"), MU_STR_LITERAL("/api/v2")));
+    TEST_ASSERT_EQUAL_size_t(3, mu_string_common_prefix_len(
+        MU_STR_LITERAL("abc"), MU_STR_LITERAL("abcdef")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_common_prefix_len(
+        MU_STR_LITERAL("abc"), MU_STR_LITERAL("xyz")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_common_prefix_len(
+        MU_STRING_EMPTY, MU_STR_LITERAL("abc")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_common_prefix_len(
+        MU_STRING_INVALID, MU_STRING_INVALID));
+
+    // Every length and every position of the first difference, with the
+    // views at the ends of their arrays so overreads are caught.
+    static char a[40], b[40];
+    for (size_t n = 0; n <= sizeof(a); n++) {
+        for (size_t pos = 0; pos <= n; pos++) {
+            for (size_t i = 0; i < sizeof(a); i++) {
+                a[i] = b[i] = (char)('0' + i % 10);
+            }
+            if (pos < n) {
+                b[sizeof(b) - n + pos] = '\xff';
+            }
+            mu_string_t sa = { .buf = &a[sizeof(a) - n], .len = n };
+            mu_string_t sb = { .buf = &b[sizeof(b) - n], .len = n };
+            TEST_ASSERT_EQUAL_size_t(pos, mu_string_common_prefix_len(sa, sb));
+            if (n > 0) {
+                mu_string_t head = { .buf = sb.buf, .len = n - 1 };
+                size_t expected = (pos < n - 1) ? pos : n - 1;
+                TEST_ASSERT_EQUAL_size_t(expected,
+                                         mu_string_common_prefix_len(sa, head));
+            }
+        }
+    }
+}
+
+void test_mu_string_lower_bound(void) {
+    mu_string_t table[] = {
+        MU_STRING_EMPTY,
+        MU_STR_LITERAL("https://example.com/"),
+        MU_STR_LITERAL("https://example.com/api/v1/items"),
+        MU_STR_LITERAL("https://example.com/api/v1/items"),
+        MU_STR_LITERAL("https://example.com/api/v1/items/42"),
+        MU_STR_LITERAL("https://example.com/api/v1/users"),
+        MU_STR_LITERAL("https://example.com/api/v2/items"),
+        MU_STR_LITERAL("https://example.com/static/app.js"),
+        MU_STR_LITERAL("https://example.org/"),
+        MU_STR_LITERAL("https://example.org/\xff"),
+    };
+    size_t n = sizeof(table) / sizeof(table[0]);
+    mu_string_t probes[] = {
+        MU_STRING_EMPTY,
+        MU_STR_LITERAL("h"),
+        MU_STR_LITERAL("https://example.com"),
+        MU_STR_LITERAL("https://example.com/api/v1/item"),
+        MU_STR_LITERAL("https://example.com/api/v1/items/"),
+        MU_STR_LITERAL("https://example.com/api/v1/items/42/x"),
+        MU_STR_LITERAL("https://example.com/api/v1/zzz"),
+        MU_STR_LITERAL("https://example.com/api/v3"),
+        MU_STR_LITERAL("https://example.net/"),
+        MU_STR_LITERAL("https://example.org/\x80"),
+        MU_STR_LITERAL("z"),
+    };
+
+    // Every table entry and every probe agrees with a linear scan.
+    for (size_t k = 0; k < n + sizeof(probes) / sizeof(probes[0]); k++) {
+        mu_string_t key = (k < n) ? table[k] : probes[k - n];
+        size_t expected = 0;
+        while (expected < n && mu_string_cmp(table[expected], key) < 0) {
+            expected += 1;
+        }
+        TEST_ASSERT_EQUAL_size_t(expected, mu_string_lower_bound(table, n, key));
+    }
+    TEST_ASSERT_EQUAL_size_t(2, mu_string_lower_bound(table, n, table[3]));
+    TEST_ASSERT_EQUAL_size_t(n, mu_string_lower_bound(table, n, MU_STR_LITERAL("z")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_lower_bound(table, 0, MU_STR_LITERAL("z")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_lower_bound(table, n, MU_STRING_INVALID));
+
+    // Invalid elements sort first.
+    mu_string_t with_invalid[] = { MU_STRING_INVALID, MU_STR_LITERAL("a"),
+                                   MU_STR_LITERAL("b") };
+    TEST_ASSERT_EQUAL_size_t(1, mu_string_lower_bound(with_invalid, 3, MU_STRING_EMPTY));
+    TEST_ASSERT_EQUAL_size_t(2, mu_string_lower_bound(with_invalid, 3, MU_STR_LITERAL("b")));
+}
+
+void test_mu_string_eq_nocase(void) {
+    TEST_ASSERT_TRUE(mu_string_eq_nocase(MU_STR_LITERAL("Content-Length"),
+                                         MU_STR_LITERAL("content-LENGTH")));
+    TEST_ASSERT_TRUE(mu_string_eq_nocase(MU_STR_LITERAL("AZaz09@[`{"),
+                                         MU_STR_LITERAL("azAZ09@[`{")));
+    // Only ASCII letters fold: '@' vs '`' and '[' vs '{' differ by 0x20 too.
+    TEST_ASSERT_FALSE(mu_string_eq_nocase(MU_STR_LITERAL("@"), MU_STR_LITERAL("`")));
+    TEST_ASSERT_FALSE(mu_string_eq_nocase(MU_STR_LITERAL("["), MU_STR_LITERAL("{")));
+    TEST_ASSERT_FALSE(mu_string_eq_nocase(MU_STR_LITERAL("\xc1"), MU_STR_LITERAL("\xe1")));
+    TEST_ASSERT_FALSE(mu_string_eq_nocase(MU_STR_LITERAL("Host"), MU_STR_LITERAL("Hosts")));
+    TEST_ASSERT_FALSE(mu_string_eq_nocase(MU_STR_LITERAL("abcdefghijklmnoP"),
+                                          MU_STR_LITERAL("ABCDEFGHIJKLMNOQ")));
+    TEST_ASSERT_TRUE(mu_string_eq_nocase(MU_STRING_EMPTY, MU_STRING_EMPTY));
+    TEST_ASSERT_TRUE(mu_string_eq_nocase(MU_STRING_INVALID, MU_STRING_INVALID));
+    TEST_ASSERT_FALSE(mu_string_eq_nocase(MU_STRING_INVALID, MU_STRING_EMPTY));
+
+    // Every byte pair, in every lane of a word.
+    char a[16], b[16];
+    for (int x = 0; x < 256; x++) {
+        for (int y = 0; y < 256; y++) {
+            bool expected = x == y || ((x | 0x20) == (y | 0x20) &&
+                                       (x | 0x20) >= 'a' && (x | 0x20) <= 'z');
+            memset(a, 'q', sizeof(a));
+            memset(b, 'Q', sizeof(b));
+            a[(x + y) % 16] = (char)x;
+            b[(x + y) % 16] = (char)y;
+            mu_string_t sa = { .buf = a, .len = sizeof(a) };
+            mu_string_t sb = { .buf = b, .len = sizeof(b) };
+            TEST_ASSERT_EQUAL(expected, mu_string_eq_nocase(sa, sb));
+            TEST_ASSERT_EQUAL(expected, mu_string_cmp_nocase(sa, sb) == 0);
+        }
+    }
+}
+
+void test_mu_string_cmp_nocase(void) {
+    TEST_ASSERT_EQUAL_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("Hello World!"),
+                                                  MU_STR_LITERAL("hELLO wORLD!")));
+    TEST_ASSERT_LESS_THAN_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("apple"),
+                                                      MU_STR_LITERAL("BANANA")));
+    TEST_ASSERT_GREATER_THAN_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("Zebra"),
+                                                         MU_STR_LITERAL("apple")));
+    // Folded to lower case: '_' (0x5F) sorts after 'Z' but before 'z'.
+    TEST_ASSERT_LESS_THAN_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("_"),
+                                                      MU_STR_LITERAL("Z")));
+    TEST_ASSERT_LESS_THAN_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("prefix"),
+                                                      MU_STR_LITERAL("PREFIX-longer")));
+    TEST_ASSERT_GREATER_THAN_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("same-long-prefix-B"),
+                                                         MU_STR_LITERAL("SAME-LONG-PREFIX-a")));
+    TEST_ASSERT_GREATER_THAN_INT(0, mu_string_cmp_nocase(MU_STR_LITERAL("\xe9"),
+                                                         MU_STR_LITERAL("z")));
+    TEST_ASSERT_EQUAL_INT(0, mu_string_cmp_nocase(MU_STRING_INVALID, MU_STRING_INVALID));
+    TEST_ASSERT_LESS_THAN_INT(0, mu_string_cmp_nocase(MU_STRING_INVALID, MU_STRING_EMPTY));
+    TEST_ASSERT_GREATER_THAN_INT(0, mu_string_cmp_nocase(MU_STRING_EMPTY, MU_STRING_INVALID));
+}
+
 void test_mu_string_starts_with(void) {
     mu_string_t s = MU_STR_LITERAL("hello world");
     TEST_ASSERT_TRUE(mu_string_starts_with(s, MU_STR_LITERAL("hello")));
@@ -324,6 +505,74 @@ void test_mu_string_rfind_char(void) {
     TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, actual_result));
 }
 
+void test_mu_string_count_char(void) {
+    mu_string_t s = MU_STR_LITERAL("a,b,,c,d,e,f,g,h,i,j,"); // 11 commas
+    TEST_ASSERT_EQUAL_size_t(11, mu_string_count_char(s, ','));
+    TEST_ASSERT_EQUAL_size_t(1, mu_string_count_char(s, 'j'));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_count_char(s, 'z'));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_count_char(MU_STRING_EMPTY, 'a'));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_count_char(MU_STRING_INVALID, 'a'));
+
+    // High-bit and NUL bytes are counted like any other.
+    mu_string_t bin = { .buf = "\xff\0\xff\0\0\xff\x7f\xff\xff\0", .len = 10 };
+    TEST_ASSERT_EQUAL_size_t(5, mu_string_count_char(bin, '\xff'));
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_count_char(bin, '\0'));
+}
+
+void test_mu_string_find_any(void) {
+    mu_string_t s = MU_STR_LITERAL("path/to/file.txt?q=1#frag");
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("?q=1#frag"),
+                                  mu_string_find_any(s, MU_STR_LITERAL("?#"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("/to/file.txt?q=1#frag"),
+                                  mu_string_find_any(s, MU_STR_LITERAL("#?/."))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("=1#frag"),
+                                  mu_string_find_any(s, MU_STR_LITERAL("=&;"))));
+    // A set too large for the word path.
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("1#frag"),
+                                  mu_string_find_any(s, MU_STR_LITERAL("0123456789"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_EMPTY,
+                                  mu_string_find_any(s, MU_STR_LITERAL("@!"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_EMPTY, mu_string_find_any(s, MU_STRING_EMPTY)));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_EMPTY,
+                                  mu_string_find_any(MU_STRING_EMPTY, MU_STR_LITERAL("a"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID,
+                                  mu_string_find_any(MU_STRING_INVALID, MU_STR_LITERAL("a"))));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID,
+                                  mu_string_find_any(s, MU_STRING_INVALID)));
+}
+
+void test_mu_string_scan_alignment(void) {
+    // Every start alignment, length and hit position, against simple loops.
+    char buf[64 + 8];
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t len = 0; len <= 64; len++) {
+            for (size_t hit = 0; hit <= len; hit++) {
+                memset(buf, 'x', sizeof(buf));
+                char *p = &buf[offset];
+                if (hit < len) {
+                    p[hit] = '\x80';
+                }
+                mu_string_t s = { .buf = p, .len = len };
+                mu_string_t first = mu_string_find_char(s, '\x80');
+                mu_string_t last = mu_string_rfind_char(s, '\x80');
+                mu_string_t any = mu_string_find_any(s, MU_STR_LITERAL("\x80y"));
+                if (hit < len) {
+                    TEST_ASSERT_EQUAL_PTR(&p[hit], first.buf);
+                    TEST_ASSERT_EQUAL_PTR(&p[hit], last.buf);
+                    TEST_ASSERT_EQUAL_PTR(&p[hit], any.buf);
+                    TEST_ASSERT_EQUAL_size_t(1, mu_string_count_char(s, '\x80'));
+                } else {
+                    TEST_ASSERT_EQUAL_size_t(0, first.len);
+                    TEST_ASSERT_EQUAL_size_t(0, last.len);
+                    TEST_ASSERT_EQUAL_size_t(0, any.len);
+                    TEST_ASSERT_EQUAL_size_t(0, mu_string_count_char(s, '\x80'));
+                }
+                TEST_ASSERT_EQUAL_size_t(len - (hit < len), mu_string_count_char(s, 'x'));
+            }
+        }
+    }
+}
+
 void test_mu_string_find_pred(void) {
     mu_string_t s = MU_STR_LITERAL("  \t hello world"); // len 14
     mu_string_t actual_result;
@@ -1000,6 +1249,55 @@ void test_mu_string_copy(void) {
      TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, result5)); // Should return INVALID for invalid destination
 }
 
+void test_mu_string_copy_overlap(void) {
+    // Compaction within one buffer: drop a leading field, then shift right.
+    char buf[64] = "skip:keep this text";
+    mu_string_t tail = { .buf = &buf[5], .len = 14 };
+    mu_string_t copied = mu_string_copy(mu_string_mut_from_buf(buf, sizeof(buf)), tail);
+    TEST_ASSERT_EQUAL_size_t(14, copied.len);
+    TEST_ASSERT_EQUAL_MEMORY("keep this text", buf, 14);
+
+    mu_string_t head = { .buf = buf, .len = 14 };
+    mu_string_mut_t rest = mu_string_append(mu_string_mut_from_buf(&buf[3], 20), head);
+    TEST_ASSERT_EQUAL_PTR(&buf[17], rest.buf);
+    TEST_ASSERT_EQUAL_MEMORY("keekeep this text", buf, 17);
+
+    // Copying onto itself is harmless.
+    copied = mu_string_copy(mu_string_mut_from_buf(buf, 17), (mu_string_t){ .buf = buf, .len = 17 });
+    TEST_ASSERT_EQUAL_MEMORY("keekeep this text", copied.buf, 17);
+}
+
+void test_mu_string_copy_large(void) {
+    // Large enough to take the streaming path, at every pairing of source and
+    // destination alignment, with lengths that leave partial groups.
+    static char src[MU_STRING_STREAM_THRESHOLD + 256];
+    static char dst[MU_STRING_STREAM_THRESHOLD + 256];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (char)(i * 131 + (i >> 8));
+    }
+    for (size_t s_off = 0; s_off < 3; s_off++) {
+        for (size_t d_off = 0; d_off < 17; d_off += 5) {
+            size_t n = MU_STRING_STREAM_THRESHOLD + 64 + s_off * 7 + d_off;
+            memset(dst, 0, sizeof(dst));
+            mu_string_t from = { .buf = &src[s_off], .len = n };
+            mu_string_t copied = mu_string_copy(
+                mu_string_mut_from_buf(&dst[d_off], n), from);
+            TEST_ASSERT_EQUAL_size_t(n, copied.len);
+            TEST_ASSERT_EQUAL_MEMORY(from.buf, copied.buf, n);
+            TEST_ASSERT_EQUAL_INT(0, dst[d_off + n]); // nothing past the end
+            if (d_off > 0) {
+                TEST_ASSERT_EQUAL_INT(0, dst[d_off - 1]);
+            }
+        }
+    }
+
+    // A large overlapping move takes the memmove() path instead.
+    memcpy(dst, src, sizeof(dst));
+    mu_string_t moved = { .buf = &dst[100], .len = MU_STRING_STREAM_THRESHOLD };
+    mu_string_copy(mu_string_mut_from_buf(dst, MU_STRING_STREAM_THRESHOLD), moved);
+    TEST_ASSERT_EQUAL_MEMORY(&src[100], dst, MU_STRING_STREAM_THRESHOLD);
+}
+
 void test_mu_string_append(void) {
     // mu_string_append copies into a mutable buffer segment STARTING AT INDEX 0
     // of that segment, limited by segment.len (capacity), and returns a mutable
@@ -1089,6 +1387,275 @@ void test_mu_string_append(void) {
 }
 
 
+void test_mu_string_mut_splice(void) {
+    char buf[16];
+    mu_string_mut_t dst = mu_string_mut_from_buf(buf, sizeof(buf));
+    memcpy(buf, "hello world", 11);
+
+    mu_string_t r = mu_string_mut_insert(dst, 11, 5, MU_STR_LITERAL(","));
+    TEST_ASSERT_EQUAL_PTR(buf, r.buf);
+    TEST_ASSERT_EQUAL_size_t(12, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("hello, world", buf, 12);
+
+    r = mu_string_mut_splice(dst, 12, 7, 5, MU_STR_LITERAL("there!"));
+    TEST_ASSERT_EQUAL_size_t(13, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("hello, there!", buf, 13);
+
+    r = mu_string_mut_erase(dst, 13, 0, 7);
+    TEST_ASSERT_EQUAL_size_t(6, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("there!", buf, 6);
+
+    // Counts are clamped to the content; positions are not.
+    r = mu_string_mut_erase(dst, 6, 5, 100);
+    TEST_ASSERT_EQUAL_size_t(5, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("there", buf, 5);
+    r = mu_string_mut_insert(dst, 5, 5, MU_STR_LITERAL(" you are"));
+    TEST_ASSERT_EQUAL_size_t(13, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("there you are", buf, 13);
+    TEST_ASSERT_NULL(mu_string_mut_insert(dst, 13, 14, MU_STR_LITERAL("x")).buf);
+
+    // Too big to fit: the buffer is left alone.
+    TEST_ASSERT_NULL(mu_string_mut_insert(dst, 13, 0, MU_STR_LITERAL("four")).buf);
+    TEST_ASSERT_EQUAL_MEMORY("there you are", buf, 13);
+    r = mu_string_mut_splice(dst, 13, 0, 5, MU_STR_LITERAL("here,"));
+    TEST_ASSERT_EQUAL_size_t(13, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("here, you are", buf, 13);
+
+    TEST_ASSERT_NULL(mu_string_mut_insert(dst, 17, 0, MU_STRING_EMPTY).buf);
+    TEST_ASSERT_NULL(mu_string_mut_insert(dst, 13, 0, MU_STRING_INVALID).buf);
+    TEST_ASSERT_NULL(mu_string_mut_insert(mu_string_mut_from_buf(NULL, 0), 0, 0,
+                                          MU_STRING_EMPTY).buf);
+}
+
+void test_mu_string_mut_apply_edits(void) {
+    char buf[32];
+    mu_string_mut_t dst = mu_string_mut_from_buf(buf, sizeof(buf));
+    memcpy(buf, "GET /a HTTP/1.0\r\n", 17);
+
+    mu_string_edit_t edits[] = {
+        { .pos = 0, .count = 3, .text = MU_STR_LITERAL("POST") },
+        { .pos = 5, .count = 1, .text = MU_STR_LITERAL("api/v2") },
+        { .pos = 6, .count = 0, .text = MU_STR_LITERAL("?x=1") },
+        { .pos = 14, .count = 1, .text = MU_STR_LITERAL("1") },
+        { .pos = 15, .count = 2, .text = MU_STRING_EMPTY },
+    };
+    mu_string_t r = mu_string_mut_apply_edits(dst, 17, edits, 5);
+    TEST_ASSERT_EQUAL_size_t(strlen("POST /api/v2?x=1 HTTP/1.1"), r.len);
+    TEST_ASSERT_EQUAL_MEMORY("POST /api/v2?x=1 HTTP/1.1", buf, r.len);
+
+    // Out of order, overlapping, out of range or too big: buffer unchanged.
+    mu_string_edit_t bad[] = {
+        { .pos = 4, .count = 2, .text = MU_STRING_EMPTY },
+        { .pos = 5, .count = 0, .text = MU_STRING_EMPTY },
+    };
+    TEST_ASSERT_NULL(mu_string_mut_apply_edits(dst, 25, bad, 2).buf);
+    bad[1].pos = 26;
+    TEST_ASSERT_NULL(mu_string_mut_apply_edits(dst, 25, bad, 2).buf);
+    bad[1] = (mu_string_edit_t){ .pos = 25, .count = 0,
+                                 .text = MU_STR_LITERAL("1234567890") };
+    TEST_ASSERT_NULL(mu_string_mut_apply_edits(dst, 25, bad, 2).buf);
+    TEST_ASSERT_EQUAL_MEMORY("POST /api/v2?x=1 HTTP/1.1", buf, 25);
+    TEST_ASSERT_EQUAL_size_t(25, mu_string_mut_apply_edits(dst, 25, NULL, 0).len);
+
+    // Random edit lists agree with splicing the same edits one at a time from
+    // the right, where earlier positions are not yet disturbed.
+    static const char *texts[] = { "", "x", "yz", "0123456" };
+    char ref[32];
+    uint32_t rng = 12345;
+    for (int trial = 0; trial < 2000; trial++) {
+        size_t used = 0;
+        for (; used < 16; used++) {
+            buf[used] = ref[used] = (char)('a' + used);
+        }
+        mu_string_edit_t list[6];
+        size_t n = 0;
+        size_t pos = 0;
+        while (n < 6) {
+            rng = rng * 1103515245u + 12345u;
+            pos += (rng >> 16) % 5;
+            if (pos > used) {
+                break;
+            }
+            size_t count = (rng >> 20) % 4;
+            if (count > used - pos) {
+                count = used - pos;
+            }
+            list[n].pos = pos;
+            list[n].count = count;
+            list[n].text = MU_STR_LITERAL(texts[(rng >> 24) % 4]);
+            pos += count;
+            n++;
+        }
+        mu_string_mut_t ref_dst = mu_string_mut_from_buf(ref, sizeof(ref));
+        size_t ref_len = used;
+        bool fits = true;
+        for (size_t i = n; i-- > 0;) {
+            mu_string_t step = mu_string_mut_splice(ref_dst, ref_len, list[i].pos,
+                                                    list[i].count, list[i].text);
+            if (step.buf == NULL) {
+                fits = false;
+                break;
+            }
+            ref_len = step.len;
+        }
+        r = mu_string_mut_apply_edits(dst, used, list, n);
+        if (fits) {
+            TEST_ASSERT_EQUAL_size_t(ref_len, r.len);
+            TEST_ASSERT_EQUAL_MEMORY(ref, buf, ref_len);
+        }
+    }
+}
+
+void test_mu_string_remove_set(void) {
+    char out[64];
+    mu_string_mut_t dst = mu_string_mut_from_buf(out, sizeof(out));
+    mu_string_t r = mu_string_remove_set(dst, MU_STR_LITERAL("a\r\nb\r\n\r\nc"),
+                                         MU_STR_LITERAL("\r"));
+    TEST_ASSERT_EQUAL_size_t(6, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("a\nb\n\nc", r.buf, 6);
+    r = mu_string_remove_set(dst, MU_STR_LITERAL("keep"), MU_STRING_EMPTY);
+    TEST_ASSERT_EQUAL_MEMORY("keep", r.buf, 4);
+    r = mu_string_remove_set(dst, MU_STR_LITERAL("xxxx"), MU_STR_LITERAL("x"));
+    TEST_ASSERT_EQUAL_PTR(out, r.buf);
+    TEST_ASSERT_EQUAL_size_t(0, r.len);
+    TEST_ASSERT_NULL(mu_string_remove_set(mu_string_mut_from_buf(out, 3),
+                                          MU_STR_LITERAL("abcd"),
+                                          MU_STR_LITERAL("x")).buf);
+    TEST_ASSERT_NULL(mu_string_remove_set(dst, MU_STRING_INVALID, MU_STR_LITERAL("x")).buf);
+
+    // Each kind of set (small, ASCII, any byte) against a byte loop, copied
+    // out and in place, over random text with members sprinkled in.
+    static const char *sets[] = {
+        "\t", "\r\n\t ",
+        "\x01\x02\x03\x04\x05\x06\x07\x08\x0b\x0c\x0e\x0f\x10\x1b\x7f",
+        "aeiou\xc3\xa9",
+    };
+    char src[200], in_place[200], expected[200];
+    uint32_t rng = 99;
+    for (size_t k = 0; k < sizeof(sets) / sizeof(sets[0]); k++) {
+        mu_string_t set = MU_STR_LITERAL(sets[k]);
+        for (int trial = 0; trial < 50; trial++) {
+            size_t n = (size_t)trial * 4;
+            size_t n_expected = 0;
+            for (size_t i = 0; i < n; i++) {
+                rng = rng * 1103515245u + 12345u;
+                src[i] = ((rng >> 16) % 4 == 0) ? sets[k][(rng >> 20) % set.len]
+                                                : (char)(' ' + (rng >> 20) % 95);
+                if (memchr(set.buf, src[i], set.len) == NULL) {
+                    expected[n_expected++] = src[i];
+                }
+            }
+            char big[200];
+            r = mu_string_remove_set(mu_string_mut_from_buf(big, sizeof(big)),
+                                     (mu_string_t){ .buf = src, .len = n }, set);
+            TEST_ASSERT_EQUAL_size_t(n_expected, r.len);
+            TEST_ASSERT_TRUE(memcmp(expected, big, n_expected) == 0);
+            memcpy(in_place, src, n);
+            r = mu_string_mut_remove_set(mu_string_mut_from_buf(in_place, n), n, set);
+            TEST_ASSERT_EQUAL_PTR(in_place, r.buf);
+            TEST_ASSERT_EQUAL_size_t(n_expected, r.len);
+            TEST_ASSERT_TRUE(memcmp(expected, in_place, n_expected) == 0);
+        }
+    }
+}
+
+void test_mu_string_squeeze(void) {
+    char buf[32];
+    mu_string_mut_t dst = mu_string_mut_from_buf(buf, sizeof(buf));
+    mu_string_t r = mu_string_squeeze(dst, MU_STR_LITERAL("a//b///c/"), MU_STR_LITERAL("/"));
+    TEST_ASSERT_EQUAL_size_t(6, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("a/b/c/", r.buf, 6);
+    // Only repeats of the same byte are squeezed.
+    r = mu_string_squeeze(dst, MU_STR_LITERAL("x  -- y - z"), MU_STR_LITERAL(" -"));
+    TEST_ASSERT_EQUAL_size_t(9, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("x - y - z", r.buf, 9);
+    // Bytes outside the set repeat freely.
+    r = mu_string_squeeze(dst, MU_STR_LITERAL("aabb  cc"), MU_STR_LITERAL(" "));
+    TEST_ASSERT_EQUAL_MEMORY("aabb cc", r.buf, 7);
+
+    memcpy(buf, "  lots    of   space  ", 22);
+    r = mu_string_mut_squeeze(dst, 22, MU_STR_LITERAL(" "));
+    TEST_ASSERT_EQUAL_size_t(15, r.len);
+    TEST_ASSERT_EQUAL_MEMORY(" lots of space ", buf, 15);
+    TEST_ASSERT_NULL(mu_string_mut_squeeze(dst, 33, MU_STR_LITERAL(" ")).buf);
+}
+
+void test_mu_string_collapse_space(void) {
+    char buf[32];
+    mu_string_mut_t dst = mu_string_mut_from_buf(buf, sizeof(buf));
+    mu_string_t r = mu_string_collapse_space(dst, MU_STR_LITERAL("\tone \r\n two\v\fthree "));
+    TEST_ASSERT_EQUAL_size_t(15, r.len);
+    TEST_ASSERT_EQUAL_MEMORY(" one two three ", r.buf, 15);
+    r = mu_string_collapse_space(dst, MU_STR_LITERAL("nospace"));
+    TEST_ASSERT_EQUAL_MEMORY("nospace", r.buf, 7);
+    r = mu_string_collapse_space(dst, MU_STRING_EMPTY);
+    TEST_ASSERT_EQUAL_size_t(0, r.len);
+
+    memcpy(buf, "a \t b\n\n\nc", 9);
+    r = mu_string_mut_collapse_space(dst, 9);
+    TEST_ASSERT_EQUAL_size_t(5, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("a b c", buf, 5);
+}
+
+void test_mu_string_translate(void) {
+    uint8_t upper[256], swap[256], redact[256], latin1[256], three[256], mixed[256];
+    for (int c = 0; c < 256; c++) {
+        upper[c] = (uint8_t)((c >= 'a' && c <= 'z') ? c - 32 : c);
+        swap[c] = (uint8_t)((c >= 'a' && c <= 'z') ? c - 32
+                            : (c >= 'A' && c <= 'Z') ? c + 32 : c);
+        redact[c] = (uint8_t)((c >= '0' && c <= '9') ? '#' : c);
+        // ASCII folding of Latin-1: lower case, and accented vowels to plain.
+        latin1[c] = (uint8_t)((c >= 'A' && c <= 'Z') ? c + 32
+                              : (c >= 0xE0 && c <= 0xE5) ? 'a' : c);
+        three[c] = (uint8_t)((c >= '0' && c <= '9') ? '#'
+                             : (c >= 'a' && c <= 'z') ? c - 32
+                             : (c == '\t') ? ' ' : c);
+        mixed[c] = (uint8_t)(c * 7 + 3);
+    }
+    const uint8_t *tables[] = { upper, swap, redact, latin1, three, mixed };
+
+    char out[64];
+    mu_string_mut_t dst = mu_string_mut_from_buf(out, sizeof(out));
+    mu_string_t r = mu_string_translate(dst, MU_STR_LITERAL("Card 4111-1111"), redact);
+    TEST_ASSERT_EQUAL_size_t(14, r.len);
+    TEST_ASSERT_EQUAL_MEMORY("Card ####-####", r.buf, 14);
+    TEST_ASSERT_NULL(mu_string_translate(mu_string_mut_from_buf(out, 3),
+                                         MU_STR_LITERAL("abcd"), upper).buf);
+    TEST_ASSERT_NULL(mu_string_translate(dst, MU_STR_LITERAL("a"), NULL).buf);
+    TEST_ASSERT_NULL(mu_string_mut_translate(dst, 65, upper).buf);
+
+    // Every table, long enough to take the word path, against a byte loop,
+    // copied out and in place, at several lengths and offsets.
+    char src[300], got[300];
+    for (int c = 0; c < 256; c++) {
+        src[c] = (char)c;
+    }
+    for (int c = 256; c < 300; c++) {
+        src[c] = (char)("Hello, World 09az\t\xe1"[c % 19]);
+    }
+    for (size_t t = 0; t < sizeof(tables) / sizeof(tables[0]); t++) {
+        for (size_t off = 0; off < 9; off += 4) {
+            for (size_t n = 0; n + off <= sizeof(src); n += 37) {
+                mu_string_t from = { .buf = &src[off], .len = n };
+                r = mu_string_translate(mu_string_mut_from_buf(got, sizeof(got)),
+                                        from, tables[t]);
+                TEST_ASSERT_EQUAL_size_t(n, r.len);
+                for (size_t i = 0; i < n; i++) {
+                    TEST_ASSERT_EQUAL_HEX8(tables[t][(unsigned char)src[off + i]],
+                                           (unsigned char)got[i]);
+                }
+                memcpy(got, &src[off], n);
+                r = mu_string_mut_translate(mu_string_mut_from_buf(got, n), n, tables[t]);
+                TEST_ASSERT_EQUAL_size_t(n, r.len);
+                for (size_t i = 0; i < n; i++) {
+                    TEST_ASSERT_EQUAL_HEX8(tables[t][(unsigned char)src[off + i]],
+                                           (unsigned char)got[i]);
+                }
+            }
+        }
+    }
+}
+
 // *****************************************************************************
 // Private (static) code - Helper functions can go here
 
@@ -1109,12 +1676,20 @@ int main(void) {
     // Comparison
     RUN_TEST(test_mu_string_eq);
     RUN_TEST(test_mu_string_cmp);
+    RUN_TEST(test_mu_string_short_compare);
     RUN_TEST(test_mu_string_starts_with);
     RUN_TEST(test_mu_string_ends_with);
+    RUN_TEST(test_mu_string_common_prefix_len);
+    RUN_TEST(test_mu_string_lower_bound);
+    RUN_TEST(test_mu_string_eq_nocase);
+    RUN_TEST(test_mu_string_cmp_nocase);
 
     // Searching
     RUN_TEST(test_mu_string_find_char);
     RUN_TEST(test_mu_string_rfind_char);
+    RUN_TEST(test_mu_string_count_char);
+    RUN_TEST(test_mu_string_find_any);
+    RUN_TEST(test_mu_string_scan_alignment);
     RUN_TEST(test_mu_string_find_pred);
     RUN_TEST(test_mu_string_rfind_pred);
     RUN_TEST(test_mu_string_find_first_not_pred);
@@ -1134,7 +1709,15 @@ int main(void) {
 
     // Mutation (requires user buffer)
     RUN_TEST(test_mu_string_copy); // Copy to start, return view of written data
+    RUN_TEST(test_mu_string_copy_overlap);
+    RUN_TEST(test_mu_string_copy_large);
     RUN_TEST(test_mu_string_append); // Copy to segment start, return view of REMAINING space (cursor)
+    RUN_TEST(test_mu_string_mut_splice);
+    RUN_TEST(test_mu_string_mut_apply_edits);
+    RUN_TEST(test_mu_string_remove_set);
+    RUN_TEST(test_mu_string_squeeze);
+    RUN_TEST(test_mu_string_collapse_space);
+    RUN_TEST(test_mu_string_translate);
 
 
     return UnityEnd();
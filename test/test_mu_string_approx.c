@@ -0,0 +1,205 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_approx.c
+ *
+ * @brief Unit tests for the mu_string_approx module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_approx.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+// *****************************************************************************
+// Private (static) storage
+
+static char s_long_a[201];
+static char s_long_b[201];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static size_t distance(const char *a, const char *b, size_t max_dist);
+static void assert_found(const char *haystack, const char *needle,
+                         size_t max_dist, const char *expected);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    // Two 200-byte strings (four words of pattern) differing in 3 places.
+    for (size_t i = 0; i < 200; i++) {
+        s_long_a[i] = (char)('a' + (i * 7) % 26);
+    }
+    s_long_a[200] = '\0';
+    memcpy(s_long_b, s_long_a, sizeof(s_long_b));
+    s_long_b[10] = '#';  // substitution
+    memmove(&s_long_b[100], &s_long_b[101], 100); // deletion
+    s_long_b[150] = '!'; // substitution
+}
+
+void tearDown(void) {}
+
+void test_mu_string_edit_distance(void) {
+    TEST_ASSERT_EQUAL_size_t(0, distance("", "", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(3, distance("abc", "", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(3, distance("", "abc", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(0, distance("same", "same", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(3, distance("kitten", "sitting", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(3, distance("sitting", "kitten", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(2, distance("flaw", "lawn", SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(1, distance("connection reset", "connection rest", SIZE_MAX));
+
+    // Exactly 64 and 65 bytes: the boundary between one and two words.
+    char x[66], y[66];
+    memset(x, 'x', 65);
+    memset(y, 'x', 65);
+    x[65] = y[65] = '\0';
+    y[63] = 'y';
+    TEST_ASSERT_EQUAL_size_t(1, distance(x, y, SIZE_MAX));
+    x[64] = '\0';
+    y[64] = '\0';
+    TEST_ASSERT_EQUAL_size_t(1, distance(x, y, SIZE_MAX));
+    y[63] = 'x';
+    TEST_ASSERT_EQUAL_size_t(1, distance(x, "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx", SIZE_MAX));
+}
+
+void test_mu_string_edit_distance_long(void) {
+    TEST_ASSERT_EQUAL_size_t(0, distance(s_long_a, s_long_a, SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(3, distance(s_long_a, s_long_b, SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(3, distance(s_long_b, s_long_a, 3));
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, distance(s_long_a, s_long_b, 2));
+}
+
+void test_mu_string_edit_distance_threshold(void) {
+    TEST_ASSERT_EQUAL_size_t(3, distance("kitten", "sitting", 3));
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, distance("kitten", "sitting", 2));
+    // Rejected on length alone.
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, distance("a", "abcdef", 4));
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, distance("abcdefgh", "zyxwvuts", 0));
+
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, mu_string_edit_distance(MU_STRING_INVALID, MU_STR_LITERAL("a"), SIZE_MAX));
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, mu_string_edit_distance(MU_STR_LITERAL("a"), MU_STRING_INVALID, SIZE_MAX));
+}
+
+void test_mu_string_find_approx(void) {
+    assert_found("the quick brown fox", "quick", 0, "quick");
+    assert_found("the quikc brown fox", "quick", 2, "quik");
+    assert_found("the quck brown fox", "quick", 1, "quck");
+    // The match is extended while the distance improves.
+    assert_found("say helo hello", "hello", 1, "helo");
+    assert_found("say hello", "hello", 1, "hello");
+    assert_found("ERROR: conection refused", "connection", 1, "conection");
+
+    mu_string_t r = mu_string_find_approx(MU_STR_LITERAL("abcdef"), MU_STR_LITERAL("xyz"), 1);
+    TEST_ASSERT_NULL(r.buf);
+    r = mu_string_find_approx(MU_STR_LITERAL("abc"), MU_STR_LITERAL(""), 0);
+    TEST_ASSERT_EQUAL_size_t(0, r.len);
+    TEST_ASSERT_NOT_NULL(r.buf);
+    r = mu_string_find_approx(MU_STRING_INVALID, MU_STR_LITERAL("a"), 0);
+    TEST_ASSERT_FALSE(mu_string_is_valid(r));
+}
+
+void test_mu_string_find_approx_long(void) {
+    // A 200-byte needle with 3 edits, embedded in a longer haystack.
+    static char haystack[400];
+    memset(haystack, '.', sizeof(haystack));
+    memcpy(&haystack[100], s_long_b, 199);
+    haystack[sizeof(haystack) - 1] = '\0';
+    mu_string_t r = mu_string_find_approx(MU_STR_LITERAL(haystack), MU_STR_LITERAL(s_long_a), 3);
+    TEST_ASSERT_EQUAL_PTR(&haystack[100], r.buf);
+    TEST_ASSERT_EQUAL_size_t(199, r.len);
+    r = mu_string_find_approx(MU_STR_LITERAL(haystack), MU_STR_LITERAL(s_long_a), 2);
+    TEST_ASSERT_NULL(r.buf);
+}
+
+void test_mu_string_approx_all_bytes(void) {
+#if MU_STRING_APPROX_MAX_LEN >= 300
+    // Every byte value, then a run counting down from 255.  Byte 255 takes
+    // the 256th row of the match table, so repeating it checks that the row
+    // number is not truncated to 8 bits.
+    static char needle[300];
+    static char other[300];
+    static char haystack[400];
+    for (size_t i = 0; i < sizeof(needle); i++) {
+        needle[i] = (char)(i < 256 ? i : 255 - (i - 256));
+    }
+    mu_string_t n = { .buf = needle, .len = sizeof(needle) };
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_edit_distance(n, n, 5));
+    memcpy(other, needle, sizeof(other));
+    other[280] = (char)(other[280] + 1);
+    mu_string_t o = { .buf = other, .len = sizeof(other) };
+    TEST_ASSERT_EQUAL_size_t(1, mu_string_edit_distance(n, o, 5));
+
+    memset(haystack, 'z', sizeof(haystack));
+    memcpy(&haystack[50], needle, sizeof(needle));
+    mu_string_t h = { .buf = haystack, .len = sizeof(haystack) };
+    mu_string_t r = mu_string_find_approx(h, n, 2);
+    TEST_ASSERT_EQUAL_PTR(&haystack[50], r.buf);
+    TEST_ASSERT_EQUAL_size_t(sizeof(needle), r.len);
+#else
+    TEST_IGNORE_MESSAGE("needs MU_STRING_APPROX_MAX_LEN >= 300 (make approx_max_len)");
+#endif
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t distance(const char *a, const char *b, size_t max_dist) {
+    return mu_string_edit_distance(MU_STR_LITERAL(a), MU_STR_LITERAL(b), max_dist);
+}
+
+static void assert_found(const char *haystack, const char *needle,
+                         size_t max_dist, const char *expected) {
+    mu_string_t r = mu_string_find_approx(MU_STR_LITERAL(haystack), MU_STR_LITERAL(needle), max_dist);
+    TEST_ASSERT_NOT_NULL_MESSAGE(r.buf, needle);
+    TEST_ASSERT_TRUE_MESSAGE(mu_string_eq(MU_STR_LITERAL(expected), r), expected);
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_approx.c");
+
+    RUN_TEST(test_mu_string_edit_distance);
+    RUN_TEST(test_mu_string_edit_distance_long);
+    RUN_TEST(test_mu_string_edit_distance_threshold);
+    RUN_TEST(test_mu_string_find_approx);
+    RUN_TEST(test_mu_string_find_approx_long);
+    RUN_TEST(test_mu_string_approx_all_bytes);
+
+    return UnityEnd();
+}
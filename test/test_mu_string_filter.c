@@ -0,0 +1,252 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_filter.c
+ *
+ * @brief Unit tests for the mu_string_filter module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_filter.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define N_KEYS 1000
+#define N_PROBES 10000
+#define BLOOM_WORDS MU_STRING_BLOOM_WORDS(N_KEYS, 10)
+#define CUCKOO_SLOTS (4 * 512)
+
+// *****************************************************************************
+// Private (static) storage
+
+static char s_key_text[N_KEYS][16];
+static mu_string_t s_keys[N_KEYS];
+static char s_probe_text[N_PROBES][16];
+static mu_string_t s_probes[N_PROBES];
+static bool s_results[N_PROBES];
+
+static uint64_t s_bloom_words[BLOOM_WORDS];
+static mu_string_bloom_t s_bloom;
+static uint16_t s_cuckoo_slots[CUCKOO_SLOTS];
+static mu_string_cuckoo_t s_cuckoo;
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    for (size_t i = 0; i < N_KEYS; i++) {
+        int n = snprintf(s_key_text[i], sizeof(s_key_text[i]), "user:%zu", i);
+        s_keys[i] = mu_string_from_buf(s_key_text[i], (size_t)n);
+    }
+    for (size_t i = 0; i < N_PROBES; i++) {
+        int n = snprintf(s_probe_text[i], sizeof(s_probe_text[i]), "guest:%zu", i);
+        s_probes[i] = mu_string_from_buf(s_probe_text[i], (size_t)n);
+    }
+}
+
+void tearDown(void) {}
+
+void test_mu_string_hash64(void) {
+    char buf[40];
+    const char *text = "The quick brown fox jumps over";
+    size_t len = strlen(text);
+    uint64_t h = mu_string_hash64(MU_STR_LITERAL(text), 0);
+
+    // Depends on the bytes, not on where they are.
+    for (size_t offset = 1; offset < 8; offset++) {
+        memcpy(&buf[offset], text, len);
+        TEST_ASSERT_EQUAL_UINT64(
+            h, mu_string_hash64(mu_string_from_buf(&buf[offset], len), 0));
+    }
+    TEST_ASSERT_NOT_EQUAL(h, mu_string_hash64(MU_STR_LITERAL(text), 1));
+    TEST_ASSERT_NOT_EQUAL(h, mu_string_hash64(mu_string_from_buf(text, len - 1), 0));
+    TEST_ASSERT_NOT_EQUAL(mu_string_hash64(MU_STR_LITERAL("ab"), 0),
+                          mu_string_hash64(MU_STR_LITERAL("ba"), 0));
+    TEST_ASSERT_NOT_EQUAL(mu_string_hash64(MU_STRING_EMPTY, 0),
+                          mu_string_hash64(mu_string_from_buf("\0", 1), 0));
+    TEST_ASSERT_EQUAL_UINT64(0, mu_string_hash64(MU_STRING_INVALID, 0));
+
+    // Every output bit is used: keys differing in one byte flip about half.
+    uint64_t ones = 0, zeros = 0;
+    for (size_t i = 0; i < N_KEYS; i++) {
+        uint64_t x = mu_string_hash64(s_keys[i], 0);
+        ones |= x;
+        zeros |= ~x;
+    }
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, ones);
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, zeros);
+}
+
+void test_mu_string_bloom(void) {
+    TEST_ASSERT_EQUAL_PTR(&s_bloom, mu_string_bloom_init(&s_bloom, s_bloom_words,
+                                                         BLOOM_WORDS, 7));
+    TEST_ASSERT_FALSE(mu_string_bloom_may_contain(&s_bloom, s_keys[0]));
+
+    for (size_t i = 0; i < N_KEYS; i++) {
+        TEST_ASSERT_TRUE(mu_string_bloom_add(&s_bloom, s_keys[i]));
+    }
+    for (size_t i = 0; i < N_KEYS; i++) {
+        TEST_ASSERT_TRUE(mu_string_bloom_may_contain(&s_bloom, s_keys[i]));
+    }
+    size_t false_positives = 0;
+    for (size_t i = 0; i < N_PROBES; i++) {
+        false_positives += mu_string_bloom_may_contain(&s_bloom, s_probes[i]);
+    }
+    TEST_ASSERT_LESS_THAN(N_PROBES / 40, false_positives); // ~1% expected
+
+    mu_string_bloom_clear(&s_bloom);
+    TEST_ASSERT_FALSE(mu_string_bloom_may_contain(&s_bloom, s_keys[0]));
+
+    TEST_ASSERT_NULL(mu_string_bloom_init(NULL, s_bloom_words, BLOOM_WORDS, 7));
+    TEST_ASSERT_NULL(mu_string_bloom_init(&s_bloom, NULL, BLOOM_WORDS, 7));
+    TEST_ASSERT_NULL(mu_string_bloom_init(&s_bloom, s_bloom_words, 0, 7));
+    TEST_ASSERT_NULL(mu_string_bloom_init(&s_bloom, s_bloom_words, 12, 7));
+    TEST_ASSERT_NULL(mu_string_bloom_init(&s_bloom, s_bloom_words, BLOOM_WORDS, 0));
+    TEST_ASSERT_NULL(mu_string_bloom_init(&s_bloom, s_bloom_words, BLOOM_WORDS, 17));
+    TEST_ASSERT_FALSE(mu_string_bloom_add(&s_bloom, MU_STRING_INVALID));
+    TEST_ASSERT_FALSE(mu_string_bloom_may_contain(&s_bloom, MU_STRING_INVALID));
+}
+
+void test_mu_string_bloom_batch(void) {
+    mu_string_bloom_init(&s_bloom, s_bloom_words, BLOOM_WORDS, 7);
+    TEST_ASSERT_EQUAL_size_t(N_KEYS,
+                             mu_string_bloom_add_batch(&s_bloom, s_keys, N_KEYS));
+
+    // Batched and single queries agree, including across a partial batch.
+    size_t hits = mu_string_bloom_query_batch(&s_bloom, s_probes, 999, s_results);
+    size_t expected = 0;
+    for (size_t i = 0; i < 999; i++) {
+        bool hit = mu_string_bloom_may_contain(&s_bloom, s_probes[i]);
+        TEST_ASSERT_EQUAL(hit, s_results[i]);
+        expected += hit;
+    }
+    TEST_ASSERT_EQUAL_size_t(expected, hits);
+    TEST_ASSERT_EQUAL_size_t(
+        N_KEYS, mu_string_bloom_query_batch(&s_bloom, s_keys, N_KEYS, s_results));
+
+    mu_string_t mixed[3] = { MU_STR_LITERAL("a"), MU_STRING_INVALID,
+                             MU_STR_LITERAL("b") };
+    TEST_ASSERT_EQUAL_size_t(2, mu_string_bloom_add_batch(&s_bloom, mixed, 3));
+    TEST_ASSERT_EQUAL_size_t(2, mu_string_bloom_query_batch(&s_bloom, mixed, 3,
+                                                            s_results));
+    TEST_ASSERT_FALSE(s_results[1]);
+}
+
+void test_mu_string_cuckoo(void) {
+    TEST_ASSERT_EQUAL_PTR(&s_cuckoo, mu_string_cuckoo_init(&s_cuckoo, s_cuckoo_slots,
+                                                           CUCKOO_SLOTS));
+    for (size_t i = 0; i < N_KEYS; i++) {
+        TEST_ASSERT_TRUE(mu_string_cuckoo_add(&s_cuckoo, s_keys[i]));
+    }
+    TEST_ASSERT_EQUAL_size_t(N_KEYS, mu_string_cuckoo_count(&s_cuckoo));
+    for (size_t i = 0; i < N_KEYS; i++) {
+        TEST_ASSERT_TRUE(mu_string_cuckoo_may_contain(&s_cuckoo, s_keys[i]));
+    }
+    size_t false_positives = 0;
+    for (size_t i = 0; i < N_PROBES; i++) {
+        false_positives += mu_string_cuckoo_may_contain(&s_cuckoo, s_probes[i]);
+    }
+    TEST_ASSERT_LESS_THAN(10, false_positives); // ~0.6 expected
+
+    // Remove the even keys; the odd ones are still all present.
+    for (size_t i = 0; i < N_KEYS; i += 2) {
+        TEST_ASSERT_TRUE(mu_string_cuckoo_remove(&s_cuckoo, s_keys[i]));
+    }
+    TEST_ASSERT_EQUAL_size_t(N_KEYS / 2, mu_string_cuckoo_count(&s_cuckoo));
+    size_t still_present = 0;
+    for (size_t i = 0; i < N_KEYS; i++) {
+        bool hit = mu_string_cuckoo_may_contain(&s_cuckoo, s_keys[i]);
+        if (i % 2) {
+            TEST_ASSERT_TRUE(hit);
+        } else {
+            still_present += hit;
+        }
+    }
+    TEST_ASSERT_LESS_THAN(5, still_present);
+
+    // Duplicates are counted.
+    mu_string_t dup = MU_STR_LITERAL("dup");
+    mu_string_cuckoo_add(&s_cuckoo, dup);
+    mu_string_cuckoo_add(&s_cuckoo, dup);
+    TEST_ASSERT_TRUE(mu_string_cuckoo_remove(&s_cuckoo, dup));
+    TEST_ASSERT_TRUE(mu_string_cuckoo_may_contain(&s_cuckoo, dup));
+    TEST_ASSERT_TRUE(mu_string_cuckoo_remove(&s_cuckoo, dup));
+    TEST_ASSERT_FALSE(mu_string_cuckoo_remove(&s_cuckoo, dup));
+
+    TEST_ASSERT_NULL(mu_string_cuckoo_init(&s_cuckoo, s_cuckoo_slots, 0));
+    TEST_ASSERT_NULL(mu_string_cuckoo_init(&s_cuckoo, s_cuckoo_slots, 6));
+    TEST_ASSERT_NULL(mu_string_cuckoo_init(&s_cuckoo, s_cuckoo_slots, 12));
+    TEST_ASSERT_NULL(mu_string_cuckoo_init(&s_cuckoo, NULL, CUCKOO_SLOTS));
+    TEST_ASSERT_FALSE(mu_string_cuckoo_add(&s_cuckoo, MU_STRING_INVALID));
+}
+
+void test_mu_string_cuckoo_full(void) {
+    mu_string_cuckoo_init(&s_cuckoo, s_cuckoo_slots, 64);
+
+    size_t added = mu_string_cuckoo_add_batch(&s_cuckoo, s_keys, N_KEYS);
+    TEST_ASSERT_GREATER_THAN(48, added); // at least 75% load
+    TEST_ASSERT_LESS_OR_EQUAL(65, added);  // 64 slots and the victim
+    TEST_ASSERT_EQUAL_size_t(added, mu_string_cuckoo_count(&s_cuckoo));
+    TEST_ASSERT_FALSE(mu_string_cuckoo_add(&s_cuckoo, s_keys[added]));
+
+    // Nothing that was added was lost on the way to full.
+    TEST_ASSERT_EQUAL_size_t(added, mu_string_cuckoo_query_batch(
+                                        &s_cuckoo, s_keys, added, s_results));
+
+    // Removing a key makes room again.
+    TEST_ASSERT_TRUE(mu_string_cuckoo_remove(&s_cuckoo, s_keys[0]));
+    TEST_ASSERT_TRUE(mu_string_cuckoo_add(&s_cuckoo, s_keys[added]));
+    for (size_t i = 1; i <= added; i++) {
+        TEST_ASSERT_TRUE(mu_string_cuckoo_may_contain(&s_cuckoo, s_keys[i]));
+    }
+}
+
+// *****************************************************************************
+// Private (static) code
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_filter.c");
+
+    RUN_TEST(test_mu_string_hash64);
+    RUN_TEST(test_mu_string_bloom);
+    RUN_TEST(test_mu_string_bloom_batch);
+    RUN_TEST(test_mu_string_cuckoo);
+    RUN_TEST(test_mu_string_cuckoo_full);
+
+    return UnityEnd();
+}
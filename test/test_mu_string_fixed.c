@@ -0,0 +1,165 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_fixed.c
+ *
+ * @brief Unit tests for the mu_string_fixed module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_fixed.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define HAYSTACK_LEN 200
+
+// *****************************************************************************
+// Private (static) storage
+
+static char s_haystack[HAYSTACK_LEN];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Asserts that mu_string_find_fixed() and mu_string_find_str() agree.
+ */
+static void assert_same_as_find_str(mu_string_t haystack, mu_string_t needle);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_mu_string_find_fixed_literals(void) {
+    mu_string_t request = MU_STR_LITERAL("GET / HTTP/1.1\r\nHost: x\r\n\r\nbody");
+    mu_string_t end = MU_STRING_FIND_FIXED(request, "\r\n\r\n");
+    TEST_ASSERT_EQUAL_PTR(&request.buf[23], end.buf);
+    TEST_ASSERT_EQUAL_size_t(request.len - 23, end.len);
+
+    mu_string_t log = MU_STR_LITERAL("INFO ok\nWARN disk\nERROR: disk full\n");
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("ERROR: disk full\n"),
+                                  MU_STRING_FIND_FIXED(log, "ERROR")));
+    TEST_ASSERT_EQUAL_size_t(0, MU_STRING_FIND_FIXED(log, "FATAL").len);
+    TEST_ASSERT_TRUE(mu_string_eq(log, MU_STRING_FIND_FIXED(log, "")));
+    TEST_ASSERT_EQUAL_size_t(
+        log.len - 25, MU_STRING_FIND_FIXED(log, "disk full\n").len);
+    TEST_ASSERT_EQUAL_size_t(0, MU_STRING_FIND_FIXED(log, "0123456789abcdef").len);
+
+    // Embedded NUL bytes are part of the needle.
+    mu_string_t bin = { .buf = "ab\0cd\0ef", .len = 8 };
+    TEST_ASSERT_EQUAL_size_t(6, MU_STRING_FIND_FIXED(bin, "\0cd").len);
+
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX,
+                             MU_STRING_FIND_FIXED(MU_STRING_INVALID, "x").len);
+    TEST_ASSERT_EQUAL_size_t(0, MU_STRING_FIND_FIXED(MU_STRING_EMPTY, "x").len);
+
+    // Only string literals are accepted: a pointer would give sizeof(char *)
+    // rather than the needle length.  `make compile_fail` builds the block
+    // below and expects it to be rejected.
+#ifdef MU_STRING_FIXED_COMPILE_FAIL
+    const char *needle = "\r\n\r\n";
+    (void)MU_STRING_FIND_FIXED(request, needle);
+#endif
+}
+
+void test_mu_string_find_fixed_matches_find_str(void) {
+    // A small alphabet makes partial matches common.
+    srand(7);
+    for (int round = 0; round < 200; round++) {
+        for (size_t i = 0; i < HAYSTACK_LEN; i++) {
+            s_haystack[i] = "ab\xff"[rand() % 3];
+        }
+        size_t hay_len = (size_t)(rand() % HAYSTACK_LEN);
+        mu_string_t haystack = { .buf = s_haystack, .len = hay_len };
+        for (size_t n = 0; n <= MU_STRING_FIXED_MAX_LEN; n++) {
+            char needle[MU_STRING_FIXED_MAX_LEN];
+            if (hay_len >= n && rand() % 2) {
+                memcpy(needle, &s_haystack[(size_t)rand() % (hay_len - n + 1)], n);
+            } else {
+                for (size_t k = 0; k < n; k++) {
+                    needle[k] = "ab\xff"[rand() % 3];
+                }
+            }
+            assert_same_as_find_str(haystack, mu_string_from_buf(needle, n));
+        }
+    }
+}
+
+void test_mu_string_find_fixed_bounds(void) {
+    // Matches at the very end of a buffer on the heap: under a sanitizer,
+    // any read past the haystack is reported.
+    for (size_t len = 1; len <= 40; len++) {
+        char *buf = malloc(len);
+        memset(buf, 'a', len);
+        buf[len - 1] = 'z';
+        mu_string_t haystack = { .buf = buf, .len = len };
+        for (size_t n = 1; n <= MU_STRING_FIXED_MAX_LEN && n <= len; n++) {
+            mu_string_t needle = { .buf = &buf[len - n], .len = n };
+            mu_string_t hit = mu_string_find_fixed(
+                haystack, mu_string_fixed_make(needle.buf, needle.len));
+            TEST_ASSERT_EQUAL_PTR(&buf[len - n], hit.buf);
+        }
+        free(buf);
+    }
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static void assert_same_as_find_str(mu_string_t haystack, mu_string_t needle) {
+    mu_string_t expected = mu_string_find_str(haystack, needle);
+    mu_string_t actual =
+        mu_string_find_fixed(haystack, mu_string_fixed_make(needle.buf, needle.len));
+    TEST_ASSERT_EQUAL_size_t(expected.len, actual.len);
+    if (expected.len > 0) {
+        TEST_ASSERT_EQUAL_PTR(expected.buf, actual.buf);
+    }
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_fixed.c");
+
+    RUN_TEST(test_mu_string_find_fixed_literals);
+    RUN_TEST(test_mu_string_find_fixed_matches_find_str);
+    RUN_TEST(test_mu_string_find_fixed_bounds);
+
+    return UnityEnd();
+}
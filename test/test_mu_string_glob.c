@@ -0,0 +1,153 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_glob.c
+ *
+ * @brief Unit tests for the mu_string_glob module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_glob.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_string_glob_t s_glob;
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static bool glob_match(const char *pattern, const char *s);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_glob, 0, sizeof(s_glob));
+}
+
+void tearDown(void) {}
+
+void test_mu_string_glob_literal(void) {
+    TEST_ASSERT_TRUE(glob_match("abc", "abc"));
+    TEST_ASSERT_FALSE(glob_match("abc", "abcd"));
+    TEST_ASSERT_FALSE(glob_match("abc", "ab"));
+    TEST_ASSERT_TRUE(glob_match("", ""));
+    TEST_ASSERT_FALSE(glob_match("", "a"));
+}
+
+void test_mu_string_glob_star(void) {
+    TEST_ASSERT_TRUE(glob_match("*", ""));
+    TEST_ASSERT_TRUE(glob_match("*", "anything"));
+    TEST_ASSERT_TRUE(glob_match("**", "x"));
+    TEST_ASSERT_TRUE(glob_match("*.log", "app.log"));
+    TEST_ASSERT_FALSE(glob_match("*.log", "app.log.1"));
+    TEST_ASSERT_TRUE(glob_match("app.*", "app.log"));
+    TEST_ASSERT_TRUE(glob_match("a*b*c", "abc"));
+    TEST_ASSERT_TRUE(glob_match("a*b*c", "aXXbYYbZZc"));
+    TEST_ASSERT_FALSE(glob_match("a*b*c", "aXXcYYb"));
+    TEST_ASSERT_TRUE(glob_match("*ab*ab*", "abab"));
+    TEST_ASSERT_FALSE(glob_match("*ab*ab*", "aba"));
+    // Anchored ends must not overlap
+    TEST_ASSERT_FALSE(glob_match("ab*ba", "aba"));
+    TEST_ASSERT_TRUE(glob_match("ab*ba", "abba"));
+
+    // Pathological for backtracking matchers
+    TEST_ASSERT_FALSE(glob_match("a*a*a*a*a*a*a*b", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
+    TEST_ASSERT_TRUE(glob_match("a*a*a*a*a*a*a*b", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"));
+}
+
+void test_mu_string_glob_question_and_class(void) {
+    TEST_ASSERT_TRUE(glob_match("?", "x"));
+    TEST_ASSERT_FALSE(glob_match("?", ""));
+    TEST_ASSERT_TRUE(glob_match("user-??", "user-42"));
+    TEST_ASSERT_TRUE(glob_match("*-[0-9][0-9]", "host-07"));
+    TEST_ASSERT_FALSE(glob_match("*-[0-9][0-9]", "host-7a"));
+    TEST_ASSERT_TRUE(glob_match("[!a-c]x", "dx"));
+    TEST_ASSERT_FALSE(glob_match("[^a-c]x", "bx"));
+    TEST_ASSERT_TRUE(glob_match("[]]", "]"));
+    TEST_ASSERT_TRUE(glob_match("[a-]", "-"));
+    TEST_ASSERT_TRUE(glob_match("*[*]*", "a*b"));
+    TEST_ASSERT_TRUE(glob_match("*?x?*", "abxcd"));
+    TEST_ASSERT_FALSE(glob_match("*?x?*", "x"));
+}
+
+void test_mu_string_glob_escape(void) {
+    TEST_ASSERT_TRUE(glob_match("a\\*b", "a*b"));
+    TEST_ASSERT_FALSE(glob_match("a\\*b", "aXb"));
+    TEST_ASSERT_TRUE(glob_match("*\\?", "why?"));
+    TEST_ASSERT_FALSE(glob_match("*\\?", "why"));
+}
+
+void test_mu_string_glob_compile(void) {
+    TEST_ASSERT_EQUAL_PTR(&s_glob, mu_string_glob_compile(&s_glob, MU_STR_LITERAL("img-*.png")));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("img-"), mu_string_glob_prefix(&s_glob)));
+    TEST_ASSERT_EQUAL_size_t(8, s_glob.min_len);
+
+    mu_string_glob_compile(&s_glob, MU_STR_LITERAL("*.png"));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_glob_prefix(&s_glob).len);
+    mu_string_glob_compile(&s_glob, MU_STR_LITERAL("ab?d*"));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("ab"), mu_string_glob_prefix(&s_glob)));
+
+    TEST_ASSERT_NULL(mu_string_glob_compile(&s_glob, MU_STR_LITERAL("[abc")));
+    TEST_ASSERT_NULL(mu_string_glob_compile(&s_glob, MU_STR_LITERAL("abc\\")));
+    TEST_ASSERT_NULL(mu_string_glob_compile(&s_glob, MU_STR_LITERAL("a*b*c*d*e*f*g*h*i")));
+    TEST_ASSERT_NULL(mu_string_glob_compile(&s_glob, MU_STRING_INVALID));
+    TEST_ASSERT_NULL(mu_string_glob_compile(NULL, MU_STR_LITERAL("a")));
+    TEST_ASSERT_FALSE(mu_string_glob_match(NULL, MU_STR_LITERAL("a")));
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static bool glob_match(const char *pattern, const char *s) {
+    TEST_ASSERT_NOT_NULL_MESSAGE(mu_string_glob_compile(&s_glob, MU_STR_LITERAL(pattern)), pattern);
+    return mu_string_glob_match(&s_glob, MU_STR_LITERAL(s));
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_glob.c");
+
+    RUN_TEST(test_mu_string_glob_literal);
+    RUN_TEST(test_mu_string_glob_star);
+    RUN_TEST(test_mu_string_glob_question_and_class);
+    RUN_TEST(test_mu_string_glob_escape);
+    RUN_TEST(test_mu_string_glob_compile);
+
+    return UnityEnd();
+}
@@ -0,0 +1,245 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_hpp.cpp
+ *
+ * @brief Unit tests for the mu_string C++ wrapper using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_csv.h"
+#include "mu_string.hpp"
+#include "mu_string_fixed.hpp"
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+
+// *****************************************************************************
+// Private types and definitions
+
+using namespace mu::literals;
+
+// The wrapper must cost nothing to pass around or convert.
+static_assert(sizeof(mu::string_view) == sizeof(mu_string_t), "layout");
+static_assert(std::is_trivially_copyable_v<mu::string_view>, "trivial");
+
+// Most of the interface is usable at compile time.
+static_assert("key=value"_mu.find('=') == 3);
+static_assert("key=value"_mu.split_at('=').first == "key"_mu);
+static_assert("  x  "_mu.trim([](char c) { return c == ' '; }) == "x"_mu);
+static_assert("abc"_mu < "abd"_mu && "ab"_mu < "abc"_mu);
+
+// *****************************************************************************
+// Private (static) storage
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_mu_string_hpp_conversions(void) {
+    const char *text = "hello, world";
+    mu_string_t c = mu_string_from_cstr(text);
+
+    mu::string_view v = c;
+    TEST_ASSERT_EQUAL_PTR(text, v.data());
+    TEST_ASSERT_EQUAL_size_t(12, v.size());
+
+    mu_string_t back = v;
+    TEST_ASSERT_TRUE(mu_string_eq(c, back));
+    TEST_ASSERT_EQUAL_PTR(text, back.buf);
+
+    std::string_view sv = v;
+    TEST_ASSERT_EQUAL_PTR(text, sv.data());
+    TEST_ASSERT_TRUE(mu::string_view(sv) == v);
+
+    std::string owned = "hello";
+    TEST_ASSERT_TRUE(mu::string_view(owned) == "hello"_mu);
+    TEST_ASSERT_TRUE(mu::string_view(nullptr, 0).empty());
+    TEST_ASSERT_NOT_NULL(mu::string_view().data());
+
+    // Sentinels become std::nullopt.  (The C sentinel macros are compound
+    // literals, which are not standard C++.)
+    TEST_ASSERT_FALSE(mu::checked(mu_string_t{ nullptr, SIZE_MAX }).has_value());
+    TEST_ASSERT_FALSE(mu::checked(mu_string_t{ nullptr, 0 }).has_value());
+    TEST_ASSERT_TRUE(*mu::checked(c) == v);
+
+    // Views pass straight to the C modules.
+    mu_csv_reader_t reader;
+    mu_string_t fields[4];
+    size_t n_fields;
+    mu_csv_reader_init(&reader, "a,b,c\n"_mu, ',', '"');
+    TEST_ASSERT_EQUAL(MU_CSV_ERR_NONE,
+                      mu_csv_read_record(&reader, fields, 4, &n_fields));
+    TEST_ASSERT_TRUE(mu::string_view(fields[1]) == "b"_mu);
+
+    std::unordered_set<mu::string_view> set = { "a"_mu, "b"_mu };
+    TEST_ASSERT_EQUAL_size_t(1, set.count(mu::string_view(fields[0])));
+}
+
+void test_mu_string_hpp_compare(void) {
+    const char *words[] = { "", "a", "ab", "abc", "abd", "b", "\xff" };
+    for (const char *x : words) {
+        for (const char *y : words) {
+            mu::string_view a = x, b = y;
+            int expected = mu_string_cmp(a, b);
+            int actual = a.compare(b);
+            TEST_ASSERT_EQUAL((expected > 0) - (expected < 0),
+                              (actual > 0) - (actual < 0));
+            TEST_ASSERT_EQUAL(mu_string_eq(a, b), a == b);
+            TEST_ASSERT_EQUAL(mu_string_starts_with(a, b), a.starts_with(b));
+            TEST_ASSERT_EQUAL(mu_string_ends_with(a, b), a.ends_with(b));
+        }
+    }
+    TEST_ASSERT_TRUE("abc"_mu.starts_with('a'));
+    TEST_ASSERT_FALSE(""_mu.ends_with('c'));
+}
+
+void test_mu_string_hpp_find(void) {
+    mu::string_view v = "GET /a/b HTTP/1.1\r\n\r\n";
+    TEST_ASSERT_EQUAL_size_t(3, v.find(' '));
+    TEST_ASSERT_EQUAL_size_t(8, v.find(' ', 4));
+    TEST_ASSERT_EQUAL_size_t(mu::string_view::npos, v.find('?'));
+    TEST_ASSERT_EQUAL_size_t(6, v.rfind('/', 12));
+    TEST_ASSERT_EQUAL_size_t(17, v.find("\r\n\r\n"_mu));
+    TEST_ASSERT_EQUAL_size_t(mu::string_view::npos, v.find("\n\n"_mu));
+    TEST_ASSERT_EQUAL_size_t(5, v.find(""_mu, 5));
+    TEST_ASSERT_EQUAL_size_t(19, v.rfind("\r\n"_mu));
+    TEST_ASSERT_TRUE(v.contains("HTTP"_mu));
+
+    auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    TEST_ASSERT_EQUAL_size_t(14, v.find_if(is_digit));
+    TEST_ASSERT_EQUAL_size_t(16, v.rfind_if(is_digit));
+    TEST_ASSERT_EQUAL_size_t(0, v.find_if_not(is_digit));
+    TEST_ASSERT_EQUAL_size_t(mu::string_view::npos, "123"_mu.find_if_not(is_digit));
+
+    // Same answers as the C search functions.
+    mu_string_t hit = mu_string_find_str(v, "HTTP"_mu);
+    TEST_ASSERT_EQUAL_size_t(hit.buf - v.data(), v.find("HTTP"_mu));
+}
+
+void test_mu_string_hpp_slice_trim_split(void) {
+    mu::string_view v = "hello world";
+    for (long start = -13; start <= 13; start++) {
+        for (long end = -13; end <= 13; end++) {
+            mu_string_t expected = mu_string_slice(v, (int)start, (int)end);
+            TEST_ASSERT_TRUE(mu_string_eq(expected, v.slice(start, end)));
+        }
+    }
+    TEST_ASSERT_TRUE(v.slice(-5) == "world"_mu);
+    TEST_ASSERT_TRUE(v.substr(6) == "world"_mu);
+    TEST_ASSERT_TRUE(v.substr(20).empty());
+    TEST_ASSERT_TRUE(v.substr(0, 5) == "hello"_mu);
+
+    mu::string_view w = v;
+    w.remove_prefix(6);
+    w.remove_suffix(2);
+    TEST_ASSERT_TRUE(w == "wor"_mu);
+
+    auto is_space = [](char c) { return c == ' ' || c == '\t'; };
+    mu::string_view padded = " \t x y \t";
+    TEST_ASSERT_TRUE(padded.ltrim(is_space) == "x y \t"_mu);
+    TEST_ASSERT_TRUE(padded.rtrim(is_space) == " \t x y"_mu);
+    TEST_ASSERT_TRUE(padded.trim(is_space) == "x y"_mu);
+    TEST_ASSERT_TRUE(" \t "_mu.trim(is_space).empty());
+
+    auto [key, rest] = "name=value"_mu.split_at('=');
+    TEST_ASSERT_TRUE(key == "name"_mu);
+    TEST_ASSERT_TRUE(rest.has_value() && *rest == "=value"_mu);
+    auto [all, none] = "novalue"_mu.split_at('=');
+    TEST_ASSERT_TRUE(all == "novalue"_mu);
+    TEST_ASSERT_FALSE(none.has_value());
+
+    auto [word, tail] = "abc def"_mu.split_if(is_space);
+    TEST_ASSERT_TRUE(word == "abc"_mu && *tail == " def"_mu);
+
+    char buf[4];
+    mu::string_view copied = v.copy_to(mu_string_mut_from_buf(buf, sizeof(buf)));
+    TEST_ASSERT_TRUE(copied == "hell"_mu);
+    TEST_ASSERT_EQUAL_PTR(buf, copied.data());
+
+    // Overlapping source and destination, as mu_string_copy().
+    char shift[] = "abcdef";
+    mu::string_view moved = mu::string_view(shift, 4).copy_to(
+        mu_string_mut_from_buf(shift + 2, 4));
+    TEST_ASSERT_TRUE(moved == "abcd"_mu);
+    TEST_ASSERT_EQUAL_STRING("ababcd", shift);
+
+    char line[8];
+    mu_string_mut_t space = mu_string_mut_from_buf(line, sizeof(line));
+    space = "key"_mu.append_to(space);
+    space = "=value"_mu.append_to(space);
+    TEST_ASSERT_EQUAL_size_t(0, space.len);
+    TEST_ASSERT_TRUE(mu::string_view(line, sizeof(line)) == "key=valu"_mu);
+}
+
+void test_mu_string_hpp_fixed_searcher(void) {
+    constexpr mu::fixed_searcher<"\r\n\r\n"> end_of_headers;
+    mu::string_view request = "GET / HTTP/1.1\r\nHost: x\r\n\r\nbody";
+    TEST_ASSERT_EQUAL_size_t(23, end_of_headers.find(request));
+    TEST_ASSERT_EQUAL_size_t(mu::string_view::npos, end_of_headers.find("a\r\n\r"_mu));
+    TEST_ASSERT_TRUE(end_of_headers.needle() == "\r\n\r\n"_mu);
+
+    // Agrees with the runtime search for every length.
+    const char *text = "the quick brown fox jumps over the lazy dog";
+    mu::string_view hay = text;
+    TEST_ASSERT_EQUAL_size_t(hay.find("o"_mu), mu::fixed_searcher<"o">().find(hay));
+    TEST_ASSERT_EQUAL_size_t(hay.find("he"_mu), mu::fixed_searcher<"he">().find(hay));
+    TEST_ASSERT_EQUAL_size_t(hay.find("the l"_mu), mu::fixed_searcher<"the l">().find(hay));
+    TEST_ASSERT_EQUAL_size_t(hay.find(" jumps over"_mu),
+                             mu::fixed_searcher<" jumps over">().find(hay));
+    TEST_ASSERT_EQUAL_size_t(hay.find("over the lazy do"_mu),
+                             mu::fixed_searcher<"over the lazy do">().find(hay));
+    TEST_ASSERT_EQUAL_size_t(0, mu::fixed_searcher<"">().find(hay));
+    TEST_ASSERT_FALSE(mu::fixed_searcher<"cat">().contains(hay));
+
+    const char *hit = std::search(text, text + hay.size(), mu::fixed_searcher<"fox">());
+    TEST_ASSERT_EQUAL_PTR(&text[16], hit);
+}
+
+// *****************************************************************************
+// Private (static) code
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_hpp.cpp");
+
+    RUN_TEST(test_mu_string_hpp_conversions);
+    RUN_TEST(test_mu_string_hpp_compare);
+    RUN_TEST(test_mu_string_hpp_find);
+    RUN_TEST(test_mu_string_hpp_slice_trim_split);
+    RUN_TEST(test_mu_string_hpp_fixed_searcher);
+
+    return UnityEnd();
+}
@@ -0,0 +1,198 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_index.c
+ *
+ * @brief Unit tests for the mu_string_index module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_index.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define CORPUS_MAX 4096
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_string_index_t s_index;
+static uint32_t s_sa[MU_STRING_INDEX_SA_LEN(CORPUS_MAX)];
+static uint32_t s_work[MU_STRING_INDEX_WORK_LEN(CORPUS_MAX)];
+static char s_corpus[CORPUS_MAX];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static void build(mu_string_t corpus);
+static void assert_sorted(void);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_index, 0, sizeof(s_index));
+}
+
+void tearDown(void) {}
+
+void test_mu_string_index_build(void) {
+    build(MU_STR_LITERAL("banana"));
+    // Suffixes in order: a, ana, anana, banana, na, nana.
+    static const uint32_t expected[] = { 5, 3, 1, 0, 4, 2 };
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, s_index.sa, 6);
+
+    build(MU_STR_LITERAL("mississippi"));
+    assert_sorted();
+    build(MU_STR_LITERAL("aaaaaaaaaaaaaaaa"));
+    assert_sorted();
+
+    // Bytes 0x00 and 0xFF sort as unsigned, and a prefix sorts before the
+    // longer suffix.
+    memcpy(s_corpus, "\xff\x00\xff\x00\x01\xff", 6);
+    build((mu_string_t){ .buf = s_corpus, .len = 6 });
+    assert_sorted();
+
+    build(MU_STRING_EMPTY);
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_index_count(&s_index, MU_STR_LITERAL("a")));
+}
+
+void test_mu_string_index_larger_corpus(void) {
+    // A repetitive corpus forces several levels of recursion.
+    for (size_t i = 0; i < CORPUS_MAX; i++) {
+        s_corpus[i] = "abcab"[(i % 5 + i / 997) % 5];
+    }
+    build((mu_string_t){ .buf = s_corpus, .len = CORPUS_MAX });
+    assert_sorted();
+
+    // Counts agree with a scan using mu_string_find_str().
+    static const char *needles[] = { "a", "ab", "bca", "cabab", "aa", "zz" };
+    for (size_t k = 0; k < sizeof(needles) / sizeof(needles[0]); k++) {
+        mu_string_t needle = MU_STR_LITERAL(needles[k]);
+        mu_string_t rest = { .buf = s_corpus, .len = CORPUS_MAX };
+        size_t expected = 0;
+        for (;;) {
+            mu_string_t hit = mu_string_find_str(rest, needle);
+            if (hit.len == 0) {
+                break;
+            }
+            expected += 1;
+            rest = (mu_string_t){ .buf = hit.buf + 1, .len = hit.len - 1 };
+        }
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(expected, mu_string_index_count(&s_index, needle), needles[k]);
+    }
+}
+
+void test_mu_string_index_queries(void) {
+    const char *text = "the cat sat on the mat with the hat";
+    build(MU_STR_LITERAL(text));
+
+    TEST_ASSERT_EQUAL_size_t(3, mu_string_index_count(&s_index, MU_STR_LITERAL("the ")));
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_index_count(&s_index, MU_STR_LITERAL("at")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_index_count(&s_index, MU_STR_LITERAL("dog")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_index_count(&s_index, MU_STR_LITERAL("hat!")));
+    TEST_ASSERT_EQUAL_size_t(strlen(text), mu_string_index_count(&s_index, MU_STRING_EMPTY));
+
+    mu_string_t r = mu_string_index_find(&s_index, MU_STR_LITERAL("mat"));
+    TEST_ASSERT_EQUAL_PTR(strstr(text, "mat"), r.buf);
+    TEST_ASSERT_EQUAL_size_t(3, r.len);
+    r = mu_string_index_find(&s_index, MU_STR_LITERAL("dog"));
+    TEST_ASSERT_NULL(r.buf);
+
+    mu_string_t results[8];
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_index_find_all(&s_index, MU_STR_LITERAL("at"), results, 8));
+    bool seen[4] = { false };
+    static const size_t offsets[] = { 5, 9, 20, 33 };
+    for (size_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("at"), results[i]));
+        size_t off = (size_t)(results[i].buf - text);
+        for (size_t k = 0; k < 4; k++) {
+            if (offsets[k] == off) {
+                seen[k] = true;
+            }
+        }
+    }
+    TEST_ASSERT_TRUE(seen[0] && seen[1] && seen[2] && seen[3]);
+
+    // The total is reported even when the array is too small.
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_index_find_all(&s_index, MU_STR_LITERAL("at"), results, 1));
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_index_find_all(&s_index, MU_STR_LITERAL("at"), NULL, 0));
+}
+
+void test_mu_string_index_invalid(void) {
+    mu_string_t corpus = MU_STR_LITERAL("abracadabra");
+    TEST_ASSERT_NULL(mu_string_index_build(NULL, corpus, s_sa, s_work, 400));
+    TEST_ASSERT_NULL(mu_string_index_build(&s_index, MU_STRING_INVALID, s_sa, s_work, 400));
+    TEST_ASSERT_NULL(mu_string_index_build(&s_index, corpus, NULL, s_work, 400));
+    TEST_ASSERT_NULL(mu_string_index_build(&s_index, corpus, s_sa, s_work, 1));
+
+    build(corpus);
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_index_count(NULL, MU_STR_LITERAL("a")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_index_count(&s_index, MU_STRING_INVALID));
+    TEST_ASSERT_FALSE(mu_string_is_valid(mu_string_index_find(&s_index, MU_STRING_INVALID)));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_index_find_all(&s_index, MU_STR_LITERAL("a"), NULL, 1));
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static void build(mu_string_t corpus) {
+    TEST_ASSERT_EQUAL_PTR(&s_index, mu_string_index_build(&s_index, corpus, s_sa, s_work,
+                                                          MU_STRING_INDEX_WORK_LEN(corpus.len)));
+}
+
+static void assert_sorted(void) {
+    const mu_string_t corpus = s_index.corpus;
+    for (size_t i = 1; i < corpus.len; i++) {
+        size_t a = s_index.sa[i - 1];
+        size_t b = s_index.sa[i];
+        mu_string_t sa = { .buf = &corpus.buf[a], .len = corpus.len - a };
+        mu_string_t sb = { .buf = &corpus.buf[b], .len = corpus.len - b };
+        TEST_ASSERT_TRUE(mu_string_cmp(sa, sb) < 0);
+    }
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_index.c");
+
+    RUN_TEST(test_mu_string_index_build);
+    RUN_TEST(test_mu_string_index_larger_corpus);
+    RUN_TEST(test_mu_string_index_queries);
+    RUN_TEST(test_mu_string_index_invalid);
+
+    return UnityEnd();
+}
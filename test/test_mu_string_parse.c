@@ -0,0 +1,239 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_parse.c
+ *
+ * @brief Unit tests for the mu_string_parse module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_parse.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define NS 1000000000LL
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_string_timestamp_t s_ts;
+static mu_string_t s_rest;
+static uint8_t s_addr[16];
+static char s_text[64];
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_ts, 0, sizeof(s_ts));
+    s_rest = MU_STRING_INVALID;
+}
+
+void tearDown(void) {}
+
+void test_mu_string_parse_iso8601(void) {
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("2024-02-29T13:45:30Z level=info"), &s_ts, &s_rest));
+    TEST_ASSERT_EQUAL_INT64(1709214330LL * NS, s_ts.epoch_ns);
+    TEST_ASSERT_EQUAL_INT(0, s_ts.offset_minutes);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(" level=info"), s_rest));
+
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("1999-12-31 23:59:59.123456789-05:00"), &s_ts, &s_rest));
+    TEST_ASSERT_EQUAL_INT64(946702799LL * NS + 123456789, s_ts.epoch_ns);
+    TEST_ASSERT_EQUAL_INT(-300, s_ts.offset_minutes);
+    TEST_ASSERT_EQUAL_size_t(0, s_rest.len);
+
+    // Offset without colon, fraction longer than nanoseconds, pre-epoch
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("1969-07-20t20:17:40.5000000001+0530"), &s_ts, NULL));
+    TEST_ASSERT_EQUAL_INT64(-14202740LL * NS + 500000000, s_ts.epoch_ns);
+    TEST_ASSERT_EQUAL_INT(330, s_ts.offset_minutes);
+
+    // Date only
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("2025-01-01,next"), &s_ts, &s_rest));
+    TEST_ASSERT_EQUAL_INT64(1735689600LL * NS, s_ts.epoch_ns);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(",next"), s_rest));
+
+    // A space not followed by hh:mm:ss ends a date-only timestamp
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("2024-01-15 ok"), &s_ts, &s_rest));
+    TEST_ASSERT_EQUAL_INT64(1705276800LL * NS, s_ts.epoch_ns);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(" ok"), s_rest));
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("2024-01-15 status=ok"), &s_ts, &s_rest));
+    TEST_ASSERT_EQUAL_INT64(1705276800LL * NS, s_ts.epoch_ns);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(" status=ok"), s_rest));
+
+    // No offset: treated as UTC
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("2024-02-29T13:45:30"), &s_ts, &s_rest));
+    TEST_ASSERT_EQUAL_INT64(1709214330LL * NS, s_ts.epoch_ns);
+
+    // Leap second rolls into the next minute
+    TEST_ASSERT_TRUE(mu_string_parse_iso8601(MU_STR_LITERAL("2016-12-31T23:59:60Z"), &s_ts, NULL));
+    TEST_ASSERT_EQUAL_INT64(1483228800LL * NS, s_ts.epoch_ns);
+}
+
+void test_mu_string_parse_iso8601_errors(void) {
+    const char *bad[] = {
+        "2024-02-30T00:00:00Z", // no such day
+        "2023-02-29",           // not a leap year
+        "2024-13-01",           // no such month
+        "2024-01-01T24:00:00Z", // hour out of range
+        "2024-01-01T00:60:00Z", // minute out of range
+        "2024-1-01",            // short field
+        "2024/01/01",           // wrong separator
+        "2024-01-01T00:00:0Z",  // short seconds
+        "2024-01-15T10:30",     // 'T' without seconds
+        "2024-01-15T10:30:0",   // 'T' with truncated seconds
+        "2024-01-15T",          // 'T' with no time
+        "2024-01-15Tnext:xx:yy",// 'T' with malformed time
+        "2024-01-01T00:00:00.Z",// empty fraction
+        "2024-01-01T00:00:00+5",// short offset
+        "0001-01-01",           // out of int64 ns range
+        "abcd-ef-gh",
+        "2024-01",
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i) {
+        s_rest = MU_STRING_EMPTY;
+        TEST_ASSERT_FALSE_MESSAGE(mu_string_parse_iso8601(MU_STR_LITERAL(bad[i]), &s_ts, &s_rest), bad[i]);
+        TEST_ASSERT_EQUAL_PTR(MU_STRING_EMPTY.buf, s_rest.buf);
+    }
+    TEST_ASSERT_FALSE(mu_string_parse_iso8601(MU_STRING_INVALID, &s_ts, NULL));
+    TEST_ASSERT_FALSE(mu_string_parse_iso8601(MU_STR_LITERAL("2024-01-01"), NULL, NULL));
+}
+
+void test_mu_string_parse_ipv4(void) {
+    TEST_ASSERT_TRUE(mu_string_parse_ipv4(MU_STR_LITERAL("192.168.0.255:8080"), s_addr, &s_rest));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(((uint8_t[]){ 192, 168, 0, 255 }), s_addr, 4);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(":8080"), s_rest));
+
+    TEST_ASSERT_TRUE(mu_string_parse_ipv4(MU_STR_LITERAL("0.0.0.0"), s_addr, &s_rest));
+    TEST_ASSERT_EQUAL_size_t(0, s_rest.len);
+
+    const char *bad[] = { "256.1.1.1", "1.2.3", "1.2.3.", "01.2.3.4", "1.2.3.1234",
+                          "1..2.3", "1.2.3.4.5", "a.b.c.d", "" };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i) {
+        TEST_ASSERT_FALSE_MESSAGE(mu_string_parse_ipv4(MU_STR_LITERAL(bad[i]), s_addr, NULL), bad[i]);
+    }
+}
+
+void test_mu_string_parse_ipv6(void) {
+    static const uint8_t loopback[16] = { [15] = 1 };
+    static const uint8_t doc[16] = { 0x20, 0x01, 0x0d, 0xb8, [15] = 0x01 };
+    static const uint8_t mapped[16] = { [10] = 0xff, [11] = 0xff, 10, 1, 2, 3 };
+
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("::1]:443"), s_addr, &s_rest));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(loopback, s_addr, 16);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("]:443"), s_rest));
+
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("2001:DB8::1"), s_addr, NULL));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(doc, s_addr, 16);
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("2001:0db8:0:0:0:0:0:1"), s_addr, NULL));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(doc, s_addr, 16);
+
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("::ffff:10.1.2.3"), s_addr, NULL));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(mapped, s_addr, 16);
+
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("::"), s_addr, &s_rest));
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, s_addr, 16);
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("fe80::1%eth0"), s_addr, &s_rest));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("%eth0"), s_rest));
+
+    const char *bad[] = { ":1", "1:", "1::2::3", "12345::", "1:2:3:4:5:6:7",
+                          "1:2:3:4:5:6:7:8:9", "1:2:3:4:5:6:7::8", "::1.2.3", "g::", "" };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i) {
+        TEST_ASSERT_FALSE_MESSAGE(mu_string_parse_ipv6(MU_STR_LITERAL(bad[i]), s_addr, NULL), bad[i]);
+    }
+}
+
+void test_mu_string_parse_cidr(void) {
+    mu_string_cidr_t cidr;
+
+    TEST_ASSERT_TRUE(mu_string_parse_cidr(MU_STR_LITERAL("10.0.0.0/8 allow"), &cidr, &s_rest));
+    TEST_ASSERT_FALSE(cidr.is_ipv6);
+    TEST_ASSERT_EQUAL_UINT8(8, cidr.prefix_len);
+    TEST_ASSERT_EQUAL_UINT8(10, cidr.addr[0]);
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL(" allow"), s_rest));
+
+    TEST_ASSERT_TRUE(mu_string_parse_cidr(MU_STR_LITERAL("2001:db8::/32"), &cidr, NULL));
+    TEST_ASSERT_TRUE(cidr.is_ipv6);
+    TEST_ASSERT_EQUAL_UINT8(32, cidr.prefix_len);
+
+    TEST_ASSERT_TRUE(mu_string_parse_cidr(MU_STR_LITERAL("::/0"), &cidr, NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, cidr.prefix_len);
+
+    TEST_ASSERT_FALSE(mu_string_parse_cidr(MU_STR_LITERAL("10.0.0.0/33"), &cidr, NULL));
+    TEST_ASSERT_FALSE(mu_string_parse_cidr(MU_STR_LITERAL("::/129"), &cidr, NULL));
+    TEST_ASSERT_FALSE(mu_string_parse_cidr(MU_STR_LITERAL("10.0.0.0"), &cidr, NULL));
+    TEST_ASSERT_FALSE(mu_string_parse_cidr(MU_STR_LITERAL("10.0.0.0/"), &cidr, NULL));
+    TEST_ASSERT_FALSE(mu_string_parse_cidr(MU_STR_LITERAL("10.0.0.0/08"), &cidr, NULL));
+}
+
+void test_mu_string_format_ip(void) {
+    mu_string_mut_t dst = mu_string_mut_from_buf(s_text, sizeof(s_text));
+    const char *v6[] = { "::1", "2001:db8::1", "::", "1::", "2001:db8:0:1:1:1:1:1",
+                         "2001:0:0:1::1", "::ffff:10.1.2.3", "fe80::1:0:0:1" };
+
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("192.168.0.1"),
+                                  mu_string_format_ipv4(dst, (uint8_t[]){ 192, 168, 0, 1 })));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID,
+                                  mu_string_format_ipv4(mu_string_mut_from_buf(s_text, 6), (uint8_t[]){ 1, 2, 3, 4 })));
+
+    // Round-trip canonical forms
+    for (size_t i = 0; i < sizeof(v6) / sizeof(v6[0]); ++i) {
+        TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL(v6[i]), s_addr, NULL));
+        TEST_ASSERT_TRUE_MESSAGE(mu_string_eq(MU_STR_LITERAL(v6[i]), mu_string_format_ipv6(dst, s_addr)), v6[i]);
+    }
+    // Non-canonical input formats canonically
+    TEST_ASSERT_TRUE(mu_string_parse_ipv6(MU_STR_LITERAL("2001:0DB8:0000:0000:0000:0000:0000:0001"), s_addr, NULL));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("2001:db8::1"), mu_string_format_ipv6(dst, s_addr)));
+
+    mu_string_cidr_t cidr;
+    TEST_ASSERT_TRUE(mu_string_parse_cidr(MU_STR_LITERAL("2001:db8::/128"), &cidr, NULL));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("2001:db8::/128"), mu_string_format_cidr(dst, &cidr)));
+    TEST_ASSERT_TRUE(mu_string_parse_cidr(MU_STR_LITERAL("172.16.0.0/12"), &cidr, NULL));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("172.16.0.0/12"), mu_string_format_cidr(dst, &cidr)));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STRING_INVALID, mu_string_format_cidr(MU_STRING_MUT_EMPTY, &cidr)));
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_parse.c");
+
+    RUN_TEST(test_mu_string_parse_iso8601);
+    RUN_TEST(test_mu_string_parse_iso8601_errors);
+    RUN_TEST(test_mu_string_parse_ipv4);
+    RUN_TEST(test_mu_string_parse_ipv6);
+    RUN_TEST(test_mu_string_parse_cidr);
+    RUN_TEST(test_mu_string_format_ip);
+
+    return UnityEnd();
+}
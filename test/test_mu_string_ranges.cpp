@@ -0,0 +1,210 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_ranges.cpp
+ *
+ * @brief Unit tests for the mu_string C++20 split ranges using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_ranges.hpp"
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+// *****************************************************************************
+// Private types and definitions
+
+using namespace mu::literals;
+
+#define MAX_FIELDS 16
+
+static_assert(std::ranges::forward_range<decltype(mu::split(""_mu, ','))>);
+static_assert(std::ranges::view<decltype(mu::split(""_mu, ','))>);
+static_assert(std::ranges::forward_range<decltype(mu::lines(""_mu))>);
+
+// The ranges work at compile time too.
+static_assert(std::ranges::distance(mu::split("a,b,,c"_mu, ',')) == 4);
+static_assert(*mu::lines("x\r\ny"_mu).begin() == "x"_mu);
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu::string_view s_fields[MAX_FIELDS];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Copies the views a range yields into s_fields and returns how many
+ * there were.
+ */
+template <typename Range> static size_t collect(Range &&range);
+
+static bool is_space(char ch, void *arg);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_mu_string_ranges_split(void) {
+    TEST_ASSERT_EQUAL_size_t(4, collect(mu::split("a,,b,"_mu, ',')));
+    TEST_ASSERT_TRUE(s_fields[0] == "a"_mu);
+    TEST_ASSERT_TRUE(s_fields[1].empty());
+    TEST_ASSERT_TRUE(s_fields[2] == "b"_mu);
+    TEST_ASSERT_TRUE(s_fields[3].empty());
+
+    TEST_ASSERT_EQUAL_size_t(1, collect(mu::split(""_mu, ',')));
+    TEST_ASSERT_TRUE(s_fields[0].empty());
+    TEST_ASSERT_EQUAL_size_t(1, collect(mu::split("abc"_mu, ',')));
+    TEST_ASSERT_TRUE(s_fields[0] == "abc"_mu);
+
+    // Same fields as repeated mu_string_split_at_char().
+    const char *inputs[] = { "", ",", "a", "a,b", ",a,", "a,,b,,", "k=v,x=y" };
+    for (const char *input : inputs) {
+        size_t n = collect(mu::split(input, ','));
+        mu_string_t rest = mu_string_from_cstr(input);
+        size_t i = 0;
+        for (;;) {
+            mu_string_t after;
+            mu_string_t field = mu_string_split_at_char(rest, &after, ',');
+            TEST_ASSERT_LESS_THAN(n, i);
+            TEST_ASSERT_TRUE(mu_string_eq(field, s_fields[i]));
+            TEST_ASSERT_EQUAL_PTR(field.buf, s_fields[i].data());
+            i += 1;
+            if (after.buf == NULL) {
+                break;
+            }
+            rest = mu_string_t{ after.buf + 1, after.len - 1 }; // skip ','
+        }
+        TEST_ASSERT_EQUAL_size_t(n, i);
+    }
+}
+
+void test_mu_string_ranges_split_if(void) {
+    auto is_sep = [](char c) { return c == ' ' || c == '\t'; };
+    TEST_ASSERT_EQUAL_size_t(4, collect(mu::split_if("GET  /\tx"_mu, is_sep)));
+    TEST_ASSERT_TRUE(s_fields[0] == "GET"_mu);
+    TEST_ASSERT_TRUE(s_fields[1].empty());
+    TEST_ASSERT_TRUE(s_fields[2] == "/"_mu);
+    TEST_ASSERT_TRUE(s_fields[3] == "x"_mu);
+
+    // Tokenizing: drop the empty fields between runs of separators.
+    auto tokens = mu::split_if("  one two   three "_mu, is_sep) |
+                  std::views::filter([](mu::string_view f) { return !f.empty(); });
+    TEST_ASSERT_EQUAL_size_t(3, collect(tokens));
+    TEST_ASSERT_TRUE(s_fields[2] == "three"_mu);
+
+    // Same split point as mu_string_split_by_pred().
+    mu::string_view line = "key value";
+    mu_string_t after;
+    mu_string_t head = mu_string_split_by_pred(line, &after, is_space, NULL);
+    TEST_ASSERT_TRUE(*mu::split_if(line, is_sep).begin() == mu::string_view(head));
+
+    // A capturing predicate.
+    char delim = ';';
+    TEST_ASSERT_EQUAL_size_t(
+        3, collect(mu::split_if("a;b;c"_mu, [delim](char c) { return c == delim; })));
+}
+
+void test_mu_string_ranges_lines(void) {
+    TEST_ASSERT_EQUAL_size_t(4, collect(mu::lines("one\r\ntwo\n\nthree"_mu)));
+    TEST_ASSERT_TRUE(s_fields[0] == "one"_mu);
+    TEST_ASSERT_TRUE(s_fields[1] == "two"_mu);
+    TEST_ASSERT_TRUE(s_fields[2].empty());
+    TEST_ASSERT_TRUE(s_fields[3] == "three"_mu);
+    TEST_ASSERT_EQUAL_size_t(4, collect(mu::lines("one\r\ntwo\n\nthree\r\n"_mu)));
+    TEST_ASSERT_TRUE(s_fields[3] == "three"_mu);
+    TEST_ASSERT_EQUAL_size_t(2, collect(mu::lines("one\n\n"_mu)));
+
+    TEST_ASSERT_EQUAL_size_t(0, collect(mu::lines(""_mu)));
+    TEST_ASSERT_EQUAL_size_t(1, collect(mu::lines("\n"_mu)));
+    TEST_ASSERT_TRUE(s_fields[0].empty());
+    TEST_ASSERT_EQUAL_size_t(1, collect(mu::lines("\r\n"_mu)));
+    TEST_ASSERT_EQUAL_size_t(1, collect(mu::lines("bare\r"_mu)));
+    TEST_ASSERT_TRUE(s_fields[0] == "bare"_mu);
+}
+
+void test_mu_string_ranges_iterators(void) {
+    const char *text = "a,b,c";
+    auto fields = mu::split(text, ',');
+    auto it = fields.begin();
+    auto copy = it;
+    TEST_ASSERT_TRUE(it == copy);
+    TEST_ASSERT_TRUE(*it++ == "a"_mu);
+    TEST_ASSERT_TRUE(it != copy);
+    TEST_ASSERT_TRUE(*copy == "a"_mu); // forward: copies are independent
+    ++it;
+    TEST_ASSERT_TRUE(*it == "c"_mu);
+    ++it;
+    TEST_ASSERT_TRUE(it == fields.end());
+
+    // Multi-pass, and usable with the standard algorithms.
+    TEST_ASSERT_EQUAL(3, std::ranges::distance(fields));
+    TEST_ASSERT_EQUAL(3, std::ranges::distance(fields));
+    auto found = std::ranges::find(fields, "b"_mu);
+    TEST_ASSERT_TRUE(found != fields.end());
+    TEST_ASSERT_EQUAL_PTR(&text[2], (*found).data());
+    TEST_ASSERT_FALSE(fields.empty());
+}
+
+// *****************************************************************************
+// Private (static) code
+
+template <typename Range> static size_t collect(Range &&range) {
+    size_t n = 0;
+    for (mu::string_view field : range) {
+        if (n < MAX_FIELDS) {
+            s_fields[n] = field;
+        }
+        n += 1;
+    }
+    return n;
+}
+
+static bool is_space(char ch, void *arg) {
+    (void)arg;
+    return ch == ' ' || ch == '\t';
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_ranges.cpp");
+
+    RUN_TEST(test_mu_string_ranges_split);
+    RUN_TEST(test_mu_string_ranges_split_if);
+    RUN_TEST(test_mu_string_ranges_lines);
+    RUN_TEST(test_mu_string_ranges_iterators);
+
+    return UnityEnd();
+}
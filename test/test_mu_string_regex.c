@@ -0,0 +1,266 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_regex.c
+ *
+ * @brief Unit tests for the mu_string_regex module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_regex.h"
+#include "mu_string.h"
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+// *****************************************************************************
+// Private (static) storage
+
+static mu_string_regex_t s_re;
+static mu_string_regex_cache_t s_cache;
+static mu_string_t s_groups[MU_STRING_REGEX_MAX_GROUPS + 1];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static bool find(const char *pattern, const char *s);
+static void assert_group(size_t g, const char *expected);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_re, 0, sizeof(s_re));
+    memset(&s_cache, 0, sizeof(s_cache));
+    memset(s_groups, 0, sizeof(s_groups));
+}
+
+void tearDown(void) {}
+
+void test_mu_string_regex_literal_and_classes(void) {
+    TEST_ASSERT_TRUE(find("abc", "xxabcxx"));
+    assert_group(0, "abc");
+    TEST_ASSERT_FALSE(find("abc", "ab"));
+    TEST_ASSERT_TRUE(find("", ""));
+    assert_group(0, "");
+
+    TEST_ASSERT_TRUE(find("a.c", "a-c"));
+    TEST_ASSERT_FALSE(find("a.c", "a\nc"));
+    TEST_ASSERT_TRUE(find("[0-9a-f]+", "zz1f9q"));
+    assert_group(0, "1f9");
+    TEST_ASSERT_TRUE(find("[^ ]+", "  word "));
+    assert_group(0, "word");
+    TEST_ASSERT_TRUE(find("[]a]+", "x]a]"));
+    assert_group(0, "]a]");
+    TEST_ASSERT_TRUE(find("\\d+\\.\\d+", "v=12.50"));
+    assert_group(0, "12.50");
+    TEST_ASSERT_TRUE(find("\\w+\\s*=\\s*\\S+", "  key =  val ue"));
+    assert_group(0, "key =  val");
+    TEST_ASSERT_TRUE(find("\\x41\\t", "zA\t"));
+    assert_group(0, "A\t");
+}
+
+void test_mu_string_regex_alternation_and_repetition(void) {
+    // Leftmost-first: the earliest start wins, then the first alternative.
+    TEST_ASSERT_TRUE(find("b|ab", "xab"));
+    assert_group(0, "ab");
+    TEST_ASSERT_TRUE(find("a|ab", "ab"));
+    assert_group(0, "a");
+    TEST_ASSERT_TRUE(find("ab|a", "ab"));
+    assert_group(0, "ab");
+
+    TEST_ASSERT_TRUE(find("a*", "aaab"));
+    assert_group(0, "aaa");
+    TEST_ASSERT_TRUE(find("a*?", "aaab"));
+    assert_group(0, "");
+    TEST_ASSERT_TRUE(find("<.+>", "<a><b>"));
+    assert_group(0, "<a><b>");
+    TEST_ASSERT_TRUE(find("<.+?>", "<a><b>"));
+    assert_group(0, "<a>");
+    TEST_ASSERT_TRUE(find("colou?r", "color"));
+    TEST_ASSERT_TRUE(find("colou?r", "colour"));
+    TEST_ASSERT_FALSE(find("colou+r", "color"));
+    TEST_ASSERT_TRUE(find("(?:ab)+c", "abababc"));
+    assert_group(0, "abababc");
+}
+
+void test_mu_string_regex_anchors(void) {
+    TEST_ASSERT_TRUE(find("^abc", "abcd"));
+    TEST_ASSERT_FALSE(find("^abc", "xabc"));
+    TEST_ASSERT_TRUE(find("abc$", "xabc"));
+    TEST_ASSERT_FALSE(find("abc$", "abcx"));
+    TEST_ASSERT_TRUE(find("^$", ""));
+    TEST_ASSERT_FALSE(find("^$", "a"));
+    TEST_ASSERT_TRUE(find("x|^a", "ba x"));
+    assert_group(0, "x");
+    TEST_ASSERT_TRUE(find("^(\\d+)$", "2024"));
+    assert_group(1, "2024");
+}
+
+void test_mu_string_regex_captures(void) {
+    TEST_ASSERT_TRUE(find("(\\w+)@(\\w+)\\.com", "mail bob@example.com now"));
+    TEST_ASSERT_EQUAL_size_t(2, mu_string_regex_group_count(&s_re));
+    assert_group(0, "bob@example.com");
+    assert_group(1, "bob");
+    assert_group(2, "example");
+    // Groups point into the input.
+    TEST_ASSERT_TRUE(find("(b)", "abc"));
+    TEST_ASSERT_EQUAL_CHAR('b', s_groups[1].buf[0]);
+
+    // A group that does not take part is NOT_FOUND.
+    TEST_ASSERT_TRUE(find("(a)|(b)", "b"));
+    TEST_ASSERT_NULL(s_groups[1].buf);
+    assert_group(2, "b");
+    // The last iteration of a repeated group is reported.
+    TEST_ASSERT_TRUE(find("(?:(\\d),)+", "1,2,3,"));
+    assert_group(1, "3");
+
+    // Only max_groups entries are written.
+    mu_string_t one[1];
+    TEST_ASSERT_NOT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("a(b)")));
+    mu_string_regex_cache_init(&s_cache, &s_re);
+    TEST_ASSERT_TRUE(mu_string_regex_find(&s_re, &s_cache, MU_STR_LITERAL("ab"), one, 1));
+    TEST_ASSERT_TRUE(mu_string_eq(MU_STR_LITERAL("ab"), one[0]));
+    TEST_ASSERT_TRUE(mu_string_regex_find(&s_re, &s_cache, MU_STR_LITERAL("ab"), NULL, 0));
+}
+
+void test_mu_string_regex_log_lines(void) {
+    static const char *lines[] = {
+        "2024-05-01 INFO  request ok id=17",
+        "2024-05-01 ERROR disk full id=42",
+        "2024-05-01 WARN  slow id=9",
+        "2024-05-02 ERROR timeout id=1234",
+    };
+    TEST_ASSERT_NOT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("ERROR (.*) id=(\\d+)$")));
+    TEST_ASSERT_EQUAL_size_t(6, s_re.prefix_len);
+    mu_string_regex_cache_init(&s_cache, &s_re);
+
+    size_t hits = 0;
+    for (size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+        mu_string_t line = MU_STR_LITERAL(lines[i]);
+        bool is_match = mu_string_regex_is_match(&s_re, &s_cache, line);
+        TEST_ASSERT_EQUAL(is_match, mu_string_regex_find(&s_re, &s_cache, line, s_groups, 3));
+        if (is_match) {
+            hits += 1;
+        }
+    }
+    TEST_ASSERT_EQUAL_size_t(2, hits);
+    assert_group(1, "timeout");
+    assert_group(2, "1234");
+
+    // Prefix skipping across a longer input with many near misses.
+    char text[600];
+    memset(text, 'E', sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+    memcpy(&text[500], "ERROR x id=7", 12);
+    TEST_ASSERT_TRUE(find("ERROR (.*) id=(\\d+)", text));
+    assert_group(2, "7");
+}
+
+void test_mu_string_regex_cache_flush(void) {
+    // More DFA states than the cache holds: the cache is flushed and rebuilt
+    // without changing the answer.
+    static char text[2000];
+    for (size_t i = 0; i < sizeof(text) - 1; i++) {
+        text[i] = "abcd"[(i * 7 + i / 5) % 4];
+    }
+    text[sizeof(text) - 1] = '\0';
+    TEST_ASSERT_NOT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("(?:a|b)(?:a|b|c)(?:b|c)(?:c|d)(?:a|d)zz")));
+    TEST_ASSERT_FALSE(mu_string_regex_is_match(&s_re, &s_cache, MU_STR_LITERAL(text)));
+    TEST_ASSERT_TRUE(mu_string_regex_is_match(&s_re, &s_cache, MU_STR_LITERAL("xxabcdazz")));
+
+    // A cache used with one pattern object is reset automatically for
+    // another.
+    static mu_string_regex_t other;
+    TEST_ASSERT_NOT_NULL(mu_string_regex_compile(&other, MU_STR_LITERAL("zz$")));
+    TEST_ASSERT_TRUE(mu_string_regex_is_match(&other, &s_cache, MU_STR_LITERAL("xxabcdazz")));
+    TEST_ASSERT_FALSE(mu_string_regex_is_match(&s_re, &s_cache, MU_STR_LITERAL(text)));
+}
+
+void test_mu_string_regex_compile_errors(void) {
+    TEST_ASSERT_EQUAL_PTR(&s_re, mu_string_regex_compile(&s_re, MU_STR_LITERAL("a(b|c)*d")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("a(b")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("ab)")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("*a")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("a|+")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("[abc")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("[z-a]")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("abc\\")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("\\q")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("\\xZZ")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("(a)(b)(c)(d)(e)")));
+    char big[MU_STRING_REGEX_MAX_INSTS + 1];
+    memset(big, 'a', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL(big)));
+
+    TEST_ASSERT_NULL(mu_string_regex_compile(NULL, MU_STR_LITERAL("a")));
+    TEST_ASSERT_NULL(mu_string_regex_compile(&s_re, MU_STRING_INVALID));
+    TEST_ASSERT_NOT_NULL(mu_string_regex_compile(&s_re, MU_STR_LITERAL("a")));
+    TEST_ASSERT_FALSE(mu_string_regex_is_match(&s_re, NULL, MU_STR_LITERAL("a")));
+    TEST_ASSERT_FALSE(mu_string_regex_is_match(&s_re, &s_cache, MU_STRING_INVALID));
+    TEST_ASSERT_FALSE(mu_string_regex_find(&s_re, &s_cache, MU_STR_LITERAL("a"), NULL, 1));
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static bool find(const char *pattern, const char *s) {
+    TEST_ASSERT_NOT_NULL_MESSAGE(mu_string_regex_compile(&s_re, MU_STR_LITERAL(pattern)), pattern);
+    mu_string_regex_cache_init(&s_cache, &s_re);
+    mu_string_t input = MU_STR_LITERAL(s);
+    bool found = mu_string_regex_find(&s_re, &s_cache, input,
+                                      s_groups, MU_STRING_REGEX_MAX_GROUPS + 1);
+    TEST_ASSERT_EQUAL_MESSAGE(found, mu_string_regex_is_match(&s_re, &s_cache, input), pattern);
+    return found;
+}
+
+static void assert_group(size_t g, const char *expected) {
+    TEST_ASSERT_NOT_NULL(s_groups[g].buf);
+    TEST_ASSERT_TRUE_MESSAGE(mu_string_eq(MU_STR_LITERAL(expected), s_groups[g]), expected);
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_regex.c");
+
+    RUN_TEST(test_mu_string_regex_literal_and_classes);
+    RUN_TEST(test_mu_string_regex_alternation_and_repetition);
+    RUN_TEST(test_mu_string_regex_anchors);
+    RUN_TEST(test_mu_string_regex_captures);
+    RUN_TEST(test_mu_string_regex_log_lines);
+    RUN_TEST(test_mu_string_regex_cache_flush);
+    RUN_TEST(test_mu_string_regex_compile_errors);
+
+    return UnityEnd();
+}
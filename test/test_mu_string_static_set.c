@@ -0,0 +1,207 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_static_set.c
+ *
+ * @brief Unit tests for the mu_string_static_set module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_static_set.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+#define MU_STR_BYTES(s) (mu_string_t){ .buf = (s), .len = sizeof(s) - 1 }
+
+#define N_KEYS 1000
+
+// *****************************************************************************
+// Private (static) storage
+
+static char s_key_text[N_KEYS][16];
+static mu_string_t s_keys[N_KEYS];
+static mu_string_static_set_entry_t s_entries[MU_STRING_STATIC_SET_ENTRIES(N_KEYS)];
+static mu_string_static_set_t s_set;
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Checks every key of `keys` and each probe in `probes` against
+ * mu_string_lower_bound() on the sorted array.
+ */
+static void check_against_array(const mu_string_t *keys, size_t n_keys,
+                                const mu_string_t *probes, size_t n_probes);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    // Sorted, with long shared prefixes: "item:000000", "item:000007", ...
+    for (size_t i = 0; i < N_KEYS; i++) {
+        int n = snprintf(s_key_text[i], sizeof(s_key_text[i]), "item:%06zu",
+                         i * 7);
+        s_keys[i] = mu_string_from_buf(s_key_text[i], (size_t)n);
+    }
+}
+
+void tearDown(void) {}
+
+void test_mu_string_static_set_build(void) {
+    mu_string_t unsorted[] = { MU_STR_LITERAL("b"), MU_STR_LITERAL("a") };
+    mu_string_t invalid[] = { MU_STR_LITERAL("a"), MU_STRING_INVALID };
+
+    TEST_ASSERT_EQUAL_PTR(&s_set, mu_string_static_set_build(
+                                      &s_set, s_entries, N_KEYS + 1, s_keys,
+                                      N_KEYS));
+    TEST_ASSERT_EQUAL_size_t(N_KEYS, mu_string_static_set_count(&s_set));
+    TEST_ASSERT_NULL(mu_string_static_set_build(&s_set, s_entries, N_KEYS,
+                                                s_keys, N_KEYS));
+    TEST_ASSERT_NULL(mu_string_static_set_build(&s_set, s_entries, 3,
+                                                unsorted, 2));
+    TEST_ASSERT_NULL(mu_string_static_set_build(&s_set, s_entries, 3,
+                                                invalid, 2));
+    TEST_ASSERT_NULL(mu_string_static_set_build(NULL, s_entries, 3, s_keys, 2));
+    TEST_ASSERT_NULL(mu_string_static_set_build(&s_set, NULL, 3, s_keys, 2));
+
+    // An empty set contains nothing.
+    TEST_ASSERT_EQUAL_PTR(&s_set, mu_string_static_set_build(
+                                      &s_set, s_entries, 1, NULL, 0));
+    TEST_ASSERT_FALSE(mu_string_static_set_contains(&s_set, MU_STRING_EMPTY));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_static_set_lower_bound(
+                                    &s_set, MU_STR_LITERAL("a")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_static_set_count(NULL));
+}
+
+void test_mu_string_static_set_lookup(void) {
+    TEST_ASSERT_NOT_NULL(mu_string_static_set_build(
+        &s_set, s_entries, N_KEYS + 1, s_keys, N_KEYS));
+
+    for (size_t i = 0; i < N_KEYS; i++) {
+        TEST_ASSERT_TRUE(mu_string_static_set_contains(&s_set, s_keys[i]));
+        TEST_ASSERT_EQUAL_size_t(i, mu_string_static_set_lower_bound(&s_set,
+                                                                     s_keys[i]));
+    }
+    TEST_ASSERT_FALSE(mu_string_static_set_contains(&s_set,
+                                                    MU_STR_LITERAL("item:000001")));
+    TEST_ASSERT_EQUAL_size_t(1, mu_string_static_set_lower_bound(
+                                    &s_set, MU_STR_LITERAL("item:000001")));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_static_set_lower_bound(
+                                    &s_set, MU_STR_LITERAL("item:")));
+    TEST_ASSERT_EQUAL_size_t(N_KEYS, mu_string_static_set_lower_bound(
+                                         &s_set, MU_STR_LITERAL("item:9")));
+    TEST_ASSERT_FALSE(mu_string_static_set_contains(&s_set, MU_STRING_INVALID));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_static_set_lower_bound(
+                                    &s_set, MU_STRING_INVALID));
+}
+
+void test_mu_string_static_set_prefix_ties(void) {
+    // Keys whose first eight bytes tie, or differ only in zero padding.
+    mu_string_t keys[] = {
+        MU_STRING_EMPTY,
+        MU_STR_BYTES("\0"),
+        MU_STR_BYTES("a"),
+        MU_STR_BYTES("a\0"),
+        MU_STR_BYTES("a\0b"),
+        MU_STR_BYTES("abcdefgh"),
+        MU_STR_BYTES("abcdefgh"),
+        MU_STR_BYTES("abcdefgh\0"),
+        MU_STR_BYTES("abcdefghi"),
+        MU_STR_BYTES("abcdefghij"),
+        MU_STR_BYTES("abcdefgi"),
+        MU_STR_BYTES("\x80"),
+        MU_STR_BYTES("\xff\xff\xff\xff\xff\xff\xff\xff\xff"),
+    };
+    mu_string_t probes[] = {
+        MU_STR_BYTES("\0\0"),
+        MU_STR_BYTES("a\0a"),
+        MU_STR_BYTES("a\0c"),
+        MU_STR_BYTES("abcdefg"),
+        MU_STR_BYTES("abcdefgh\0\0"),
+        MU_STR_BYTES("abcdefghia"),
+        MU_STR_BYTES("abcdefghz"),
+        MU_STR_BYTES("b"),
+        MU_STR_BYTES("\xff\xff\xff\xff\xff\xff\xff\xff"),
+        MU_STR_BYTES("\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff"),
+    };
+    check_against_array(keys, sizeof(keys) / sizeof(keys[0]), probes,
+                        sizeof(probes) / sizeof(probes[0]));
+}
+
+void test_mu_string_static_set_shapes(void) {
+    // Every tree shape from empty to a few levels deep, with probes falling
+    // before, between and after the keys.
+    static char probe_text[70][16];
+    static mu_string_t probes[70];
+    for (size_t i = 0; i < 70; i++) {
+        int n = snprintf(probe_text[i], sizeof(probe_text[i]), "item:%06zu",
+                         i * 7 + 3);
+        probes[i] = mu_string_from_buf(probe_text[i], (size_t)n);
+    }
+    probes[69] = MU_STR_LITERAL("item:");
+    for (size_t n = 0; n <= 68; n++) {
+        check_against_array(s_keys, n, probes, 70);
+    }
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static void check_against_array(const mu_string_t *keys, size_t n_keys,
+                                const mu_string_t *probes, size_t n_probes) {
+    TEST_ASSERT_NOT_NULL(mu_string_static_set_build(
+        &s_set, s_entries, N_KEYS + 1, keys, n_keys));
+    for (size_t i = 0; i < n_keys + n_probes; i++) {
+        mu_string_t key = (i < n_keys) ? keys[i] : probes[i - n_keys];
+        size_t expected = mu_string_lower_bound(keys, n_keys, key);
+        bool present = expected < n_keys && mu_string_eq(keys[expected], key);
+        TEST_ASSERT_EQUAL_size_t(expected,
+                                 mu_string_static_set_lower_bound(&s_set, key));
+        TEST_ASSERT_EQUAL(present, mu_string_static_set_contains(&s_set, key));
+    }
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_static_set.c");
+
+    RUN_TEST(test_mu_string_static_set_build);
+    RUN_TEST(test_mu_string_static_set_lookup);
+    RUN_TEST(test_mu_string_static_set_prefix_ties);
+    RUN_TEST(test_mu_string_static_set_shapes);
+
+    return UnityEnd();
+}
@@ -0,0 +1,189 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_string_trigram.c
+ *
+ * @brief Unit tests for the mu_string_trigram module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_trigram.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_LITERAL(s) (mu_string_t){ .buf = (s), .len = strlen(s) }
+
+#define N_GENERATED 500
+#define ARENA_LEN (3 * (1 << 10) + 8192)
+
+// *****************************************************************************
+// Private (static) storage
+
+static const char *s_agents[] = {
+    "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 Chrome/120.0",
+    "Mozilla/5.0 (Macintosh; Intel Mac OS X 14_2) AppleWebKit/605.1.15 Safari/605.1.15",
+    "Mozilla/5.0 (X11; Linux x86_64; rv:121.0) Gecko/20100101 Firefox/121.0",
+    "curl/8.4.0",
+    "Mozilla/5.0 (iPhone; CPU iPhone OS 17_1 like Mac OS X) Mobile/15E148",
+    "python-requests/2.31.0",
+    "",
+    "Go-http-client/1.1",
+};
+
+static mu_string_t s_records[N_GENERATED];
+static char s_text[N_GENERATED][32];
+static uint32_t s_arena[ARENA_LEN];
+static mu_string_trigram_t s_index;
+
+// *****************************************************************************
+// Private (forward) declarations
+
+static size_t brute_force(const mu_string_t *records, size_t n, const char *needle,
+                          size_t *ids, size_t max_ids);
+static void assert_same_as_scan(const char *needle);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {
+    memset(&s_index, 0, sizeof(s_index));
+    for (size_t i = 0; i < sizeof(s_agents) / sizeof(s_agents[0]); i++) {
+        s_records[i] = MU_STR_LITERAL(s_agents[i]);
+    }
+}
+
+void tearDown(void) {}
+
+void test_mu_string_trigram_find(void) {
+    size_t n = sizeof(s_agents) / sizeof(s_agents[0]);
+    TEST_ASSERT_EQUAL_PTR(&s_index, mu_string_trigram_build(&s_index, s_records, n, 10,
+                                                            s_arena, ARENA_LEN));
+    TEST_ASSERT_TRUE(s_index.arena_used <= ARENA_LEN);
+
+    size_t ids[8];
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_trigram_find(&s_index, MU_STR_LITERAL("Mozilla"), ids, 8));
+    TEST_ASSERT_EQUAL_size_t(0, ids[0]);
+    TEST_ASSERT_EQUAL_size_t(4, ids[3]);
+    TEST_ASSERT_EQUAL_size_t(2, mu_string_trigram_find(&s_index, MU_STR_LITERAL("Mac OS X"), ids, 8));
+    TEST_ASSERT_EQUAL_size_t(1, ids[0]);
+    TEST_ASSERT_EQUAL_size_t(4, ids[1]);
+    TEST_ASSERT_EQUAL_size_t(1, mu_string_trigram_find(&s_index, MU_STR_LITERAL("curl/"), ids, 8));
+    TEST_ASSERT_EQUAL_size_t(3, ids[0]);
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_trigram_find(&s_index, MU_STR_LITERAL("Opera"), ids, 8));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_trigram_find(&s_index, MU_STR_LITERAL("curl/9"), ids, 8));
+
+    // Short needles fall back to a scan; an empty needle matches everything.
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_trigram_find(&s_index, MU_STR_LITERAL("/5"), ids, 8));
+    TEST_ASSERT_EQUAL_size_t(n, mu_string_trigram_find(&s_index, MU_STRING_EMPTY, ids, 8));
+
+    // The total is reported even when the output is too small.
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_trigram_find(&s_index, MU_STR_LITERAL("Mozilla"), ids, 1));
+    TEST_ASSERT_EQUAL_size_t(4, mu_string_trigram_find(&s_index, MU_STR_LITERAL("Mozilla"), NULL, 0));
+}
+
+void test_mu_string_trigram_matches_scan(void) {
+    // Many records sharing trigrams, with varint deltas of several sizes.
+    for (size_t i = 0; i < N_GENERATED; i++) {
+        snprintf(s_text[i], sizeof(s_text[i]), "/api/v%zu/item/%zu?q=%zu", i % 3, i * 7919 % 1000, i % 17);
+        s_records[i] = MU_STR_LITERAL(s_text[i]);
+    }
+    TEST_ASSERT_NOT_NULL(mu_string_trigram_build(&s_index, s_records, N_GENERATED, 10,
+                                                 s_arena, ARENA_LEN));
+    assert_same_as_scan("/api/v1/");
+    assert_same_as_scan("item/99");
+    assert_same_as_scan("q=16");
+    assert_same_as_scan("/item/1000");
+    assert_same_as_scan("v2/item/3");
+    assert_same_as_scan("?q=");
+    assert_same_as_scan("zzz");
+}
+
+void test_mu_string_trigram_build_errors(void) {
+    size_t n = sizeof(s_agents) / sizeof(s_agents[0]);
+    // Too small for the offsets and scratch, then for the posting lists.
+    TEST_ASSERT_NULL(mu_string_trigram_build(&s_index, s_records, n, 10, s_arena, 2048));
+    TEST_ASSERT_NULL(mu_string_trigram_build(&s_index, s_records, n, 10, s_arena, 2 * 1024 + 1 + 16));
+    TEST_ASSERT_NULL(mu_string_trigram_build(&s_index, s_records, n, 7, s_arena, ARENA_LEN));
+    TEST_ASSERT_NULL(mu_string_trigram_build(&s_index, s_records, n, 25, s_arena, ARENA_LEN));
+    TEST_ASSERT_NULL(mu_string_trigram_build(NULL, s_records, n, 10, s_arena, ARENA_LEN));
+    TEST_ASSERT_NULL(mu_string_trigram_build(&s_index, NULL, n, 10, s_arena, ARENA_LEN));
+    s_records[2] = MU_STRING_INVALID;
+    TEST_ASSERT_NULL(mu_string_trigram_build(&s_index, s_records, n, 10, s_arena, ARENA_LEN));
+
+    // No records at all is fine.
+    TEST_ASSERT_NOT_NULL(mu_string_trigram_build(&s_index, NULL, 0, 10, s_arena, ARENA_LEN));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_trigram_find(&s_index, MU_STR_LITERAL("abc"), NULL, 0));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_trigram_find(NULL, MU_STR_LITERAL("abc"), NULL, 0));
+    TEST_ASSERT_EQUAL_size_t(0, mu_string_trigram_find(&s_index, MU_STRING_INVALID, NULL, 0));
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static size_t brute_force(const mu_string_t *records, size_t n, const char *needle,
+                          size_t *ids, size_t max_ids) {
+    size_t found = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (mu_string_find_str(records[i], MU_STR_LITERAL(needle)).len != 0) {
+            if (found < max_ids) {
+                ids[found] = i;
+            }
+            found += 1;
+        }
+    }
+    return found;
+}
+
+static void assert_same_as_scan(const char *needle) {
+    static size_t expected[N_GENERATED];
+    static size_t actual[N_GENERATED];
+    size_t n_expected = brute_force(s_records, N_GENERATED, needle, expected, N_GENERATED);
+    size_t n_actual = mu_string_trigram_find(&s_index, MU_STR_LITERAL(needle), actual, N_GENERATED);
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(n_expected, n_actual, needle);
+    for (size_t i = 0; i < n_expected; i++) {
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(expected[i], actual[i], needle);
+    }
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_trigram.c");
+
+    RUN_TEST(test_mu_string_trigram_find);
+    RUN_TEST(test_mu_string_trigram_matches_scan);
+    RUN_TEST(test_mu_string_trigram_build_errors);
+
+    return UnityEnd();
+}
@@ -0,0 +1,325 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file test_mu_string_utf8.c
+ *
+ * @brief Unit tests for the mu_string_utf8 module using Unity.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_string_utf8.h"
+#include "mu_string.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define MU_STR_BYTES(s) (mu_string_t){ .buf = (s), .len = sizeof(s) - 1 }
+
+#define FOLD_BUF_LEN 256
+
+// *****************************************************************************
+// Private (static) storage
+
+static char s_buf[FOLD_BUF_LEN];
+
+// *****************************************************************************
+// Private (forward) declarations
+
+/**
+ * @brief Asserts that `src` folds to `expect`.
+ */
+static void check_fold(mu_string_t src, mu_string_t expect);
+
+/**
+ * @brief Asserts that `src` normalizes to `expect`, which is in NFC.
+ */
+static void check_nfc(mu_string_t src, mu_string_t expect);
+
+// *****************************************************************************
+// Public code
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_mu_string_utf8_casefold(void) {
+    // ASCII, long enough for whole words and a tail.
+    check_fold(MU_STR_BYTES("Hello, World! ABCDEFGHIJKLMNOPQRSTUVWXYZ @[`{"),
+               MU_STR_BYTES("hello, world! abcdefghijklmnopqrstuvwxyz @[`{"));
+    check_fold(MU_STRING_EMPTY, MU_STRING_EMPTY);
+    // "STRAẞE" and "Straße": capital sharp s folds to small sharp s, which
+    // simple folding leaves alone.
+    check_fold(MU_STR_BYTES("STRA\xE1\xBA\x9E" "E"),
+               MU_STR_BYTES("stra\xC3\x9F" "e"));
+    check_fold(MU_STR_BYTES("Stra\xC3\x9F" "e"),
+               MU_STR_BYTES("stra\xC3\x9F" "e"));
+    // "ΣΊΣΥΦΟΣ" and final sigma: every sigma folds to σ.
+    check_fold(MU_STR_BYTES("\xCE\xA3\xCE\x8A\xCE\xA3\xCE\xA5\xCE\xA6\xCE\x9F"
+                            "\xCE\xA3 \xCF\x82"),
+               MU_STR_BYTES("\xCF\x83\xCE\xAF\xCF\x83\xCF\x85\xCF\x86\xCE\xBF"
+                            "\xCF\x83 \xCF\x83"));
+    // "ПРИВЕТ", Kelvin sign, Deseret (four bytes), and dotted capital I,
+    // which has no simple folding.
+    check_fold(MU_STR_BYTES("\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2"),
+               MU_STR_BYTES("\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82"));
+    check_fold(MU_STR_BYTES("\xE2\x84\xAA" "elvin"), MU_STR_BYTES("kelvin"));
+    check_fold(MU_STR_BYTES("\xF0\x90\x90\x80"), MU_STR_BYTES("\xF0\x90\x90\xA8"));
+    check_fold(MU_STR_BYTES("\xC4\xB0"), MU_STR_BYTES("\xC4\xB0"));
+    // Ill-formed bytes pass through: a stray continuation byte, an overlong
+    // 'A', a surrogate, a truncated sequence and a byte never used in UTF-8.
+    check_fold(MU_STR_BYTES("A\x80" "B\xC1\x81" "C\xED\xA0\x80" "D\xE2\x84"),
+               MU_STR_BYTES("a\x80" "b\xC1\x81" "c\xED\xA0\x80" "d\xE2\x84"));
+    check_fold(MU_STR_BYTES("\xFF" "ABCDEFGH"), MU_STR_BYTES("\xFF" "abcdefgh"));
+
+    // U+023A takes two bytes but folds to U+2C65, which takes three.
+    mu_string_t grow = MU_STR_BYTES("\xC8\xBA\xC8\xBA");
+    mu_string_mut_t dst = { .buf = s_buf, .len = 6 };
+    mu_string_t folded = mu_string_utf8_casefold(dst, grow);
+    TEST_ASSERT_EQUAL_size_t(6, folded.len);
+    TEST_ASSERT_EQUAL_MEMORY("\xE2\xB1\xA5\xE2\xB1\xA5", folded.buf, 6);
+    dst.len = 5;
+    TEST_ASSERT_NULL(mu_string_utf8_casefold(dst, grow).buf);
+    dst.len = 7;
+    TEST_ASSERT_NULL(mu_string_utf8_casefold(dst, MU_STR_BYTES("ABCDEFGH")).buf);
+
+    dst.len = FOLD_BUF_LEN;
+    TEST_ASSERT_NULL(mu_string_utf8_casefold(dst, MU_STRING_INVALID).buf);
+    mu_string_mut_t null_dst = { .buf = NULL, .len = 8 };
+    TEST_ASSERT_NULL(mu_string_utf8_casefold(null_dst, MU_STR_BYTES("A")).buf);
+}
+
+void test_mu_string_utf8_eq_casefold(void) {
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(MU_STR_BYTES("Hello"),
+                                                MU_STR_BYTES("hELLO")));
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(MU_STRING_EMPTY,
+                                                MU_STRING_EMPTY));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("Hello"),
+                                                 MU_STR_BYTES("Hell")));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("Hell"),
+                                                 MU_STR_BYTES("Hello")));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("@"),
+                                                 MU_STR_BYTES("`")));
+    // Word-at-a-time spans, differing only in the last byte or only in the
+    // tail.
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(
+        MU_STR_BYTES("The Quick Brown Fox Jumps Over The Lazy Dog"),
+        MU_STR_BYTES("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG")));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(
+        MU_STR_BYTES("The Quick Brown Fox Jumps Over The Lazy Dog"),
+        MU_STR_BYTES("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOT")));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("ABCDEFGH"),
+                                                 MU_STR_BYTES("abcdefgi")));
+
+    // Strings of different byte lengths can be equal: the Kelvin sign takes
+    // three bytes, its folding one.
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(
+        MU_STR_BYTES("\xE2\x84\xAA" "ELVIN AND \xC3\x85NGSTR\xC3\x96M"),
+        MU_STR_BYTES("kelvin and \xE2\x84\xAB" "ngstr\xC3\xB6m")));
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(
+        MU_STR_BYTES("STRA\xE1\xBA\x9E" "E"), MU_STR_BYTES("stra\xC3\x9F" "e")));
+    // Simple folding does not expand "ß" to "ss".
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("stra\xC3\x9F" "e"),
+                                                 MU_STR_BYTES("strasse")));
+
+    // Ill-formed bytes match only themselves.
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(MU_STR_BYTES("A\xFF"),
+                                                MU_STR_BYTES("a\xFF")));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("A\xFE"),
+                                                 MU_STR_BYTES("a\xFF")));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STR_BYTES("\xC3"),
+                                                 MU_STR_BYTES("\xC3\xA9")));
+
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STRING_INVALID,
+                                                 MU_STRING_EMPTY));
+    TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(MU_STRING_EMPTY,
+                                                 MU_STRING_INVALID));
+}
+
+void test_mu_string_utf8_casefold_random(void) {
+    // Mixed ASCII, multi-byte letters and stray bytes, checked against the
+    // folded copy: eq_casefold must agree with comparing foldings.
+    static const char *const pieces[] = {
+        "a", "B", "Hello World!", "\xC3\x89", "\xC3\xA9", "\xCE\xA3",
+        "\xCF\x82", "\xE2\x84\xAA", "\xC8\xBA", "\xF0\x90\x90\x80", "\x80",
+        "\xE2\x84",
+    };
+    const size_t n_pieces = sizeof(pieces) / sizeof(pieces[0]);
+    char text[96];
+    char other[FOLD_BUF_LEN];
+    srand(1);
+
+    for (int trial = 0; trial < 500; trial++) {
+        size_t len = 0;
+        while (len < sizeof(text) - 16) {
+            const char *piece = pieces[(size_t)rand() % n_pieces];
+            memcpy(&text[len], piece, strlen(piece));
+            len += strlen(piece);
+            if (rand() % 8 == 0) {
+                break;
+            }
+        }
+        mu_string_t s = mu_string_from_buf(text, len);
+        mu_string_mut_t dst = { .buf = s_buf, .len = FOLD_BUF_LEN };
+        mu_string_t folded = mu_string_utf8_casefold(dst, s);
+        TEST_ASSERT_NOT_NULL(folded.buf);
+        TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(s, folded));
+        TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(folded, s));
+
+        // Folding is idempotent.
+        mu_string_mut_t dst2 = { .buf = other, .len = FOLD_BUF_LEN };
+        mu_string_t again = mu_string_utf8_casefold(dst2, folded);
+        TEST_ASSERT_TRUE(mu_string_eq(folded, again));
+
+        // Changing one byte of an ASCII letter changes the folding.
+        if (len > 0 && text[len - 1] == '!') {
+            text[len - 1] = '?';
+            TEST_ASSERT_FALSE(mu_string_utf8_eq_casefold(s, folded));
+        }
+    }
+}
+
+void test_mu_string_utf8_nfc_quick_check(void) {
+    // Below U+0300, long enough for whole words.
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_YES,
+                      mu_string_utf8_nfc_quick_check(MU_STR_BYTES(
+                          "Caf\xC3\xA9 cr\xC3\xA8me br\xC3\xBBl\xC3\xA9" "e")));
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_YES,
+                      mu_string_utf8_nfc_quick_check(MU_STRING_EMPTY));
+    // Precomposed Hangul and CJK.
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_YES,
+                      mu_string_utf8_nfc_quick_check(MU_STR_BYTES(
+                          "\xED\x95\x9C\xEA\xB8\x80 \xE4\xB8\xAD\xE6\x96\x87")));
+    // Combining marks in order that never compose are fine; one that might
+    // compose needs a closer look.
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_YES,
+                      mu_string_utf8_nfc_quick_check(MU_STR_BYTES(
+                          "x\xCC\x96\xCC\x85")));
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_MAYBE,
+                      mu_string_utf8_nfc_quick_check(MU_STR_BYTES(
+                          "cafe\xCC\x81")));
+    // Combining marks out of canonical order, and U+0958, which never
+    // occurs in NFC.
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_NO,
+                      mu_string_utf8_nfc_quick_check(MU_STR_BYTES(
+                          "x\xCC\x85\xCC\x96")));
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_NO,
+                      mu_string_utf8_nfc_quick_check(MU_STR_BYTES(
+                          "abcdefgh\xE0\xA5\x98")));
+    TEST_ASSERT_EQUAL(MU_STRING_UTF8_NFC_NO,
+                      mu_string_utf8_nfc_quick_check(MU_STRING_INVALID));
+}
+
+void test_mu_string_utf8_to_nfc(void) {
+    // "é" as "e" and U+0301, and "Å" as "A" and U+030A, after ASCII runs.
+    check_nfc(
+        MU_STR_BYTES("cafe\xCC\x81 and the Angstro\xCC\x88m of A\xCC\x8A"),
+        MU_STR_BYTES("caf\xC3\xA9 and the Angstr\xC3\xB6m of \xC3\x85"));
+    // Marks out of order are sorted by combining class; the dot below then
+    // composes first: "s" U+0307 U+0323 becomes U+1E69.
+    check_nfc(MU_STR_BYTES("s\xCC\x87\xCC\xA3"), MU_STR_BYTES("\xE1\xB9\xA9"));
+    // A mark blocked by another of the same class stays separate.
+    check_nfc(MU_STR_BYTES("a\xCC\x88\xCC\x81"),
+              MU_STR_BYTES("\xC3\xA4\xCC\x81"));
+    // Hangul jamo L V T compose to one syllable, L V to another.
+    check_nfc(MU_STR_BYTES("\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB"
+                           "\xE1\x84\x80\xE1\x85\xB3"),
+              MU_STR_BYTES("\xED\x95\x9C\xEA\xB7\xB8"));
+    // Singletons and composition exclusions: the Angstrom sign becomes "Å";
+    // U+0958 decomposes and stays decomposed, and is longer for it.
+    check_nfc(MU_STR_BYTES("\xE2\x84\xAB"), MU_STR_BYTES("\xC3\x85"));
+    check_nfc(MU_STR_BYTES("\xE0\xA5\x98"),
+              MU_STR_BYTES("\xE0\xA4\x95\xE0\xA4\xBC"));
+    // A leading mark has nothing to compose with; ill-formed bytes pass
+    // through.
+    check_nfc(MU_STR_BYTES("\xCC\x81" "e\xCC\x81\xFF"),
+              MU_STR_BYTES("\xCC\x81\xC3\xA9\xFF"));
+
+    // Text already in NFC is returned as is, without touching `dst`.
+    mu_string_t nfc = MU_STR_BYTES("caf\xC3\xA9");
+    mu_string_mut_t null_dst = { .buf = NULL, .len = 0 };
+    TEST_ASSERT_EQUAL_PTR(nfc.buf, mu_string_utf8_to_nfc(null_dst, nfc).buf);
+
+    mu_string_t nfd = MU_STR_BYTES("cafe\xCC\x81");
+    mu_string_mut_t dst = { .buf = s_buf, .len = 4 };
+    TEST_ASSERT_NULL(mu_string_utf8_to_nfc(dst, nfd).buf);
+    dst.len = 5;
+    TEST_ASSERT_EQUAL_size_t(5, mu_string_utf8_to_nfc(dst, nfd).len);
+    TEST_ASSERT_NULL(mu_string_utf8_to_nfc(null_dst, nfd).buf);
+    TEST_ASSERT_NULL(mu_string_utf8_to_nfc(dst, MU_STRING_INVALID).buf);
+
+    // More combining marks in a row than a segment holds.
+    char marks[2 * MU_STRING_UTF8_NFC_SEGMENT + 1];
+    marks[0] = 'a';
+    for (size_t k = 0; k < MU_STRING_UTF8_NFC_SEGMENT; k++) {
+        memcpy(&marks[1 + 2 * k], "\xCC\x81", 2);
+    }
+    dst.len = FOLD_BUF_LEN;
+    TEST_ASSERT_NULL(mu_string_utf8_to_nfc(
+        dst, mu_string_from_buf(marks, sizeof(marks))).buf);
+}
+
+// *****************************************************************************
+// Private (static) code
+
+static void check_fold(mu_string_t src, mu_string_t expect) {
+    mu_string_mut_t dst = { .buf = s_buf, .len = FOLD_BUF_LEN };
+    mu_string_t folded = mu_string_utf8_casefold(dst, src);
+    TEST_ASSERT_NOT_NULL(folded.buf);
+    TEST_ASSERT_EQUAL_size_t(expect.len, folded.len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expect.buf, folded.buf, expect.len));
+    TEST_ASSERT_TRUE(mu_string_utf8_eq_casefold(src, expect));
+}
+
+static void check_nfc(mu_string_t src, mu_string_t expect) {
+    mu_string_mut_t dst = { .buf = s_buf, .len = FOLD_BUF_LEN };
+    mu_string_t nfc = mu_string_utf8_to_nfc(dst, src);
+    TEST_ASSERT_NOT_NULL(nfc.buf);
+    TEST_ASSERT_EQUAL_size_t(expect.len, nfc.len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expect.buf, nfc.buf, expect.len));
+    TEST_ASSERT_NOT_EQUAL(MU_STRING_UTF8_NFC_NO,
+                          mu_string_utf8_nfc_quick_check(nfc));
+}
+
+// *****************************************************************************
+// End of file - Main test runner
+
+int main(void) {
+    UnityBegin("test_mu_string_utf8.c");
+
+    RUN_TEST(test_mu_string_utf8_casefold);
+    RUN_TEST(test_mu_string_utf8_eq_casefold);
+    RUN_TEST(test_mu_string_utf8_casefold_random);
+    RUN_TEST(test_mu_string_utf8_nfc_quick_check);
+    RUN_TEST(test_mu_string_utf8_to_nfc);
+
+    return UnityEnd();
+}
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""
+Generates src/mu_string_utf8_tables.h from the Unicode Character Database
+bundled with Python's unicodedata module.
+
+Usage (from the repository root):
+
+    python3 tools/gen_mu_string_utf8_tables.py > src/mu_string_utf8_tables.h
+
+The tables are two-level: a code point's high bits select a block number in
+stage 1, and its low bits select an entry of that block in stage 2.  Blocks
+with identical contents are stored once.
+"""
+
+import sys
+import unicodedata
+
+FOLD_SHIFT = 6
+NFC_SHIFT = 6
+
+QC_YES, QC_MAYBE, QC_NO = 0, 1, 2
+
+
+def simple_fold(cp):
+    """Returns the simple (one-to-one) case folding of `cp`.
+
+    CaseFolding.txt status C and S mappings.  Python exposes only the full
+    folding, which agrees with the simple one whenever it is a single code
+    point; where the full folding expands (status F), the simple folding is
+    the single-code-point lower-case mapping, if there is one.
+    """
+    ch = chr(cp)
+    folded = ch.casefold()
+    if len(folded) == 1:
+        return ord(folded)
+    lower = ch.lower()
+    if len(lower) == 1:
+        return ord(lower)
+    return cp
+
+
+def two_level(values, shift):
+    """Splits `values` into deduplicated blocks of 1 << shift entries."""
+    size = 1 << shift
+    blocks = {}
+    stage1 = []
+    for start in range(0, len(values), size):
+        block = tuple(values[start:start + size])
+        block += (0,) * (size - len(block))
+        stage1.append(blocks.setdefault(block, len(blocks)))
+    return stage1, list(blocks)
+
+
+def emit_array(out, ctype, name, items, per_line):
+    out.append(f"static const {ctype} {name}[{len(items)}] = {{")
+    for i in range(0, len(items), per_line):
+        out.append("    " + ", ".join(str(x) for x in items[i:i + per_line]) +
+                   ",")
+    out.append("};")
+    out.append("")
+
+
+def emit_fold(out):
+    folds = {}
+    for cp in range(0x110000):
+        if 0xD800 <= cp < 0xE000:
+            continue
+        f = simple_fold(cp)
+        if f != cp:
+            folds[cp] = f
+    limit = max(folds) + 1
+    deltas = [0] + sorted(set(f - cp for cp, f in folds.items()))
+    index = {d: k for k, d in enumerate(deltas)}
+    values = [index[folds.get(cp, cp) - cp] for cp in range(limit)]
+    stage1, blocks = two_level(values, FOLD_SHIFT)
+    assert len(blocks) <= 256 and len(deltas) <= 256
+
+    out.append("// Simple case folding.  A code point `cp` below FOLD_LIMIT folds to")
+    out.append("// `cp + fold_delta[k]`, where")
+    out.append("// `k = fold_stage2[fold_stage1[cp >> FOLD_SHIFT]][cp & FOLD_MASK]`.")
+    out.append(f"#define FOLD_LIMIT 0x{limit:X}")
+    out.append(f"#define FOLD_SHIFT {FOLD_SHIFT}")
+    out.append(f"#define FOLD_MASK 0x{(1 << FOLD_SHIFT) - 1:X}")
+    out.append("")
+    emit_array(out, "uint8_t", "fold_stage1", stage1, 16)
+    out.append(f"static const uint8_t fold_stage2[{len(blocks)}]"
+               f"[{1 << FOLD_SHIFT}] = {{")
+    for block in blocks:
+        out.append("    {")
+        for i in range(0, len(block), 16):
+            out.append("        " + ", ".join(str(x) for x in block[i:i + 16]) +
+                       ",")
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    emit_array(out, "int32_t", "fold_delta", deltas, 8)
+
+
+def canonical_decompositions():
+    """Returns the one-level canonical decomposition mapping of each code
+    point that has one, as a list of one or two code points."""
+    decomp = {}
+    for cp in range(0x110000):
+        d = unicodedata.decomposition(chr(cp))
+        if d and not d.startswith("<"):
+            decomp[cp] = [int(x, 16) for x in d.split()]
+    return decomp
+
+
+def emit_nfc(out):
+    decomp = canonical_decompositions()
+    # The C code expands only the first code point of a pair repeatedly.
+    assert all(len(v) == 1 or v[1] not in decomp for v in decomp.values())
+    max_decomp = 1
+    for cp in decomp:
+        n = 1
+        while cp in decomp:
+            n += len(decomp[cp]) - 1
+            cp = decomp[cp][0]
+        max_decomp = max(max_decomp, n)
+
+    # Primary composites: pairs that NFC recomposes.
+    compose = {}
+    for cp, v in decomp.items():
+        if len(v) == 2 and unicodedata.normalize("NFC", chr(cp)) == chr(cp):
+            compose[(v[0], v[1])] = cp
+
+    # NFC_Quick_Check: No for code points that never occur in NFC, Maybe for
+    # those that can combine with a preceding one, including the Hangul
+    # vowel and trailing consonant jamo.
+    maybe = {second for (_, second) in compose}
+    maybe |= set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))
+    props = {}
+    for cp in range(0x110000):
+        if 0xD800 <= cp < 0xE000:
+            continue
+        ch = chr(cp)
+        qc = QC_YES
+        if cp in maybe:
+            qc = QC_MAYBE
+        elif unicodedata.normalize("NFC", ch) != ch:
+            qc = QC_NO
+        ccc = unicodedata.combining(ch)
+        if qc != QC_YES or ccc != 0:
+            props[cp] = (ccc, qc)
+    assert min(props) == 0x300
+    limit = max(props) + 1
+    pairs = [(0, QC_YES)] + sorted(set(props.values()))
+    index = {p: k for k, p in enumerate(pairs)}
+    values = [index[props.get(cp, (0, QC_YES))] for cp in range(limit)]
+    stage1, blocks = two_level(values, NFC_SHIFT)
+    assert len(blocks) <= 256 and len(pairs) <= 256
+
+    out.append("// Canonical combining class and NFC_Quick_Check.  For a code point")
+    out.append("// `cp` below NFC_LIMIT, with")
+    out.append("// `k = nfc_stage2[nfc_stage1[cp >> NFC_SHIFT]][cp & NFC_MASK]`,")
+    out.append("// they are nfc_ccc[k] and nfc_qc[k] (0 Yes, 1 Maybe, 2 No).  Code")
+    out.append("// points below U+0300 and from NFC_LIMIT up have class 0 and are Yes.")
+    out.append("// A full decomposition has at most NFC_MAX_DECOMP code points.")
+    out.append(f"#define NFC_LIMIT 0x{limit:X}")
+    out.append(f"#define NFC_MAX_DECOMP {max_decomp}")
+    out.append(f"#define NFC_SHIFT {NFC_SHIFT}")
+    out.append(f"#define NFC_MASK 0x{(1 << NFC_SHIFT) - 1:X}")
+    out.append("")
+    emit_array(out, "uint8_t", "nfc_stage1", stage1, 16)
+    out.append(f"static const uint8_t nfc_stage2[{len(blocks)}]"
+               f"[{1 << NFC_SHIFT}] = {{")
+    for block in blocks:
+        out.append("    {")
+        for i in range(0, len(block), 16):
+            out.append("        " + ", ".join(str(x) for x in block[i:i + 16]) +
+                       ",")
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    emit_array(out, "uint8_t", "nfc_ccc", [p[0] for p in pairs], 16)
+    emit_array(out, "uint8_t", "nfc_qc", [p[1] for p in pairs], 16)
+
+    out.append("// Canonical decompositions, one level deep, sorted: bits 42-62 hold")
+    out.append("// the code point, 21-41 the first code point of its decomposition")
+    out.append("// and 0-20 the second, or 0 for a singleton.  Hangul syllables are")
+    out.append("// decomposed algorithmically and are not listed.")
+    entries = []
+    for cp, v in sorted(decomp.items()):
+        second = v[1] if len(v) == 2 else 0
+        entries.append(f"0x{(cp << 42) | (v[0] << 21) | second:X}")
+    emit_array(out, "uint64_t", "nfc_decomp", entries, 3)
+
+    out.append("// Primary composites, sorted: bits 42-62 hold the first code point")
+    out.append("// of the pair, 21-41 the second and 0-20 the composite.")
+    entries = []
+    for (first, second), cp in sorted(compose.items()):
+        entries.append(f"0x{(first << 42) | (second << 21) | cp:X}")
+    emit_array(out, "uint64_t", "nfc_compose", entries, 3)
+
+
+def main():
+    out = [
+        "/**",
+        " * @file mu_string_utf8_tables.h",
+        " *",
+        " * @brief Unicode property tables for mu_string_utf8.c.",
+        " *",
+        f" * Generated from Unicode {unicodedata.unidata_version} by",
+        " * tools/gen_mu_string_utf8_tables.py.  Do not edit.",
+        " */",
+        "",
+        "#ifndef MU_STRING_UTF8_TABLES_H",
+        "#define MU_STRING_UTF8_TABLES_H",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    emit_fold(out)
+    emit_nfc(out)
+    out.append("#endif // MU_STRING_UTF8_TABLES_H")
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()